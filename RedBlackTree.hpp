@@ -6,7 +6,7 @@
 /*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
 /*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
 /*   Created: 15-03-2022  by  `-'                        `-'                  */
-/*   Updated: 17-03-2022 22:37 by                                             */
+/*   Updated: 18-10-2026 05:56 by                                             */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -52,26 +52,29 @@ namespace ft
 			typedef Compare data_compare;
 
 		public:
+			struct node;
+
+			// Nodes come from the same kind of allocator as T (eg. ft::thread_cache_allocator), and are linked
+			// by its pointer type: offset_ptr for a tree in shared memory (see shm_allocator.hpp), node* otherwise
+			typedef typename Allocator::template rebind<node>::other	node_allocator_type;
+			typedef typename node_allocator_type::pointer				node_pointer;
+
 			struct node
 			{
-				node* parent;
-				node* left;
-				node* right;
+				node_pointer parent;
+				node_pointer left;
+				node_pointer right;
 
 				value_type data;
 
-				bool color;
+				char color; // BLACK, RED or END_NODE_COLOR for the dummy end node
 
 				node() : parent(NULL), left(NULL), right(NULL), data(), color(RED) { }
 				node(reference val) : parent(NULL), left(NULL), right(NULL), data(val), color(RED) { }
 				node(const node& n) : parent(n.parent), left(n.left), right(n.right), data(n.data), color(n.color) { }
 			};
 
-			typedef node* node_pointer;
-
 		private:
-			
-			typedef std::allocator<node> node_allocator_type;
 
 			allocator_type		_alloc; // To allocate T
 			node_allocator_type	_nodeAlloc; // To allocate new node
@@ -282,82 +285,87 @@ namespace ft
 				this->_root->color = BLACK;
 			}
 
-			void fixDeleteViolations(node_pointer node)
+			// Missing children (NULL) count as black leaves
+			static bool isBlack(node_pointer node) { return (node == NULL || node->color == BLACK); }
+
+			/* node took the place of a removed black node and is missing one black on its paths.
+			   It can be NULL (the removed node had no child), hence parent given apart */
+			void fixDeleteViolations(node_pointer node, node_pointer parent)
 			{
-				if (node == NULL)
-					return;
-					
 				node_pointer sibling = NULL;
-				while (node != this->_root && node->color == BLACK)
+				while (node != this->_root && isBlack(node))
 				{
-					if (node == node->parent->left)
+					if (node == parent->left)
 					{
-						sibling = node->parent->right;
+						sibling = parent->right;
 						if (sibling->color == RED)
 						{
 							sibling->color = BLACK;
-							node->parent->color = RED;
-							leftRotate(node->parent);
-							sibling = node->parent->right;
+							parent->color = RED;
+							leftRotate(parent);
+							sibling = parent->right;
 						}
 
-						if (sibling->left->color == BLACK && sibling->right->color == BLACK)
+						if (isBlack(sibling->left) && isBlack(sibling->right))
 						{
 							sibling->color = RED;
-							node = node->parent;
+							node = parent;
+							parent = node->parent;
 						}
 						else
 						{
-							if (sibling->right->color == BLACK)
+							if (isBlack(sibling->right))
 							{
 								sibling->left->color = BLACK;
 								sibling->color = RED;
 								rightRotate(sibling);
-								sibling = node->parent->right;
+								sibling = parent->right;
 							}
 
-							sibling->color = node->parent->color;
-							node->parent->color = BLACK;
+							sibling->color = parent->color;
+							parent->color = BLACK;
 							sibling->right->color = BLACK;
-							leftRotate(node->parent);
+							leftRotate(parent);
 							node = this->_root;
 						}
 					}
 					else
 					{
-						sibling = node->parent->left;
+						sibling = parent->left;
 						if (sibling->color == RED)
 						{
 							sibling->color = BLACK;
-							node->parent->color = RED;
-							rightRotate(node->parent);
-							sibling = node->parent->left;
+							parent->color = RED;
+							rightRotate(parent);
+							sibling = parent->left;
 						}
 
-						if (sibling->left->color == BLACK && sibling->right->color == BLACK)
+						if (isBlack(sibling->left) && isBlack(sibling->right))
 						{
 							sibling->color = RED;
-							node = node->parent;
+							node = parent;
+							parent = node->parent;
 						}
 						else
 						{
-							if (sibling->left->color == BLACK)
+							if (isBlack(sibling->left))
 							{
 								sibling->right->color = BLACK;
 								sibling->color = RED;
 								leftRotate(sibling);
-								sibling = node->parent->left;
+								sibling = parent->left;
 							}
 							
-							sibling->color = node->parent->color;
-							node->parent->color = BLACK;
+							sibling->color = parent->color;
+							parent->color = BLACK;
 							sibling->left->color = BLACK;
-							rightRotate(node->parent);
+							rightRotate(parent);
 							node = this->_root;
 						}
 					}
 				}
-				node->color = BLACK;
+				if (node != NULL)
+					node->color = BLACK;
 			}
 
 			// replaces `node` with `replace`
@@ -384,6 +392,35 @@ namespace ft
 				return (recursiveSize(node->left) + 1 + recursiveSize(node->right));
 			}
 
+			/* Copies the structure of another tree node by node, colors included: no search,
+			   no rotation, unlike inserting every value again. Source dummy end is not copied */
+			node_pointer cloneTree(node_pointer src, node_pointer srcDummyEnd, node_pointer parent)
+			{
+				if (src == NULL || src == srcDummyEnd)
+					return (NULL);
+
+				node_pointer node = this->createNode(src->data);
+				node->color = src->color;
+				node->parent = parent;
+				try
+				{
+					node->left = this->cloneTree(src->left, srcDummyEnd, node);
+					node->right = this->cloneTree(src->right, srcDummyEnd, node);
+				}
+				catch (...)
+				{
+					this->recursiveClear(node);
+					throw;
+				}
+				return (node);
+			}
+
+			void copyFrom(const self_type& tree)
+			{
+				this->_root = this->cloneTree(tree._root, tree._dummyEnd, NULL);
+				this->setEndNodeAtTheEnd();
+			}
+
 			// Clears the tree from left to right, from leaves to root
 			void recursiveClear(node_pointer node)
 			{
@@ -415,7 +452,7 @@ namespace ft
 		public:
 			RedBlackTree(const data_compare& comp = data_compare(),
 			    		 const allocator_type& alloc = allocator_type())
-			: _alloc(alloc), _nodeAlloc(), _comp(comp), _root(NULL), _dummyEnd(NULL)
+			: _alloc(alloc), _nodeAlloc(alloc), _comp(comp), _root(NULL), _dummyEnd(NULL)
 			{
 				this->createEndNode();
 			}
@@ -424,8 +461,7 @@ namespace ft
 			: _alloc(tree._alloc), _nodeAlloc(tree._nodeAlloc), _comp(tree._comp), _root(NULL), _dummyEnd(NULL)
 			{
 				this->createEndNode();
-				for (const_iterator it = tree.begin(); it != tree.end(); ++it)
-					this->insert(*it);
+				this->copyFrom(tree);
 			}
 
 			~RedBlackTree()
@@ -436,8 +472,7 @@ namespace ft
 			}
 
 			// https://stackoverflow.com/questions/3381867/iterating-over-a-map/3382702#3382702
-			template <class Node>
-			static node_pointer inorderSuccessor(Node* node)
+			static node_pointer inorderSuccessor(node_pointer node)
 			{
 				if (node == NULL)
 					return (NULL);
@@ -462,8 +497,7 @@ namespace ft
 			}
 
 			// Basically a mirror of inorderSuccessor
-			template <class Node>
-			static node_pointer inorderPredecessor(Node* node)
+			static node_pointer inorderPredecessor(node_pointer node)
 			{
 				if (node == NULL)
 					return (NULL);
@@ -514,6 +548,7 @@ namespace ft
 						curr = curr->right;
 					else // Same value already present
 					{
+						this->deleteNode(node);
 						this->setEndNodeAtTheEnd();
 						return (false);
 					}
@@ -539,6 +574,7 @@ namespace ft
 
 				int originalColor = node->color;
 				node_pointer newNode = NULL;
+				node_pointer newParent = node->parent; // Parent of newNode once node is gone
 
 				if (node->left == NULL && node->right == NULL)
 				{
@@ -563,8 +599,10 @@ namespace ft
 					node_pointer successor = this->inorderSuccessor(node);
 					originalColor = successor->color;
 					newNode = successor->right;
+					newParent = successor;
 					if (successor->parent != node)
 					{
+						newParent = successor->parent;
 						replaceNode(successor, successor->right);
 						successor->right = node->right;
 						successor->right->parent = successor;
@@ -578,7 +616,7 @@ namespace ft
 
 				this->deleteNode(node);
 				if (originalColor == BLACK)
-					this->fixDeleteViolations(newNode);
+					this->fixDeleteViolations(newNode, newParent);
 				
 				this->setEndNodeAtTheEnd();
 			}
@@ -606,9 +644,9 @@ namespace ft
 				return (curr); // Either a isEq(ual) node or NULL
 			}
 
-			const node_pointer getRoot() const { return (this->_root); }
+			node_pointer getRoot() const { return (this->_root); }
 
-			const node_pointer getDummyEnd() const { return (this->_dummyEnd); }
+			node_pointer getDummyEnd() const { return (this->_dummyEnd); }
 
 			size_t size() const { return (this->recursiveSize(this->_root)); }
 
@@ -668,18 +706,15 @@ namespace ft
 
 			self_type& operator=(const self_type& tree)
 			{
+				if (this == &tree)
+					return (*this);
+
+				// Allocators aren't copied: the dummy end and the next nodes must be freed by the one which allocated them
 				this->clear();
-				this->_alloc = tree._alloc;
-				this->_nodeAlloc = tree._nodeAlloc;
 				this->_comp = tree._comp;
 
-				this->_root = NULL;
-				this->createEndNode();
-	
-				for (const_iterator it = tree.begin(); it != tree.end(); ++it)
-					this->insert(*it);
-
-				this->setEndNodeAtTheEnd();
+				// Keep our dummy end, only the nodes are copied
+				this->copyFrom(tree);
 				
 				return (*this);
 			}
@@ -6,7 +6,7 @@
 /*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
 /*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
 /*   Created: 13-03-2022  by  `-'                        `-'                  */
-/*   Updated: 15-03-2022 20:32 by                                             */
+/*   Updated: 18-10-2026 05:56 by                                             */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -81,41 +81,46 @@ namespace ft
 
 			/********** Friend relational operators, to allow const and non-const mixed **********/
 
-			// Operators on possibly different (const / non-const) iterators
+			// Operators on possibly different (const / non-const) iterators, VectIterators only: unconstrained
+			// templates would be picked for any two objects compared in namespace ft (eg. offset_ptr == NULL)
 
-			// A - B, Uses IteRight for SNIFAE to force using operator-(difference_type) for 'begin() - 2' for instance
-			template <class IteLeft, class IteRight>
-			friend typename IteRight::difference_type operator-(const IteLeft& lhs, const IteRight& rhs);
+			// A - B, only between VectIterators so that 'begin() - 2' uses operator-(difference_type)
+			template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+			friend typename VectIterator<TRight, RIsConst>::difference_type operator-(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs);
 
 			// n + A
 			template <typename Type>
 			friend VectIterator<Type> operator+(typename VectIterator<Type>::difference_type n, const VectIterator<Type>& rhs);
 
 			// A == B / B == A
-			template <class IteLeft, class IteRight>
-			friend bool operator==(const IteLeft& lhs, const IteRight& rhs);
+			template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+			friend bool operator==(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs);
 
 			// A != B / B != A
-			template <class IteLeft, class IteRight>
-			friend bool operator!=(const IteLeft& lhs, const IteRight& rhs);
+			template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+			friend bool operator!=(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs);
 
 			// A < B
-			template <class IteLeft, class IteRight>
-			friend bool operator<(const IteLeft& lhs, const IteRight& rhs);
+			template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+			friend bool operator<(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs);
 
 			// A <= B
-			template <class IteLeft, class IteRight>
-			friend bool operator<=(const IteLeft& lhs, const IteRight& rhs);
+			template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+			friend bool operator<=(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs);
 
 			// A > B
-			template <class IteLeft, class IteRight>
-			friend bool operator>(const IteLeft& lhs, const IteRight& rhs);
+			template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+			friend bool operator>(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs);
 
 			// A >= B
-			template <class IteLeft, class IteRight>
-			friend bool operator>=(const IteLeft& lhs, const IteRight& rhs);
+			template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+			friend bool operator>=(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs);
 	};
 
+	// Elements of a vector are contiguous, see ft::is_contiguous_iterator
+	template <typename T, bool IsConst>
+	struct is_contiguous_iterator<VectIterator<T, IsConst> > { static const bool value = true; };
+
 	/* List of operations:
 
 		A and B are iterators (can be iterator and / or const_iterator)
@@ -156,34 +161,34 @@ namespace ft
 	VectIterator<T> operator+(typename VectIterator<T>::difference_type n, const VectIterator<T>& rhs) { return (VectIterator<T>(rhs._ptr + n)); }
 
 	// A - B
-	// Will automatically not compile if IteLeft and IteRight are not of the same type (eg. bool pointer and int pointer)
+	// Will automatically not compile if TLeft and TRight pointers can't be subtracted (eg. bool pointer and int pointer)
 	// Only operator- returns a difference type, trying to print it1 + it2 will faill on std
-	template <class IteLeft, class IteRight>
-	typename IteRight::difference_type operator-(const IteLeft& lhs, const IteRight& rhs) { return (lhs._ptr - rhs._ptr); }
+	template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+	typename VectIterator<TRight, RIsConst>::difference_type operator-(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs) { return (lhs._ptr - rhs._ptr); }
 
 	// A == B / B == A
-	template <class IteLeft, class IteRight>
-	bool operator==(const IteLeft& lhs, const IteRight& rhs) { return (lhs._ptr == rhs._ptr); }
+	template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+	bool operator==(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs) { return (lhs._ptr == rhs._ptr); }
 
 	// A != B / B != A
-	template <class IteLeft, class IteRight>
-	bool operator!=(const IteLeft& lhs, const IteRight& rhs) { return (lhs._ptr != rhs._ptr); }
+	template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+	bool operator!=(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs) { return (lhs._ptr != rhs._ptr); }
 
 	// A < B
-	template <class IteLeft, class IteRight>
-	bool operator<(const IteLeft& lhs, const IteRight& rhs) { return (lhs._ptr < rhs._ptr); }
+	template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+	bool operator<(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs) { return (lhs._ptr < rhs._ptr); }
 
 	// A <= B
-	template <class IteLeft, class IteRight>
-	bool operator<=(const IteLeft& lhs, const IteRight& rhs) { return (lhs._ptr <= rhs._ptr); }
+	template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+	bool operator<=(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs) { return (lhs._ptr <= rhs._ptr); }
 
 	// A > B
-	template <class IteLeft, class IteRight>
-	bool operator>(const IteLeft& lhs, const IteRight& rhs) { return (lhs._ptr > rhs._ptr); }
+	template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+	bool operator>(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs) { return (lhs._ptr > rhs._ptr); }
 
 	// A >= B
-	template <class IteLeft, class IteRight>
-	bool operator>=(const IteLeft& lhs, const IteRight& rhs) { return (lhs._ptr >= rhs._ptr); }
+	template <class TLeft, bool LIsConst, class TRight, bool RIsConst>
+	bool operator>=(const VectIterator<TLeft, LIsConst>& lhs, const VectIterator<TRight, RIsConst>& rhs) { return (lhs._ptr >= rhs._ptr); }
 
 }
 
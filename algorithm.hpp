@@ -0,0 +1,384 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:59 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ALGORITHM_HPP
+# define ALGORITHM_HPP
+
+#include "iterators.hpp"
+#include "pairs.hpp"
+#include "simd_reduce.hpp"
+#include "type_traits.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace ft
+{
+	/* Both iterators are contiguous over the same trivially copyable type:
+	   copying elements is copying bytes */
+	template <class InputIterator, class OutputIterator>
+	struct is_memcpyable
+	{
+		typedef typename ft::remove_const<typename ft::iterator_traits<InputIterator>::value_type>::type value_type;
+
+		static const bool value = ft::is_contiguous_iterator<InputIterator>::value
+								  && ft::is_contiguous_iterator<OutputIterator>::value
+								  && ft::is_same<value_type, typename ft::iterator_traits<OutputIterator>::value_type>::value
+								  && ft::is_trivially_copyable<value_type>::value;
+
+		typedef typename ft::choose<value, ft::true_type, ft::false_type>::type type;
+	};
+
+	/*******************************************************
+	 *                   copy / copy_backward              *
+	 *******************************************************/
+
+	template <class InputIterator, class OutputIterator>
+	OutputIterator copy_dispatch(InputIterator first, InputIterator last, OutputIterator result, ft::false_type)
+	{
+		for (; first != last; ++first, ++result)
+			*result = *first;
+		return (result);
+	}
+
+	// memmove and not memcpy, result may be inside [first, last) as long as it is before first
+	template <class InputIterator, class OutputIterator>
+	OutputIterator copy_dispatch(InputIterator first, InputIterator last, OutputIterator result, ft::true_type)
+	{
+		const size_t n = last - first;
+
+		if (n != 0)
+			std::memmove(ft::to_address(result), ft::to_address(first), n * sizeof(*first));
+		return (result + n);
+	}
+
+	// Assigns [first, last) to the elements starting at result, returns the end of the copied range
+	template <class InputIterator, class OutputIterator>
+	OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result)
+	{ return (ft::copy_dispatch(first, last, result, typename ft::is_memcpyable<InputIterator, OutputIterator>::type())); }
+
+
+	template <class BidirectionalIterator1, class BidirectionalIterator2>
+	BidirectionalIterator2 copy_backward_dispatch(BidirectionalIterator1 first, BidirectionalIterator1 last,
+												  BidirectionalIterator2 result, ft::false_type)
+	{
+		while (last != first)
+			*--result = *--last;
+		return (result);
+	}
+
+	template <class BidirectionalIterator1, class BidirectionalIterator2>
+	BidirectionalIterator2 copy_backward_dispatch(BidirectionalIterator1 first, BidirectionalIterator1 last,
+												  BidirectionalIterator2 result, ft::true_type)
+	{
+		const size_t n = last - first;
+
+		result = result - n;
+		if (n != 0)
+			std::memmove(ft::to_address(result), ft::to_address(first), n * sizeof(*first));
+		return (result);
+	}
+
+	/* Same but from the end, result is the end of the destination: used to shift elements
+	   to the right when the destination overlaps the end of the source */
+	template <class BidirectionalIterator1, class BidirectionalIterator2>
+	BidirectionalIterator2 copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last,
+										 BidirectionalIterator2 result)
+	{
+		return (ft::copy_backward_dispatch(first, last, result,
+										   typename ft::is_memcpyable<BidirectionalIterator1, BidirectionalIterator2>::type()));
+	}
+
+	/*******************************************************
+	 *                     fill / fill_n                   *
+	 *******************************************************/
+
+	/* If every byte of val is the same (any char, 0, -1...), memset can write it */
+	template <class T>
+	bool is_memsettable(const T& val, unsigned char& byte)
+	{
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&val);
+
+		for (size_t i = 1; i < sizeof(T); ++i)
+			if (bytes[i] != bytes[0])
+				return (false);
+		byte = bytes[0];
+		return (true);
+	}
+
+	template <class ForwardIterator, class T>
+	ForwardIterator fill_n_dispatch(ForwardIterator first, size_t n, const T& val, ft::false_type)
+	{
+		for (; n > 0; --n, ++first)
+			*first = val;
+		return (first);
+	}
+
+	template <class ForwardIterator, class T>
+	ForwardIterator fill_n_dispatch(ForwardIterator first, size_t n, const T& val, ft::true_type)
+	{
+		typedef typename ft::iterator_traits<ForwardIterator>::value_type value_type;
+
+		const value_type value = val; // Converted first, so that the bytes are the element ones
+		unsigned char byte;
+
+		if (n != 0 && ft::is_memsettable(value, byte))
+		{
+			std::memset(static_cast<void*>(ft::to_address(first)), byte, n * sizeof(value_type));
+			return (first + n);
+		}
+		return (ft::fill_n_dispatch(first, n, value, ft::false_type()));
+	}
+
+	template <class ForwardIterator>
+	struct is_contiguous_trivial
+	{
+		typedef typename ft::iterator_traits<ForwardIterator>::value_type value_type;
+
+		static const bool value = ft::is_contiguous_iterator<ForwardIterator>::value
+								  && ft::is_trivially_copyable<value_type>::value;
+
+		typedef typename ft::choose<value, ft::true_type, ft::false_type>::type type;
+	};
+
+	// Assigns val to the n elements starting at first, returns the end of the filled range
+	template <class OutputIterator, class Size, class T>
+	OutputIterator fill_n(OutputIterator first, Size n, const T& val)
+	{
+		if (n <= 0)
+			return (first);
+		return (ft::fill_n_dispatch(first, static_cast<size_t>(n), val,
+									typename ft::is_contiguous_trivial<OutputIterator>::type()));
+	}
+
+	template <class ForwardIterator, class T>
+	void fill(ForwardIterator first, ForwardIterator last, const T& val)
+	{
+		if (ft::is_contiguous_trivial<ForwardIterator>::value)
+			ft::fill_n(first, ft::distance(first, last), val);
+		else
+		{
+			for (; first != last; ++first)
+				*first = val;
+		}
+	}
+
+	/*******************************************************
+	 *                  generate / transform               *
+	 *******************************************************/
+
+	template <class ForwardIterator, class Generator>
+	void generate(ForwardIterator first, ForwardIterator last, Generator gen)
+	{
+		for (; first != last; ++first)
+			*first = gen();
+	}
+
+	template <class InputIterator, class OutputIterator, class UnaryOperation>
+	OutputIterator transform(InputIterator first, InputIterator last, OutputIterator result, UnaryOperation op)
+	{
+		for (; first != last; ++first, ++result)
+			*result = op(*first);
+		return (result);
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class BinaryOperation>
+	OutputIterator transform(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+							 OutputIterator result, BinaryOperation op)
+	{
+		for (; first1 != last1; ++first1, ++first2, ++result)
+			*result = op(*first1, *first2);
+		return (result);
+	}
+
+	/*******************************************************
+	 *                   find / count                      *
+	 *******************************************************/
+
+	/* Contiguous range of a type with a kernel, searched for a value of the exact same type
+	   (find(ints, 3.5) must compare as doubles, it can't go through the int kernel) */
+	template <class Iterator, class T>
+	struct is_simd_searchable
+	{
+		typedef typename ft::remove_const<typename ft::iterator_traits<Iterator>::value_type>::type value_type;
+
+		static const bool value = ft::is_contiguous_iterator<Iterator>::value
+								  && ft::is_same<value_type, T>::value
+								  && ft::simd_search_type<value_type>::value;
+
+		typedef typename ft::choose<value, ft::true_type, ft::false_type>::type type;
+	};
+
+	template <class InputIterator, class T>
+	InputIterator find_dispatch(InputIterator first, InputIterator last, const T& value, ft::false_type)
+	{
+		for (; first != last; ++first)
+			if (*first == value)
+				break;
+		return (first);
+	}
+
+	template <class InputIterator, class T>
+	InputIterator find_dispatch(InputIterator first, InputIterator last, const T& value, ft::true_type)
+	{
+		typedef typename ft::simd_search_type<T>::type kernel_type;
+
+		const kernel_type* data = reinterpret_cast<const kernel_type*>(ft::to_address(first));
+
+		return (first + ft::simd_find(data, last - first, static_cast<kernel_type>(value)));
+	}
+
+	template <class InputIterator, class T>
+	InputIterator find(InputIterator first, InputIterator last, const T& value)
+	{ return (ft::find_dispatch(first, last, value, typename ft::is_simd_searchable<InputIterator, T>::type())); }
+
+	template <class InputIterator, class UnaryPredicate>
+	InputIterator find_if(InputIterator first, InputIterator last, UnaryPredicate pred)
+	{
+		for (; first != last; ++first)
+			if (pred(*first))
+				break;
+		return (first);
+	}
+
+
+	template <class InputIterator, class T>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	count_dispatch(InputIterator first, InputIterator last, const T& value, ft::false_type)
+	{
+		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
+
+		for (; first != last; ++first)
+			if (*first == value)
+				++n;
+		return (n);
+	}
+
+	template <class InputIterator, class T>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	count_dispatch(InputIterator first, InputIterator last, const T& value, ft::true_type)
+	{
+		typedef typename ft::simd_search_type<T>::type kernel_type;
+
+		const kernel_type* data = reinterpret_cast<const kernel_type*>(ft::to_address(first));
+
+		return (ft::simd_count(data, last - first, static_cast<kernel_type>(value)));
+	}
+
+	template <class InputIterator, class T>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	count(InputIterator first, InputIterator last, const T& value)
+	{ return (ft::count_dispatch(first, last, value, typename ft::is_simd_searchable<InputIterator, T>::type())); }
+
+	template <class InputIterator, class UnaryPredicate>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	count_if(InputIterator first, InputIterator last, UnaryPredicate pred)
+	{
+		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
+
+		for (; first != last; ++first)
+			if (pred(*first))
+				++n;
+		return (n);
+	}
+
+	/*******************************************************
+	 *                    minmax_element                   *
+	 *******************************************************/
+
+	/* The kernel only gives values, the range is reduced by blocks so that finding
+	   where the min and max were only means scanning one block again */
+	#define MINMAX_BLOCK 4096
+
+	template <class Iterator>
+	struct is_simd_reducible
+	{
+		typedef typename ft::remove_const<typename ft::iterator_traits<Iterator>::value_type>::type value_type;
+
+		static const bool value = ft::is_contiguous_iterator<Iterator>::value
+								  && ft::has_simd_reduction<value_type>::value;
+
+		typedef typename ft::choose<value, ft::true_type, ft::false_type>::type type;
+	};
+
+	// Smallest element and largest element, first of the smallest and last of the largest when equal
+	template <class ForwardIterator, class Compare>
+	ft::pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first, ForwardIterator last, Compare comp)
+	{
+		ForwardIterator min = first;
+		ForwardIterator max = first;
+
+		if (first == last)
+			return (ft::make_pair(min, max));
+		while (++first != last)
+		{
+			if (comp(*first, *min))
+				min = first;
+			else if (!comp(*first, *max))
+				max = first;
+		}
+		return (ft::make_pair(min, max));
+	}
+
+	template <class ForwardIterator>
+	ft::pair<ForwardIterator, ForwardIterator> minmax_element_dispatch(ForwardIterator first, ForwardIterator last, ft::false_type)
+	{ return (ft::minmax_element(first, last, std::less<typename ft::iterator_traits<ForwardIterator>::value_type>())); }
+
+	// A NaN anywhere makes operator< order depend on positions, that case is left to the loop
+	template <class ForwardIterator>
+	ft::pair<ForwardIterator, ForwardIterator> minmax_element_dispatch(ForwardIterator first, ForwardIterator last, ft::true_type)
+	{
+		typedef typename ft::is_simd_reducible<ForwardIterator>::value_type value_type;
+
+		if (first == last)
+			return (ft::make_pair(first, last));
+
+		const value_type* data = ft::to_address(first);
+		const size_t n = last - first;
+		value_type min = data[0];
+		value_type max = data[0];
+		value_type blockMin, blockMax;
+		size_t minBlock = 0;
+		size_t maxBlock = 0;
+
+		for (size_t block = 0; block < n; block += MINMAX_BLOCK)
+		{
+			if (!ft::simd_minmax(data + block, std::min(n - block, (size_t)MINMAX_BLOCK), blockMin, blockMax))
+				return (ft::minmax_element_dispatch(first, last, ft::false_type()));
+			if (block == 0 || blockMin < min)
+			{
+				min = blockMin;
+				minBlock = block;
+			}
+			if (block == 0 || !(blockMax < max))
+			{
+				max = blockMax;
+				maxBlock = block;
+			}
+		}
+
+		size_t minIndex = minBlock + ft::simd_find(data + minBlock, std::min(n - minBlock, (size_t)MINMAX_BLOCK), min);
+		size_t maxIndex = std::min(n, maxBlock + MINMAX_BLOCK) - 1;
+		while (!(data[maxIndex] == max))
+			--maxIndex;
+		return (ft::make_pair(first + minIndex, first + maxIndex));
+	}
+
+	template <class ForwardIterator>
+	ft::pair<ForwardIterator, ForwardIterator> minmax_element(ForwardIterator first, ForwardIterator last)
+	{ return (ft::minmax_element_dispatch(first, last, typename ft::is_simd_reducible<ForwardIterator>::type())); }
+
+}
+
+#endif
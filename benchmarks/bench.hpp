@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:25 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+#include <sys/time.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+/* Tiny helpers shared by every benchmark, so they all print the same way */
+namespace bench
+{
+	class Timer
+	{
+		private:
+			struct timeval _start;
+
+		public:
+			Timer() { this->reset(); }
+
+			void reset() { gettimeofday(&this->_start, NULL); }
+
+			// Seconds since construction / last reset
+			double elapsed() const
+			{
+				struct timeval now;
+
+				gettimeofday(&now, NULL);
+				return ((now.tv_sec - this->_start.tv_sec) + (now.tv_usec - this->_start.tv_usec) / 1e6);
+			}
+	};
+
+	/* "4K" / "16M" / "1G" to a number, powers of 1000 for counts, 1024 for bytes */
+	inline size_t parseSize(const char* str, size_t unit)
+	{
+		char* end = NULL;
+		size_t value = std::strtoul(str, &end, 10);
+
+		switch (*end)
+		{
+			case 'G': case 'g': value *= unit;
+			// fall through
+			case 'M': case 'm': value *= unit;
+			// fall through
+			case 'K': case 'k': value *= unit;
+			// fall through
+			default: break;
+		}
+		return (value);
+	}
+
+	inline size_t parseCount(const char* str) { return (parseSize(str, 1000)); }
+	inline size_t parseBytes(const char* str) { return (parseSize(str, 1024)); }
+
+	inline void header(const std::string& title)
+	{
+		std::cout << std::endl << "===== " << title << " =====" << std::endl;
+		std::cout << std::left << std::setw(32) << "case" << std::right
+				  << std::setw(14) << "n" << std::setw(12) << "ms" << std::setw(14) << "M items/s" << std::endl;
+	}
+
+	// One line per measure: what, how many items, how long
+	inline void report(const std::string& name, size_t n, double seconds)
+	{
+		std::cout << std::left << std::setw(32) << name << std::right
+				  << std::setw(14) << n
+				  << std::setw(12) << std::fixed << std::setprecision(2) << seconds * 1000
+				  << std::setw(14) << std::fixed << std::setprecision(2) << (seconds > 0 ? n / seconds / 1e6 : 0)
+				  << std::endl;
+	}
+
+	// Same but for throughput in bytes
+	inline void reportBytes(const std::string& name, size_t bytes, double seconds)
+	{
+		std::cout << std::left << std::setw(32) << name << std::right
+				  << std::setw(14) << bytes
+				  << std::setw(12) << std::fixed << std::setprecision(2) << seconds * 1000
+				  << std::setw(11) << std::fixed << std::setprecision(2) << (seconds > 0 ? bytes / seconds / 1e9 : 0)
+				  << " GB/s" << std::endl;
+	}
+
+	// Prevents the compiler from optimizing away a result nobody reads
+	template <class T>
+	inline void doNotOptimize(const T& value)
+	{
+		asm volatile("" : : "r"(&value) : "memory");
+	}
+}
+
+#endif
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:53 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <sstream>
+
+#include "bloom_filter.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+/* A Bloom filter in front of a map: the measured false positive rate of ft::bloom_filter for a
+   few configured ones, then lookups in an ft::map vs an ft::filtered_map from all misses to all
+   hits, then erases (rebuilding the filter as the erased keys pile up) followed by lookups.
+   ./run.sh bloom_filter [keys] (default 1M, and as many lookups) */
+
+typedef ft::filtered_map<int, long> filtered_type;
+
+// Keys in the maps are even, misses are odd
+ft::vector<int> makeProbes(size_t n, size_t queries, unsigned hitPercent)
+{
+	ft::vector<int> probes(queries);
+
+	for (size_t i = 0; i < queries; ++i)
+		probes[i] = (int)(rand() % n) * 2 + ((unsigned)(rand() % 100) < hitPercent ? 0 : 1);
+	return (probes);
+}
+
+// Looks every probe up in both maps, false if they disagree
+bool lookups(const ft::map<int, long>& map, const filtered_type& filtered, const ft::vector<int>& probes)
+{
+	size_t hitsMap = 0, hitsFiltered = 0;
+	long sumMap = 0, sumFiltered = 0;
+
+	bench::Timer timer;
+	for (size_t i = 0; i < probes.size(); ++i)
+	{
+		ft::map<int, long>::const_iterator it = map.find(probes[i]);
+		if (it != map.end())
+		{
+			++hitsMap;
+			sumMap += it->second;
+		}
+	}
+	bench::report("ft::map find", probes.size(), timer.elapsed());
+
+	timer.reset();
+	for (size_t i = 0; i < probes.size(); ++i)
+	{
+		filtered_type::const_iterator it = filtered.find(probes[i]);
+		if (it != filtered.end())
+		{
+			++hitsFiltered;
+			sumFiltered += it->second;
+		}
+	}
+	bench::report("filtered_map find", probes.size(), timer.elapsed());
+	return (hitsMap == hitsFiltered && sumMap == sumFiltered);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 1000000;
+	const double rates[] = { 0.1, 0.01, 0.001 };
+	const unsigned hits[] = { 0, 10, 50, 90, 100 };
+	bool ok = true;
+
+	srand(42);
+	bench::header("bloom_filter inserts and misses");
+	for (size_t r = 0; r < sizeof(rates) / sizeof(*rates); ++r)
+	{
+		ft::bloom_filter<int> filter(n, rates[r]);
+		size_t positives = 0;
+
+		bench::Timer timer;
+		for (size_t i = 0; i < n; ++i)
+			filter.insert((int)i * 2);
+		bench::report("insert", n, timer.elapsed());
+
+		timer.reset();
+		for (size_t i = 0; i < n; ++i)
+			positives += filter.may_contain((int)i * 2 + 1);
+		bench::report("may_contain, misses", n, timer.elapsed());
+
+		for (size_t i = 0; i < n; ++i)
+			ok = filter.may_contain((int)i * 2) && ok;
+		const double measured = (double)positives / n;
+		std::cout << "configured " << std::fixed << std::setprecision(4) << rates[r] << ", measured " << measured
+				  << ", " << std::setprecision(1) << (double)filter.bit_count() / n << " bits per key, "
+				  << filter.hash_count() << " hashes" << std::endl;
+		ok = measured < rates[r] * 1.2 && ok;
+	}
+
+	ft::map<int, long> map;
+	filtered_type filtered;
+	bench::header("inserts");
+	bench::Timer timer;
+	for (size_t i = 0; i < n; ++i)
+		map.insert(ft::make_pair((int)i * 2, (long)i));
+	bench::report("ft::map insert", n, timer.elapsed());
+
+	timer.reset();
+	for (size_t i = 0; i < n; ++i)
+		filtered.insert(ft::make_pair((int)i * 2, (long)i));
+	bench::report("filtered_map insert", n, timer.elapsed());
+
+	for (size_t h = 0; h < sizeof(hits) / sizeof(*hits); ++h)
+	{
+		std::ostringstream title;
+		title << "lookups, " << hits[h] << "% hits";
+		bench::header(title.str());
+		ok = lookups(map, filtered, makeProbes(n, n, hits[h])) && ok;
+	}
+
+	// Erases 3 keys in 4, the filter drops them each time they outnumber half the keys left
+	timer.reset();
+	for (size_t i = 0; i < n; ++i)
+		if (i % 4)
+			filtered.erase((int)i * 2);
+	bench::report("filtered_map erase", n - (n + 3) / 4, timer.elapsed());
+	for (size_t i = 0; i < n; ++i)
+		if (i % 4)
+			map.erase((int)i * 2);
+	bench::header("lookups after erases, 50% hits before");
+	ok = lookups(map, filtered, makeProbes(n, n, 50)) && ok;
+	ok = filtered.size() == (n + 3) / 4 && ok;
+
+	if (!ok)
+	{
+		std::cout << "Error: filtered_map and ft::map disagree, or too many false positives" << std::endl;
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:08 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+
+#include "compressed_int_set.hpp"
+#include "memory_resource.hpp"
+#include "set.hpp"
+#include "vector.hpp"
+
+/* Sorted document ids in an ft::set<uint32_t> vs an ft::compressed_int_set: bytes per id, then
+   contains (half hits), lower_bound, a full scan and the intersection with a set of a tenth of
+   the ids. The set's bytes are what its nodes asked for, malloc adds its own header to each.
+   ./run.sh compressed_int_set [ids] [average gap] (default 4M, 8) */
+
+typedef ft::set<uint32_t, std::less<uint32_t>, ft::polymorphic_allocator<uint32_t> > id_set;
+
+// Counts the bytes in use, memory from new / delete
+class counting_resource : public ft::memory_resource
+{
+	public:
+		size_t bytes;
+
+		counting_resource() : bytes(0) { }
+
+	protected:
+		virtual void* do_allocate(size_t bytes, size_t alignment)
+		{
+			this->bytes += bytes;
+			return (ft::new_delete_resource()->allocate(bytes, alignment));
+		}
+
+		virtual void do_deallocate(void* p, size_t bytes, size_t alignment)
+		{
+			this->bytes -= bytes;
+			ft::new_delete_resource()->deallocate(p, bytes, alignment);
+		}
+
+		virtual bool do_is_equal(const ft::memory_resource& other) const { return (this == &other); }
+};
+
+// Sorted ids, gaps of 1 to 2 * gap - 1
+ft::vector<uint32_t> makeIds(size_t n, size_t gap)
+{
+	ft::vector<uint32_t> ids(n);
+	uint32_t id = 0;
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		id += 1 + rand() % (2 * gap - 1);
+		ids[i] = id;
+	}
+	return (ids);
+}
+
+void reportMemory(const std::string& name, size_t n, size_t bytes)
+{
+	std::cout << std::left << std::setw(32) << name << std::right << std::setw(14) << n
+			  << std::setw(12) << bytes / 1024 << " KiB" << std::setw(10) << std::fixed << std::setprecision(2)
+			  << (double)bytes / n << " B/id" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 4000000;
+	const size_t gap = std::max((argc > 2) ? bench::parseCount(argv[2]) : 8, (size_t)1);
+	const size_t queries = 1000000;
+	bool ok = true;
+
+	srand(42);
+	const ft::vector<uint32_t> ids = makeIds(n, gap);
+	ft::vector<uint32_t> probes(queries);
+	for (size_t i = 0; i < queries; ++i)
+		probes[i] = (i % 2) ? ids[rand() % n] : (uint32_t)(rand() % (ids.back() + 1));
+	// Every tenth id, every other one moved by one
+	ft::vector<uint32_t> otherIds;
+	for (size_t i = 0; i < n; i += 10)
+		otherIds.push_back(ids[i] + (i % 20 ? 1 : 0));
+
+	counting_resource resource;
+	id_set set(std::less<uint32_t>(), &resource);
+	id_set otherSet(std::less<uint32_t>(), &resource);
+
+	bench::header("building");
+	bench::Timer timer;
+	for (size_t i = 0; i < n; ++i)
+		set.insert(set.end(), ids[i]);
+	bench::report("ft::set insert at end", n, timer.elapsed());
+	const size_t setBytes = resource.bytes;
+	for (size_t i = 0; i < otherIds.size(); ++i)
+		otherSet.insert(otherSet.end(), otherIds[i]);
+
+	timer.reset();
+	ft::compressed_int_set compressed;
+	for (size_t i = 0; i < n; ++i)
+		compressed.push_back(ids[i]);
+	bench::report("compressed push_back", n, timer.elapsed());
+	const ft::compressed_int_set otherCompressed(otherIds.begin(), otherIds.end());
+	ok = (compressed.size() == n) && ok;
+
+	std::cout << std::endl << "average gap " << gap << std::endl;
+	reportMemory("ft::set", n, setBytes);
+	reportMemory("compressed_int_set", n, compressed.memory_usage());
+
+	bench::header("contains, half hits");
+	size_t hitsSet = 0, hitsCompressed = 0;
+	timer.reset();
+	for (size_t i = 0; i < queries; ++i)
+		hitsSet += set.count(probes[i]);
+	bench::report("ft::set count", queries, timer.elapsed());
+
+	timer.reset();
+	for (size_t i = 0; i < queries; ++i)
+		hitsCompressed += compressed.contains(probes[i]);
+	bench::report("compressed contains", queries, timer.elapsed());
+	ok = (hitsSet == hitsCompressed) && ok;
+
+	// ft::set::lower_bound walks the set from its first element, so it only gets a few queries
+	bench::header("lower_bound");
+	const size_t setQueries = std::min(queries, std::max((size_t)10, (size_t)1000000000 / n / 4));
+	unsigned long sumSet = 0, sumCompressed = 0;
+	timer.reset();
+	for (size_t i = 0; i < setQueries; ++i)
+	{
+		id_set::const_iterator it = set.lower_bound(probes[i]);
+		sumSet += (it == set.end()) ? 0 : *it;
+	}
+	bench::report("ft::set", setQueries, timer.elapsed());
+
+	timer.reset();
+	for (size_t i = 0; i < queries; ++i)
+	{
+		ft::compressed_int_set::const_iterator it = compressed.lower_bound(probes[i]);
+		sumCompressed += (it == compressed.end() || i >= setQueries) ? 0 : *it;
+	}
+	bench::report("compressed", queries, timer.elapsed());
+	ok = (sumSet == sumCompressed) && ok;
+
+	bench::header("full scan");
+	sumSet = 0;
+	sumCompressed = 0;
+	timer.reset();
+	for (id_set::const_iterator it = set.begin(); it != set.end(); ++it)
+		sumSet += *it;
+	bench::report("ft::set", n, timer.elapsed());
+
+	timer.reset();
+	const ft::compressed_int_set::const_iterator end = compressed.end();
+	for (ft::compressed_int_set::const_iterator it = compressed.begin(); it != end; ++it)
+		sumCompressed += *it;
+	bench::report("compressed", n, timer.elapsed());
+	ok = (sumSet == sumCompressed) && ok;
+
+	bench::header("intersection with a tenth of the ids");
+	ft::vector<uint32_t> common;
+	timer.reset();
+	{
+		id_set::const_iterator a = set.begin(), b = otherSet.begin();
+		while (a != set.end() && b != otherSet.end())
+		{
+			if (*a < *b)
+				++a;
+			else if (*b < *a)
+				++b;
+			else
+			{
+				common.push_back(*a);
+				++a;
+				++b;
+			}
+		}
+	}
+	bench::report("ft::set merge", n + otherIds.size(), timer.elapsed());
+
+	timer.reset();
+	ft::compressed_int_set commonCompressed = intersection(compressed, otherCompressed);
+	bench::report("compressed intersection", n + otherIds.size(), timer.elapsed());
+	ok = (commonCompressed.size() == common.size()) && ok;
+	size_t i = 0;
+	for (ft::compressed_int_set::const_iterator it = commonCompressed.begin(); ok && it != commonCompressed.end(); ++it)
+		ok = (*it == common[i++]);
+
+	if (!ok)
+	{
+		std::cout << "Error: compressed_int_set and ft::set disagree" << std::endl;
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,216 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:05 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <queue>
+#include <sstream>
+
+#include "concurrent_queue.hpp"
+
+/* Throughput of a producer / consumer hand-off, half the threads pushing and half popping:
+   a std::queue behind a mutex vs ft::concurrent_queue, one value at a time and by batches.
+   ./run.sh concurrent_queue [items] [max threads] (default 1M items, up to 32 threads) */
+
+#define QUEUE_CAPACITY 1024
+#define BATCH 32
+
+// What the stages used before: any queue behind a mutex
+class LockedQueue
+{
+	private:
+		pthread_mutex_t		_mutex;
+		std::queue<size_t>	_queue;
+
+	public:
+		LockedQueue() { pthread_mutex_init(&this->_mutex, NULL); }
+		~LockedQueue() { pthread_mutex_destroy(&this->_mutex); }
+
+		bool try_push(size_t val)
+		{
+			pthread_mutex_lock(&this->_mutex);
+			const bool room = (this->_queue.size() < QUEUE_CAPACITY);
+			if (room)
+				this->_queue.push(val);
+			pthread_mutex_unlock(&this->_mutex);
+			return (room);
+		}
+
+		bool try_pop(size_t& val)
+		{
+			pthread_mutex_lock(&this->_mutex);
+			const bool found = !this->_queue.empty();
+			if (found)
+			{
+				val = this->_queue.front();
+				this->_queue.pop();
+			}
+			pthread_mutex_unlock(&this->_mutex);
+			return (found);
+		}
+};
+
+template <class Queue>
+struct Stage
+{
+	Queue*	queue;
+	size_t	begin; // Producers: values pushed, consumers: how many to pop
+	size_t	end;
+	bool	batched;
+	size_t	sum;
+};
+
+inline void waitABit(size_t& tries)
+{
+	if (++tries < CONCURRENT_QUEUE_SPINS)
+		ft::cpu_relax();
+	else
+		sched_yield();
+}
+
+template <class Queue>
+void* produce(void* arg)
+{
+	Stage<Queue>* stage = static_cast<Stage<Queue>*>(arg);
+
+	for (size_t val = stage->begin, tries = 0; val < stage->end; )
+	{
+		if (stage->queue->try_push(val))
+		{
+			++val;
+			tries = 0;
+		}
+		else
+			waitABit(tries);
+	}
+	return (NULL);
+}
+
+template <class Queue>
+void* consume(void* arg)
+{
+	Stage<Queue>* stage = static_cast<Stage<Queue>*>(arg);
+	size_t val;
+
+	for (size_t left = stage->end - stage->begin, tries = 0; left != 0; )
+	{
+		if (stage->queue->try_pop(val))
+		{
+			stage->sum += val;
+			--left;
+			tries = 0;
+		}
+		else
+			waitABit(tries);
+	}
+	return (NULL);
+}
+
+void* produceBatches(void* arg)
+{
+	Stage<ft::concurrent_queue<size_t> >* stage = static_cast<Stage<ft::concurrent_queue<size_t> >*>(arg);
+	size_t values[BATCH];
+
+	for (size_t val = stage->begin, tries = 0; val < stage->end; )
+	{
+		const size_t n = std::min(stage->end - val, (size_t)BATCH);
+		for (size_t i = 0; i < n; ++i)
+			values[i] = val + i;
+
+		const size_t pushed = stage->queue->try_push_n(values, n);
+		val += pushed;
+		if (pushed != 0)
+			tries = 0;
+		else
+			waitABit(tries);
+	}
+	return (NULL);
+}
+
+void* consumeBatches(void* arg)
+{
+	Stage<ft::concurrent_queue<size_t> >* stage = static_cast<Stage<ft::concurrent_queue<size_t> >*>(arg);
+	size_t values[BATCH];
+
+	for (size_t left = stage->end - stage->begin, tries = 0; left != 0; )
+	{
+		const size_t popped = stage->queue->try_pop_n(values, std::min(left, (size_t)BATCH));
+		for (size_t i = 0; i < popped; ++i)
+			stage->sum += values[i];
+		left -= popped;
+		if (popped != 0)
+			tries = 0;
+		else
+			waitABit(tries);
+	}
+	return (NULL);
+}
+
+// Runs pairs producers and as many consumers on n values, returns false if some got lost
+template <class Queue>
+bool run(const std::string& name, Queue& queue, size_t n, size_t pairs, void* (*producer)(void*), void* (*consumer)(void*))
+{
+	Stage<Queue> stages[64];
+	pthread_t threads[64];
+	const size_t expected = n * (n - 1) / 2;
+	size_t sum = 0;
+
+	for (size_t i = 0; i < pairs; ++i)
+	{
+		stages[i].queue = &queue;
+		stages[i].begin = n / pairs * i;
+		stages[i].end = (i + 1 == pairs) ? n : n / pairs * (i + 1);
+		stages[i].sum = 0;
+		stages[pairs + i] = stages[i];
+	}
+
+	bench::Timer timer;
+	for (size_t i = 0; i < pairs; ++i)
+	{
+		pthread_create(&threads[i], NULL, producer, &stages[i]);
+		pthread_create(&threads[pairs + i], NULL, consumer, &stages[pairs + i]);
+	}
+	for (size_t i = 0; i < pairs * 2; ++i)
+		pthread_join(threads[i], NULL);
+	bench::report(name, n, timer.elapsed());
+
+	for (size_t i = 0; i < pairs; ++i)
+		sum += stages[pairs + i].sum;
+	if (sum != expected)
+		std::cout << "Error: popped values add up to " << sum << " instead of " << expected << std::endl;
+	return (sum == expected);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 1000000;
+	const size_t maxThreads = std::min((argc > 2) ? bench::parseCount(argv[2]) : 32, (size_t)64);
+	bool ok = true;
+
+	std::cout << "capacity: " << QUEUE_CAPACITY << ", batches of " << BATCH
+			  << ", online CPUs: " << ft::parallel_concurrency() << std::endl;
+	for (size_t threads = 2; threads <= maxThreads; threads *= 2)
+	{
+		std::ostringstream title;
+		title << threads / 2 << " producers, " << threads / 2 << " consumers";
+		bench::header(title.str());
+
+		LockedQueue locked;
+		ft::concurrent_queue<size_t> queue(QUEUE_CAPACITY);
+
+		ok &= run("mutex + std::queue", locked, n, threads / 2, &produce<LockedQueue>, &consume<LockedQueue>);
+		ok &= run("concurrent_queue", queue, n, threads / 2,
+				  &produce<ft::concurrent_queue<size_t> >, &consume<ft::concurrent_queue<size_t> >);
+		ok &= run("concurrent_queue, batches", queue, n, threads / 2, &produceBatches, &consumeBatches);
+	}
+	return (ok ? 0 : 1);
+}
@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:18 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <sstream>
+
+#include "concurrent_skiplist_map.hpp"
+#include "sharded_map.hpp"
+
+/* Ordered map shared by many threads, each doing lookups, inserts and erases on random keys:
+   ft::map behind a global reader / writer lock vs ft::sharded_map vs ft::concurrent_skiplist_map.
+   ./run.sh concurrent_skiplist_map [operations] [keys] [max threads] [writes in 100]
+   (default 2M operations on 100K keys, up to 64 threads, 20% writes: half inserts, half erases) */
+
+// Same interface for the three of them: insert / erase / find returning whether something happened
+class LockedMap
+{
+	private:
+		mutable pthread_rwlock_t	_lock;
+		ft::map<size_t, size_t>		_map;
+
+	public:
+		LockedMap() { pthread_rwlock_init(&this->_lock, NULL); }
+		~LockedMap() { pthread_rwlock_destroy(&this->_lock); }
+
+		bool insert(size_t k)
+		{
+			pthread_rwlock_wrlock(&this->_lock);
+			const bool inserted = this->_map.insert(ft::make_pair(k, k * 2)).second;
+			pthread_rwlock_unlock(&this->_lock);
+			return (inserted);
+		}
+
+		bool erase(size_t k)
+		{
+			pthread_rwlock_wrlock(&this->_lock);
+			const bool erased = (this->_map.erase(k) != 0);
+			pthread_rwlock_unlock(&this->_lock);
+			return (erased);
+		}
+
+		bool find(size_t k) const
+		{
+			pthread_rwlock_rdlock(&this->_lock);
+			ft::map<size_t, size_t>::const_iterator it = this->_map.find(k);
+			const bool found = (it != this->_map.end() && it->second == k * 2);
+			pthread_rwlock_unlock(&this->_lock);
+			return (found);
+		}
+
+		size_t size() const { return (this->_map.size()); }
+};
+
+class ShardedMap
+{
+	private:
+		ft::sharded_map<size_t, size_t> _map;
+
+	public:
+		bool insert(size_t k) { return (this->_map.insert(ft::make_pair(k, k * 2))); }
+		bool erase(size_t k) { return (this->_map.erase(k) != 0); }
+
+		bool find(size_t k) const
+		{
+			size_t v;
+			return (this->_map.find(k, v) && v == k * 2);
+		}
+
+		size_t size() const { return (this->_map.size()); }
+};
+
+class SkiplistMap
+{
+	private:
+		ft::concurrent_skiplist_map<size_t, size_t> _map;
+
+	public:
+		bool insert(size_t k) { return (this->_map.insert(ft::make_pair(k, k * 2)).second); }
+		bool erase(size_t k) { return (this->_map.erase(k) != 0); }
+
+		bool find(size_t k) const
+		{
+			ft::concurrent_skiplist_map<size_t, size_t>::const_iterator it = this->_map.find(k);
+			return (it != this->_map.end() && it->second == k * 2);
+		}
+
+		size_t size() const { return (this->_map.size()); }
+};
+
+template <class Map>
+struct Client
+{
+	Map*	map;
+	size_t	ops;
+	size_t	keys;
+	size_t	writes; // In 100
+	size_t	seed;
+	long	added; // Inserted - erased
+
+	static void* run(void* arg)
+	{
+		Client* self = static_cast<Client*>(arg);
+
+		for (size_t i = 0; i < self->ops; ++i)
+		{
+			self->seed = self->seed * 6364136223846793005ULL + 1442695040888963407ULL;
+			const size_t key = (self->seed >> 33) % self->keys;
+			const size_t dice = (self->seed >> 20) % 100;
+
+			if (dice < self->writes / 2)
+				self->added += self->map->insert(key);
+			else if (dice < self->writes)
+				self->added -= self->map->erase(key);
+			else
+				bench::doNotOptimize(self->map->find(key));
+		}
+		return (NULL);
+	}
+};
+
+// Half the keys are there from the start, the map must end with as many as were added
+template <class Map>
+bool run(const std::string& name, size_t ops, size_t keys, size_t threads, size_t writes)
+{
+	Map map;
+	Client<Map> clients[64];
+	pthread_t ids[64];
+	long expected = 0;
+
+	for (size_t k = 0; k < keys; k += 2)
+		expected += map.insert(k);
+	for (size_t i = 0; i < threads; ++i)
+	{
+		clients[i].map = &map;
+		clients[i].ops = ops / threads;
+		clients[i].keys = keys;
+		clients[i].writes = writes;
+		clients[i].seed = i * 7919 + 1;
+		clients[i].added = 0;
+	}
+
+	bench::Timer timer;
+	for (size_t i = 0; i < threads; ++i)
+		pthread_create(&ids[i], NULL, &Client<Map>::run, &clients[i]);
+	for (size_t i = 0; i < threads; ++i)
+		pthread_join(ids[i], NULL);
+	bench::report(name, ops / threads * threads, timer.elapsed());
+
+	for (size_t i = 0; i < threads; ++i)
+		expected += clients[i].added;
+	if (static_cast<long>(map.size()) != expected)
+		std::cout << "Error: " << map.size() << " elements left instead of " << expected << std::endl;
+	return (static_cast<long>(map.size()) == expected);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t ops = (argc > 1) ? bench::parseCount(argv[1]) : 2000000;
+	const size_t keys = (argc > 2) ? bench::parseCount(argv[2]) : 100000;
+	const size_t maxThreads = std::min((argc > 3) ? bench::parseCount(argv[3]) : 64, (size_t)64);
+	const size_t writes = std::min((argc > 4) ? bench::parseCount(argv[4]) : 20, (size_t)100);
+	bool ok = true;
+
+	std::cout << keys << " keys, " << writes << "% writes, online CPUs: " << ft::parallel_concurrency() << std::endl;
+	for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		std::ostringstream title;
+		title << threads << " threads";
+		bench::header(title.str());
+
+		ok &= run<LockedMap>("ft::map + global rwlock", ops, keys, threads, writes);
+		ok &= run<ShardedMap>("sharded_map", ops, keys, threads, writes);
+		ok &= run<SkiplistMap>("concurrent_skiplist_map", ops, keys, threads, writes);
+	}
+	return (ok ? 0 : 1);
+}
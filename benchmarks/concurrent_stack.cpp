@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:09 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <sstream>
+
+#include "concurrent_stack.hpp"
+#include "stack.hpp"
+
+/* A work stack shared by all threads, each one pushing then popping a value in a loop:
+   ft::stack behind a mutex vs ft::concurrent_stack, without and with the elimination array.
+   ./run.sh concurrent_stack [operations] [max threads] (default 1M push + pop, up to 32 threads) */
+
+// What the work stacks were before
+class LockedStack
+{
+	private:
+		pthread_mutex_t		_mutex;
+		ft::stack<size_t>	_stack;
+
+	public:
+		explicit LockedStack(bool) { pthread_mutex_init(&this->_mutex, NULL); }
+		~LockedStack() { pthread_mutex_destroy(&this->_mutex); }
+
+		void push(size_t val)
+		{
+			pthread_mutex_lock(&this->_mutex);
+			this->_stack.push(val);
+			pthread_mutex_unlock(&this->_mutex);
+		}
+
+		bool try_pop(size_t& val)
+		{
+			pthread_mutex_lock(&this->_mutex);
+			const bool found = !this->_stack.empty();
+			if (found)
+			{
+				val = this->_stack.top();
+				this->_stack.pop();
+			}
+			pthread_mutex_unlock(&this->_mutex);
+			return (found);
+		}
+};
+
+template <class Stack>
+struct Worker
+{
+	Stack*	stack;
+	size_t	begin;
+	size_t	end;
+	size_t	popped; // Sum of the values popped
+
+	// Pushes its values one by one, popping one (anyone's) after each
+	static void* run(void* arg)
+	{
+		Worker* self = static_cast<Worker*>(arg);
+		size_t val;
+
+		for (size_t i = self->begin; i < self->end; ++i)
+		{
+			self->stack->push(i);
+			if (self->stack->try_pop(val))
+				self->popped += val;
+		}
+		return (NULL);
+	}
+};
+
+// Values are 0 .. n - 1, what wasn't popped by the workers must still be in the stack
+template <class Stack>
+bool run(const std::string& name, size_t n, size_t threads, bool elimination)
+{
+	Stack stack(elimination);
+	Worker<Stack> workers[64];
+	pthread_t ids[64];
+	size_t sum = 0;
+	size_t val;
+
+	for (size_t i = 0; i < threads; ++i)
+	{
+		workers[i].stack = &stack;
+		workers[i].begin = n / threads * i;
+		workers[i].end = (i + 1 == threads) ? n : n / threads * (i + 1);
+		workers[i].popped = 0;
+	}
+
+	bench::Timer timer;
+	for (size_t i = 0; i < threads; ++i)
+		pthread_create(&ids[i], NULL, &Worker<Stack>::run, &workers[i]);
+	for (size_t i = 0; i < threads; ++i)
+		pthread_join(ids[i], NULL);
+	bench::report(name, n, timer.elapsed());
+
+	for (size_t i = 0; i < threads; ++i)
+		sum += workers[i].popped;
+	while (stack.try_pop(val))
+		sum += val;
+	if (sum != n * (n - 1) / 2)
+		std::cout << "Error: values add up to " << sum << " instead of " << n * (n - 1) / 2 << std::endl;
+	return (sum == n * (n - 1) / 2);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 1000000;
+	const size_t maxThreads = std::min((argc > 2) ? bench::parseCount(argv[2]) : 32, (size_t)64);
+	bool ok = true;
+
+	std::cout << "online CPUs: " << ft::parallel_concurrency() << std::endl;
+	for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		std::ostringstream title;
+		title << threads << " threads, push + pop";
+		bench::header(title.str());
+
+		ok &= run<LockedStack>("mutex + ft::stack", n, threads, false);
+		ok &= run<ft::concurrent_stack<size_t> >("concurrent_stack", n, threads, false);
+		ok &= run<ft::concurrent_stack<size_t> >("concurrent_stack, elimination", n, threads, true);
+	}
+	return (ok ? 0 : 1);
+}
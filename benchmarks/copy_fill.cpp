@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:38 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <string>
+
+#include "algorithm.hpp"
+#include "memory.hpp"
+#include "vector.hpp"
+#include "map.hpp"
+
+/* ft::copy / fill / uninitialized_copy element by element loops vs the dispatched versions,
+   per type category: trivially copyable (char, int, POD struct) which take the memcpy / memset
+   path, and std::string which stays on the exception safe loops. The container part shows
+   what vector / map copies and resizes gained from it */
+
+#define REPEAT 10
+
+struct Point
+{
+	int		x;
+	int		y;
+	double	z;
+
+	Point(): x(0), y(0), z(0) {}
+	Point(int v): x(v), y(v), z(v) {}
+	bool operator==(const Point& rhs) const { return (x == rhs.x && y == rhs.y && z == rhs.z); }
+};
+
+template <class T>
+void scalarCopy(const T* first, const T* last, T* result)
+{
+	for (; first != last; ++first, ++result)
+		*result = *first;
+}
+
+template <class T>
+void scalarFill(T* first, T* last, const T& val)
+{
+	for (; first != last; ++first)
+		*first = val;
+}
+
+template <class T>
+void benchAlgorithms(const std::string& name, size_t n, const T& val)
+{
+	ft::vector<T> src(n, val);
+	ft::vector<T> dst(n);
+	std::allocator<T> alloc;
+
+	bench::Timer timer;
+	for (int i = 0; i < REPEAT; ++i)
+		scalarCopy(&src[0], &src[0] + n, &dst[0]);
+	bench::report(name + " copy scalar loop", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+		ft::copy(src.begin(), src.end(), dst.begin());
+	bench::report(name + " ft::copy", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+		scalarFill(&dst[0], &dst[0] + n, val);
+	bench::report(name + " fill scalar loop", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+		ft::fill(dst.begin(), dst.end(), val);
+	bench::report(name + " ft::fill", n * REPEAT, timer.elapsed());
+
+	T* raw = alloc.allocate(n);
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		ft::uninitialized_copy(src.begin(), src.end(), raw);
+		ft::destroy(raw, raw + n);
+	}
+	bench::report(name + " uninitialized_copy", n * REPEAT, timer.elapsed());
+	alloc.deallocate(raw, n);
+
+	if (!(dst == src))
+		std::cout << "Error: wrong " << name << " copy / fill result" << std::endl;
+	bench::doNotOptimize(dst[n / 2]);
+}
+
+template <class T>
+void benchContainers(const std::string& name, size_t n, const T& val)
+{
+	ft::vector<T> src(n, val);
+
+	bench::Timer timer;
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		ft::vector<T> copy(src);
+		bench::doNotOptimize(copy[n - 1]);
+	}
+	bench::report(name + " vector copy constructor", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		ft::vector<T> vec;
+		vec.resize(n, val);
+		vec.reserve(n * 2);
+		bench::doNotOptimize(vec[n - 1]);
+	}
+	bench::report(name + " vector resize + reserve", n * REPEAT, timer.elapsed());
+}
+
+void benchMap(size_t n)
+{
+	ft::map<int, int> src;
+	for (size_t i = 0; i < n; ++i)
+		src[static_cast<int>(i)] = static_cast<int>(i);
+
+	bench::Timer timer;
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		ft::map<int, int> copy(src);
+		bench::doNotOptimize(copy.size());
+		if (copy.size() != n || copy.begin()->first != 0 || (--copy.end())->first != static_cast<int>(n - 1))
+			std::cout << "Error: wrong map copy" << std::endl;
+	}
+	bench::report("map<int, int> copy constructor", n * REPEAT, timer.elapsed());
+}
+
+int main(int argc, char** argv)
+{
+	const size_t max = (argc > 1) ? bench::parseCount(argv[1]) : 10000000;
+
+	bench::header("copy / fill algorithms");
+	for (size_t n = 100000; n <= max; n *= 10)
+	{
+		benchAlgorithms<char>("char", n, 'a');
+		benchAlgorithms<int>("int", n, 42);
+		benchAlgorithms<Point>("Point", n, Point(42));
+		benchAlgorithms<std::string>("std::string", n / 10, std::string("a string longer than SSO"));
+	}
+
+	bench::header("containers");
+	for (size_t n = 100000; n <= max; n *= 10)
+	{
+		benchContainers<int>("int", n, 42);
+		benchContainers<Point>("Point", n, Point(42));
+		benchContainers<std::string>("std::string", n / 10, std::string("a string longer than SSO"));
+		benchMap(n / 10);
+	}
+	return (0);
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:26 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include "external_sort.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+
+/* Sorts a file bigger than the memory budget: ./run.sh external_sort [file size] [budget] [dir]
+   Defaults to a 16 GiB file with a 1 GiB budget in /tmp, needs twice the file size of free disk */
+
+struct Record
+{
+	unsigned long long	key;
+	char				payload[56];
+};
+
+struct RecordLess
+{
+	bool operator()(const Record& lhs, const Record& rhs) const { return (lhs.key < rhs.key); }
+};
+
+static unsigned long long xorshift(unsigned long long& state)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return (state);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t fileSize = (argc > 1) ? bench::parseBytes(argv[1]) : bench::parseBytes("16G");
+	const size_t budget = (argc > 2) ? bench::parseBytes(argv[2]) : bench::parseBytes("1G");
+	const std::string dir = (argc > 3) ? argv[3] : "/tmp";
+	const std::string inPath = dir + "/ft_external_sort_in";
+	const std::string outPath = dir + "/ft_external_sort_out";
+	const size_t count = fileSize / sizeof(Record);
+
+	bench::header("external_sort");
+
+	/***** Generate *****/
+	int in = open(inPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	int out = open(outPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (in < 0 || out < 0)
+	{
+		std::cerr << "Cannot create files in " << dir << std::endl;
+		return (1);
+	}
+
+	bench::Timer timer;
+	{
+		ft::vector<Record> block(bench::parseBytes("4M") / sizeof(Record));
+		unsigned long long state = 42;
+		for (size_t done = 0; done < count; done += block.size())
+		{
+			size_t n = (count - done < block.size()) ? count - done : block.size();
+			for (size_t i = 0; i < n; ++i)
+				block[i].key = xorshift(state);
+			ft::write_full(in, &block[0], n * sizeof(Record));
+		}
+	}
+	bench::reportBytes("generate", count * sizeof(Record), timer.elapsed());
+
+	/***** Sort *****/
+	lseek(in, 0, SEEK_SET);
+	timer.reset();
+	ft::external_sort<Record>(in, out, budget, RecordLess(), dir.c_str());
+	bench::reportBytes("external_sort", count * sizeof(Record), timer.elapsed());
+
+	/***** Check *****/
+	lseek(out, 0, SEEK_SET);
+	timer.reset();
+	{
+		ft::vector<Record> block(bench::parseBytes("4M") / sizeof(Record));
+		unsigned long long previous = 0;
+		size_t total = 0;
+		size_t n;
+		while ((n = ft::read_full(out, &block[0], block.size() * sizeof(Record)) / sizeof(Record)) > 0)
+		{
+			for (size_t i = 0; i < n; ++i)
+			{
+				if (block[i].key < previous)
+					std::cout << "Error: output is not sorted at record " << total + i << std::endl;
+				previous = block[i].key;
+			}
+			total += n;
+		}
+		if (total != count)
+			std::cout << "Error: " << total << " records written instead of " << count << std::endl;
+	}
+	bench::reportBytes("sequential check", count * sizeof(Record), timer.elapsed());
+
+	close(in);
+	close(out);
+	unlink(inPath.c_str());
+	unlink(outPath.c_str());
+	return (0);
+}
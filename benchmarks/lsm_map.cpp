@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:27 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+
+#include "lsm_map.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+/* Write heavy ingestion: random keys written to an ft::map vs an ft::lsm_map (writes per second and
+   write amplification, records written to runs per write), then lookups (half hits) with the read
+   amplification (binary searches in runs per lookup, with and without the Bloom filters), the
+   same once compacted into a single run, and a full ordered scan.
+   ./run.sh lsm_map [writes] (default 2M, keys drawn among as many) */
+
+typedef ft::lsm_map<int, long> lsm_type;
+
+struct Sum
+{
+	unsigned long sum;
+	size_t n;
+
+	Sum() : sum(0), n(0) { }
+	void operator()(const ft::pair<const int, long>& val) { this->sum += val.first + val.second; ++this->n; }
+};
+
+void reportAmplification(const lsm_type& lsm)
+{
+	const ft::lsm_stats s = lsm.stats();
+
+	std::cout << "runs: " << s.runs << ", runs per lookup: " << std::fixed << std::setprecision(2)
+			  << (double)(s.runs_searched + s.runs_filtered) / std::max(s.lookups, (size_t)1)
+			  << " without filters, " << (double)s.runs_searched / std::max(s.lookups, (size_t)1) << " searched" << std::endl;
+}
+
+// Looks every probe up in the map and the lsm_map, false if they disagree
+bool lookups(const ft::map<int, long>& map, lsm_type& lsm, const ft::vector<int>& probes, const std::string& name)
+{
+	size_t hitsMap = 0, hitsLsm = 0;
+	long sumMap = 0, sumLsm = 0;
+	long value = 0;
+
+	bench::Timer timer;
+	for (size_t i = 0; i < probes.size(); ++i)
+	{
+		ft::map<int, long>::const_iterator it = map.find(probes[i]);
+		if (it != map.end())
+		{
+			++hitsMap;
+			sumMap += it->second;
+		}
+	}
+	bench::report("ft::map find", probes.size(), timer.elapsed());
+
+	lsm.reset_stats();
+	timer.reset();
+	for (size_t i = 0; i < probes.size(); ++i)
+		if (lsm.find(probes[i], value))
+		{
+			++hitsLsm;
+			sumLsm += value;
+		}
+	bench::report(name, probes.size(), timer.elapsed());
+	reportAmplification(lsm);
+	return (hitsMap == hitsLsm && sumMap == sumLsm);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 2000000;
+	const size_t queries = 1000000;
+	bool ok = true;
+
+	srand(42);
+	ft::vector<int> keys(n);
+	for (size_t i = 0; i < n; ++i)
+		keys[i] = rand() % (int)n;
+	ft::vector<int> probes(queries);
+	for (size_t i = 0; i < queries; ++i)
+		probes[i] = (i % 2) ? keys[rand() % n] : (int)n + rand() % (int)n;
+
+	ft::map<int, long> map;
+	lsm_type lsm;
+
+	bench::header("random writes");
+	bench::Timer timer;
+	for (size_t i = 0; i < n; ++i)
+		map[keys[i]] = (long)i;
+	bench::report("ft::map operator[]", n, timer.elapsed());
+
+	timer.reset();
+	for (size_t i = 0; i < n; ++i)
+		lsm.insert_or_assign(keys[i], (long)i);
+	bench::report("lsm_map insert_or_assign", n, timer.elapsed());
+	const ft::lsm_stats writes = lsm.stats();
+	std::cout << "write amplification: " << std::fixed << std::setprecision(2)
+			  << (double)writes.records_written / writes.writes << " records written per write" << std::endl;
+
+	bench::header("lookups, half hits");
+	ok = lookups(map, lsm, probes, "lsm_map find") && ok;
+
+	timer.reset();
+	lsm.compact();
+	std::cout << "compact: " << std::fixed << std::setprecision(2) << timer.elapsed() * 1000 << " ms" << std::endl;
+	bench::header("lookups, half hits, compacted");
+	ok = lookups(map, lsm, probes, "lsm_map find") && ok;
+
+	bench::header("full ordered scan");
+	Sum sumMap, sumLsm;
+	timer.reset();
+	for (ft::map<int, long>::const_iterator it = map.begin(); it != map.end(); ++it)
+		sumMap(*it);
+	bench::report("ft::map iteration", sumMap.n, timer.elapsed());
+
+	timer.reset();
+	sumLsm = lsm.for_each(sumLsm);
+	bench::report("lsm_map for_each", sumLsm.n, timer.elapsed());
+	ok = (sumMap.n == sumLsm.n && sumMap.sum == sumLsm.sum) && ok;
+
+	if (!ok)
+	{
+		std::cout << "Error: lsm_map and ft::map disagree" << std::endl;
+		return (1);
+	}
+	return (0);
+}
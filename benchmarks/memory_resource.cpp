@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:46 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+
+#include "map.hpp"
+#include "memory_resource.hpp"
+#include "vector.hpp"
+
+/* Same containers (one type: ft::polymorphic_allocator), memory from each resource:
+   building then destroying a map, many small vectors, insert / erase churn in a map.
+   std::allocator containers as the baseline. The monotonic resource is released between rounds.
+   ./run.sh memory_resource [elements] (default 200k) */
+
+#define ROUNDS 5
+#define SMALL_VECTOR_SIZE 16
+
+typedef ft::pair<const int, int> value_type;
+typedef ft::map<int, int, std::less<int>, ft::polymorphic_allocator<value_type> > pmr_map;
+typedef ft::vector<int, ft::polymorphic_allocator<int> > pmr_vector;
+
+// Allocator of the containers, from resource (ignored by std::allocator)
+template <class Allocator>
+Allocator makeAllocator(ft::memory_resource*) { return (Allocator()); }
+
+template <>
+ft::polymorphic_allocator<value_type> makeAllocator(ft::memory_resource* resource) { return (resource); }
+
+template <>
+ft::polymorphic_allocator<int> makeAllocator(ft::memory_resource* resource) { return (resource); }
+
+template <class Map>
+size_t buildMap(ft::memory_resource* resource, const ft::vector<int>& keys)
+{
+	Map m(std::less<int>(), makeAllocator<typename Map::allocator_type>(resource));
+
+	for (size_t i = 0; i < keys.size(); ++i)
+		m.insert(ft::make_pair(keys[i], (int)i));
+	return (m.size());
+}
+
+template <class Vector>
+size_t smallVectors(ft::memory_resource* resource, size_t n)
+{
+	size_t sum = 0;
+
+	for (size_t i = 0; i < n / SMALL_VECTOR_SIZE; ++i)
+	{
+		Vector v(makeAllocator<typename Vector::allocator_type>(resource));
+		for (size_t j = 0; j < SMALL_VECTOR_SIZE; ++j)
+			v.push_back((int)j);
+		sum += v.size();
+	}
+	return (sum);
+}
+
+template <class Map>
+size_t churn(ft::memory_resource* resource, const ft::vector<int>& keys)
+{
+	Map m(std::less<int>(), makeAllocator<typename Map::allocator_type>(resource));
+	const size_t window = std::min(keys.size(), (size_t)4096);
+
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		m.insert(ft::make_pair(keys[i], (int)i));
+		if (i >= window)
+			m.erase(keys[i - window]);
+	}
+	return (m.size());
+}
+
+template <class Map, class Vector>
+bool runAll(const std::string& name, ft::memory_resource* resource, ft::monotonic_buffer_resource* monotonic,
+			const ft::vector<int>& keys, size_t expectedMap, size_t expectedChurn)
+{
+	const size_t n = keys.size();
+	bool ok = true;
+
+	bench::Timer timer;
+	for (int r = 0; r < ROUNDS; ++r)
+	{
+		ok = ok && (buildMap<Map>(resource, keys) == expectedMap);
+		if (monotonic != NULL)
+			monotonic->release();
+	}
+	bench::report(name + " map build", n * ROUNDS, timer.elapsed());
+
+	timer.reset();
+	for (int r = 0; r < ROUNDS; ++r)
+	{
+		ok = ok && (smallVectors<Vector>(resource, n) == n / SMALL_VECTOR_SIZE * SMALL_VECTOR_SIZE);
+		if (monotonic != NULL)
+			monotonic->release();
+	}
+	bench::report(name + " small vectors", n * ROUNDS, timer.elapsed());
+
+	timer.reset();
+	for (int r = 0; r < ROUNDS; ++r)
+	{
+		ok = ok && (churn<Map>(resource, keys) == expectedChurn);
+		if (monotonic != NULL)
+			monotonic->release();
+	}
+	bench::report(name + " map churn", n * ROUNDS, timer.elapsed());
+	return (ok);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 200000;
+
+	// Distinct keys in random order
+	ft::vector<int> keys(n);
+	for (size_t i = 0; i < n; ++i)
+		keys[i] = (int)i;
+	srand(42);
+	for (size_t i = n; i > 1; --i)
+		std::swap(keys[i - 1], keys[rand() % i]);
+	const size_t expectedChurn = std::min(n, (size_t)4096);
+
+	typedef ft::map<int, int> std_map;
+	typedef ft::vector<int> std_vector;
+
+	bool ok = true;
+	bench::header("memory resources");
+	ok = runAll<std_map, std_vector>("std::allocator", NULL, NULL, keys, n, expectedChurn) && ok;
+	ok = runAll<pmr_map, pmr_vector>("new_delete", ft::new_delete_resource(), NULL, keys, n, expectedChurn) && ok;
+	{
+		ft::monotonic_buffer_resource monotonic;
+		ok = runAll<pmr_map, pmr_vector>("monotonic", &monotonic, &monotonic, keys, n, expectedChurn) && ok;
+	}
+	{
+		ft::unsynchronized_pool_resource pool;
+		ok = runAll<pmr_map, pmr_vector>("unsync pool", &pool, NULL, keys, n, expectedChurn) && ok;
+	}
+	{
+		ft::synchronized_pool_resource pool;
+		ok = runAll<pmr_map, pmr_vector>("sync pool", &pool, NULL, keys, n, expectedChurn) && ok;
+	}
+
+	if (!ok)
+	{
+		std::cout << "Error: wrong container sizes" << std::endl;
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:57 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "external_sort.hpp"
+#include "mmap_vector.hpp"
+#include "vector.hpp"
+
+/* Records persisted then loaded again: a raw file read (and so copied) into an ft::vector vs an
+   mmap_vector opened on its file. Files are in the page cache (just written), as for a restart
+   of a service whose data is hot; from disk, both wait for the same reads but mmap_vector only
+   for the pages it touches. ./run.sh mmap_vector [records] [directory] (default 4M, /tmp) */
+
+struct Record
+{
+	long	id;
+	double	price;
+	int		quantity;
+	int		flags;
+	long	timestamp;
+};
+
+long scan(const Record* records, size_t n)
+{
+	long sum = 0;
+
+	for (size_t i = 0; i < n; ++i)
+		sum += records[i].id + records[i].quantity;
+	return (sum);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 4000000;
+	const std::string directory = (argc > 2) ? argv[2] : "/tmp";
+	const std::string rawPath = directory + "/ft_mmap_vector_bench.raw";
+	const std::string mappedPath = directory + "/ft_mmap_vector_bench.mmap";
+	const size_t bytes = n * sizeof(Record);
+	bool ok = true;
+
+	ft::vector<Record> records(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		records[i].id = (long)i;
+		records[i].price = i * 0.25;
+		records[i].quantity = (int)(i % 100);
+		records[i].flags = 0;
+		records[i].timestamp = (long)i * 1000;
+	}
+	const long expected = scan(&records[0], n);
+	std::remove(rawPath.c_str());
+	std::remove(mappedPath.c_str());
+
+	bench::header("saving");
+	bench::Timer timer;
+	{
+		int fd = open(rawPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0)
+			ft::external_sort_error("open " + rawPath);
+		ft::write_full(fd, &records[0], bytes);
+		close(fd);
+	}
+	bench::reportBytes("write() raw file", bytes, timer.elapsed());
+
+	timer.reset();
+	{
+		ft::mmap_vector<Record> mapped(mappedPath);
+		mapped.append(&records[0], n);
+	}
+	bench::reportBytes("mmap_vector append", bytes, timer.elapsed());
+
+	timer.reset();
+	{
+		ft::mmap_vector<Record> mapped(mappedPath);
+		mapped.flush();
+	}
+	bench::reportBytes("mmap_vector flush (msync)", bytes, timer.elapsed());
+
+	bench::header("loading then scanning every record");
+	timer.reset();
+	{
+		int fd = open(rawPath.c_str(), O_RDONLY);
+		if (fd < 0)
+			ft::external_sort_error("open " + rawPath);
+		ft::vector<Record> loaded(n);
+		ok = (ft::read_full(fd, &loaded[0], bytes) == bytes) && ok;
+		close(fd);
+		ok = (scan(&loaded[0], n) == expected) && ok;
+	}
+	bench::reportBytes("read() into ft::vector", bytes, timer.elapsed());
+
+	timer.reset();
+	{
+		ft::mmap_vector<Record> mapped(mappedPath);
+		ok = (mapped.size() == n && scan(mapped.data(), n) == expected) && ok;
+	}
+	bench::reportBytes("mmap_vector open", bytes, timer.elapsed());
+
+	bench::header("loading then reading 1000 records");
+	const size_t sample = 1000;
+	timer.reset();
+	{
+		int fd = open(rawPath.c_str(), O_RDONLY);
+		if (fd < 0)
+			ft::external_sort_error("open " + rawPath);
+		ft::vector<Record> loaded(n);
+		ok = (ft::read_full(fd, &loaded[0], bytes) == bytes) && ok;
+		close(fd);
+		for (size_t i = 0; i < sample; ++i)
+			ok = (loaded[i * (n / sample)].id == (long)(i * (n / sample))) && ok;
+	}
+	bench::report("read() into ft::vector", sample, timer.elapsed());
+
+	timer.reset();
+	{
+		ft::mmap_vector<Record> mapped(mappedPath);
+		for (size_t i = 0; i < sample; ++i)
+			ok = (mapped[i * (n / sample)].id == (long)(i * (n / sample))) && ok;
+	}
+	bench::report("mmap_vector open", sample, timer.elapsed());
+
+	// Read only access goes through const_iterator
+	{
+		ft::mmap_vector<Record> mapped(mappedPath);
+		const ft::mmap_vector<Record>& view = mapped;
+		long sum = 0;
+
+		for (ft::mmap_vector<Record>::const_iterator it = view.begin(); it != view.end(); ++it)
+			sum += it->id + it->quantity;
+		ok = (sum == expected) && ok;
+	}
+
+	std::remove(rawPath.c_str());
+	std::remove(mappedPath.c_str());
+	if (!ok)
+	{
+		std::cout << "Error: records read back differ" << std::endl;
+		return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:58 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <sstream>
+
+#include "parallel.hpp"
+#include "vector.hpp"
+
+/* GB/s of building / filling / generating / transforming a big vector of doubles
+   with 1, 2, 4... threads. Construction includes the page faults of the fresh buffer,
+   the other ones write memory which is already mapped.
+   ./run.sh parallel_fill [bytes] [max threads] (default 1G, twice the online CPUs) */
+
+struct Ramp
+{
+	double value;
+
+	Ramp() : value(0) { }
+	double operator()() { return (this->value += 0.5); }
+};
+
+struct Scale
+{
+	double operator()(double x) const { return (x * 3.0 + 1.0); }
+};
+
+void benchThreads(size_t n, size_t threads)
+{
+	std::ostringstream name;
+	name << threads << (threads > 1 ? " threads " : " thread ");
+	const std::string prefix = name.str();
+	const size_t bytes = n * sizeof(double);
+
+	ft::set_parallel_concurrency(threads);
+
+	bench::Timer timer;
+	ft::vector<double> vec(ft::parallel_tag(), n, 1.0);
+	bench::reportBytes(prefix + "vector(parallel, n, v)", bytes, timer.elapsed());
+
+	timer.reset();
+	ft::parallel_fill(vec.begin(), vec.end(), 2.0);
+	bench::reportBytes(prefix + "parallel_fill", bytes, timer.elapsed());
+
+	timer.reset();
+	ft::parallel_generate(vec.begin(), vec.end(), Ramp());
+	bench::reportBytes(prefix + "parallel_generate", bytes, timer.elapsed());
+
+	// Reads one vector and writes the other one
+	ft::vector<double> out(ft::parallel_tag(), n);
+	timer.reset();
+	ft::parallel_transform(vec.begin(), vec.end(), out.begin(), Scale());
+	bench::reportBytes(prefix + "parallel_transform", bytes * 2, timer.elapsed());
+
+	if (vec[0] != 0.5 || out[n - 1] != Scale()(vec[n - 1]))
+		std::cout << "Error: wrong parallel results" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	const size_t bytes = (argc > 1) ? bench::parseBytes(argv[1]) : (size_t)1 << 30;
+	const size_t maxThreads = (argc > 2) ? bench::parseCount(argv[2]) : ft::parallel_concurrency() * 2;
+	const size_t n = bytes / sizeof(double);
+
+	std::cout << "online CPUs: " << ft::parallel_concurrency() << std::endl;
+	bench::header("sequential");
+	{
+		bench::Timer timer;
+		ft::vector<double> vec(n, 1.0);
+		bench::reportBytes("vector(n, v)", n * sizeof(double), timer.elapsed());
+		timer.reset();
+		ft::fill(vec.begin(), vec.end(), 2.0);
+		bench::reportBytes("fill", n * sizeof(double), timer.elapsed());
+	}
+
+	bench::header("parallel");
+	for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+		benchThreads(n, threads);
+	return (0);
+}
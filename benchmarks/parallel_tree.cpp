@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:25 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+
+#include "parallel_tree.hpp"
+
+/* Sum of the mapped values of a big map: iterator walk (inorderSuccessor climbing back up the
+   tree) vs parallel_reduce / parallel_for_each cutting the tree in subtrees, from 1 thread up.
+   ./run.sh parallel_tree [elements] [max threads] (default 2M, online CPUs but at least 8) */
+
+#define REPEAT 5
+
+typedef ft::map<int, long> map_type;
+
+struct AtomicAdd
+{
+	long* sum;
+
+	void operator()(const map_type::value_type& value) const { __atomic_add_fetch(this->sum, value.second, __ATOMIC_RELAXED); }
+};
+
+// Work per element, so that the walk isn't all there is to measure
+struct Heavy
+{
+	long operator()(const map_type::value_type& value) const
+	{
+		unsigned long x = value.second;
+		for (int i = 0; i < 64; ++i)
+			x = x * 6364136223846793005UL + 1442695040888963407UL;
+		return ((long)(x >> 40));
+	}
+};
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 2000000;
+	const size_t maxThreads = (argc > 2) ? bench::parseCount(argv[2]) : std::max(ft::parallel_concurrency(), (size_t)8);
+	bool ok = true;
+
+	// Random insertion order, so that neighbour keys aren't neighbour nodes in memory
+	map_type m;
+	srand(42);
+	while (m.size() < n)
+		for (size_t i = m.size(); i < n; ++i)
+			m.insert(ft::make_pair(rand(), (long)(rand() % 1000)));
+
+	std::cout << "elements: " << n << ", online CPUs: " << ft::parallel_concurrency() << std::endl;
+
+	long expected = 0;
+	long heavyExpected = 0;
+	Heavy heavy;
+	bench::header("sequential");
+	bench::Timer timer;
+	for (int r = 0; r < REPEAT; ++r)
+	{
+		expected = 0;
+		for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+			expected += it->second;
+	}
+	bench::report("iterator sum", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int r = 0; r < REPEAT; ++r)
+	{
+		heavyExpected = 0;
+		for (map_type::const_iterator it = m.begin(); it != m.end(); ++it)
+			heavyExpected += heavy(*it);
+	}
+	bench::report("iterator heavy sum", n * REPEAT, timer.elapsed());
+
+	for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		ft::set_parallel_concurrency(threads);
+		std::ostringstream title;
+		title << threads << " thread" << (threads > 1 ? "s" : "");
+		bench::header(title.str());
+
+		long sum = 0;
+		timer.reset();
+		for (int r = 0; r < REPEAT; ++r)
+			sum = ft::parallel_reduce(m, 0L, std::plus<long>());
+		bench::report("parallel_reduce sum", n * REPEAT, timer.elapsed());
+		ok = ok && (sum == expected);
+
+		timer.reset();
+		for (int r = 0; r < REPEAT; ++r)
+			sum = ft::parallel_reduce(m, 0L, std::plus<long>(), heavy);
+		bench::report("parallel_reduce heavy sum", n * REPEAT, timer.elapsed());
+		ok = ok && (sum == heavyExpected);
+
+		AtomicAdd add;
+		add.sum = &sum;
+		timer.reset();
+		for (int r = 0; r < REPEAT; ++r)
+		{
+			sum = 0;
+			ft::parallel_for_each(m, add);
+		}
+		bench::report("parallel_for_each atomic sum", n * REPEAT, timer.elapsed());
+		ok = ok && (sum == expected);
+	}
+
+	if (!ok)
+	{
+		std::cout << "Error: parallel sums differ from the sequential ones" << std::endl;
+		return (1);
+	}
+	return (0);
+}
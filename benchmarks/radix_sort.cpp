@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:25 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include "radix_sort.hpp"
+#include "pairs.hpp"
+#include "vector.hpp"
+
+#include <stdlib.h>
+
+/* ft::sort vs ft::radix_sort on ints, floats and pairs keyed by int,
+   from 1K up to the max size given (1G needs ~16 GiB for the pairs) */
+
+typedef ft::pair<int, int> int_pair;
+
+struct PairLess
+{
+	bool operator()(const int_pair& lhs, const int_pair& rhs) const { return (lhs.first < rhs.first); }
+};
+
+struct FloatLess
+{
+	bool operator()(float lhs, float rhs) const { return (lhs < rhs); }
+};
+
+int randomInt() { return (rand() - RAND_MAX / 2); }
+float randomFloat() { return ((rand() - RAND_MAX / 2) / 1024.0f); }
+int_pair randomPair() { return (ft::make_pair(randomInt(), rand())); }
+
+template <class Iterator, class Compare>
+bool isSorted(Iterator first, Iterator last, Compare comp)
+{
+	if (first == last)
+		return (true);
+	for (Iterator next = first + 1; next != last; ++first, ++next)
+		if (comp(*next, *first))
+			return (false);
+	return (true);
+}
+
+template <class T, class Compare, class KeyExtractor>
+void benchType(const std::string& name, size_t n, T (*generate)(), Compare comp, KeyExtractor key)
+{
+	ft::vector<T> original;
+	original.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+		original.push_back(generate());
+
+	ft::vector<T> data(original);
+	bench::Timer timer;
+	ft::sort(data.begin(), data.end(), comp);
+	bench::report(name + " ft::sort", n, timer.elapsed());
+
+	data = original;
+	timer.reset();
+	ft::radix_sort(data.begin(), data.end(), key);
+	bench::report(name + " ft::radix_sort", n, timer.elapsed());
+
+	if (!isSorted(data.begin(), data.end(), comp))
+		std::cout << "Error: " << name << " radix_sort output is not sorted" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	const size_t max = (argc > 1) ? bench::parseCount(argv[1]) : 10000000;
+
+	srand(42);
+	bench::header("radix_sort");
+	for (size_t n = 1000; n <= max; n *= 10)
+	{
+		benchType<int>("int", n, randomInt, std::less<int>(), ft::identity<int>());
+		benchType<float>("float", n, randomFloat, FloatLess(), ft::identity<float>());
+		benchType<int_pair>("pair<int, int>", n, randomPair, PairLess(), ft::select_first<int_pair>());
+	}
+	return (0);
+}
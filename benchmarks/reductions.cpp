@@ -0,0 +1,216 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:48 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+
+#include "parallel.hpp"
+#include "vector.hpp"
+
+/* sum, min / max, count and find over big vectors: plain iterator loops (what the compiler
+   gets to vectorize, or not) vs the SIMD kernels vs the parallel versions.
+   find looks for a value which is only at the end, the whole vector is scanned */
+
+/* Runs of each case. Every result goes through doNotOptimize, or a loop whose result is
+   never read (or the same every time) could be dropped or run once */
+#define REPEAT 10
+
+template <class T>
+struct ScalarLoops
+{
+	typedef typename ft::vector<T>::const_iterator iterator;
+
+	static T sum(iterator first, iterator last)
+	{
+		T sum = T();
+		for (; first != last; ++first)
+			sum = sum + *first;
+		return (sum);
+	}
+
+	static ft::pair<iterator, iterator> minmax(iterator first, iterator last)
+	{
+		iterator min = first;
+		iterator max = first;
+		while (++first != last)
+		{
+			if (*first < *min)
+				min = first;
+			else if (!(*first < *max))
+				max = first;
+		}
+		return (ft::make_pair(min, max));
+	}
+
+	static size_t count(iterator first, iterator last, const T& value)
+	{
+		size_t n = 0;
+		for (; first != last; ++first)
+			if (*first == value)
+				++n;
+		return (n);
+	}
+
+	static iterator find(iterator first, iterator last, const T& value)
+	{
+		for (; first != last; ++first)
+			if (*first == value)
+				break;
+		return (first);
+	}
+};
+
+/* Float sums of that many elements round differently depending on the order,
+   the sequential float loop is even the least accurate one (off by 66% at 100M floats), so the
+   kernels are checked against the exact sum instead. Rounding grows with the sum: a relative error
+   of 1e-4 is allowed per 10M elements (ft::reduce measured 5e-4 at 100M floats).
+   ints wrap the same way everywhere */
+template <class T>
+bool sameSum(T a, T loop, double exact, size_t n)
+{
+	if (ft::is_integral<T>::value)
+		return (a == loop);
+
+	const double diff = static_cast<double>(a) - exact;
+	const double tolerance = 1e-4 * std::max(n / 10000000.0, 1.0);
+	return ((diff < 0 ? -diff : diff) <= tolerance * (exact < 0 ? -exact : exact));
+}
+
+template <class T>
+void benchType(const std::string& name, size_t n)
+{
+	typedef ScalarLoops<T> scalar;
+	typedef typename ft::vector<T>::const_iterator iterator;
+
+	ft::vector<T> vec(n);
+	for (size_t i = 0; i < n - 1; ++i)
+		vec[i] = T(std::rand() % 1000);
+	vec[n - 1] = T(1000);
+
+	const ft::vector<T>& v = vec;
+	const double exactSum = ft::reduce(v.begin(), v.end(), 0.0);
+	T sums[3] = { T(), T(), T() };
+	size_t counts[3] = { 0, 0, 0 };
+	iterator found[3];
+	ft::pair<iterator, iterator> minmax[3];
+
+	bench::Timer timer;
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		sums[0] = scalar::sum(v.begin(), v.end());
+		bench::doNotOptimize(sums[0]);
+	}
+	bench::report(name + " sum loop", n * REPEAT, timer.elapsed());
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		sums[1] = ft::reduce(v.begin(), v.end(), T());
+		bench::doNotOptimize(sums[1]);
+	}
+	bench::report(name + " ft::reduce", n * REPEAT, timer.elapsed());
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		sums[2] = ft::parallel_reduce(v.begin(), v.end(), T());
+		bench::doNotOptimize(sums[2]);
+	}
+	bench::report(name + " ft::parallel_reduce", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		minmax[0] = scalar::minmax(v.begin(), v.end());
+		bench::doNotOptimize(minmax[0]);
+	}
+	bench::report(name + " minmax loop", n * REPEAT, timer.elapsed());
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		minmax[1] = ft::minmax_element(v.begin(), v.end());
+		bench::doNotOptimize(minmax[1]);
+	}
+	bench::report(name + " ft::minmax_element", n * REPEAT, timer.elapsed());
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		minmax[2] = ft::parallel_minmax_element(v.begin(), v.end());
+		bench::doNotOptimize(minmax[2]);
+	}
+	bench::report(name + " ft::parallel_minmax", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		counts[0] = scalar::count(v.begin(), v.end(), T(42));
+		bench::doNotOptimize(counts[0]);
+	}
+	bench::report(name + " count loop", n * REPEAT, timer.elapsed());
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		counts[1] = ft::count(v.begin(), v.end(), T(42));
+		bench::doNotOptimize(counts[1]);
+	}
+	bench::report(name + " ft::count", n * REPEAT, timer.elapsed());
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		counts[2] = ft::parallel_count(v.begin(), v.end(), T(42));
+		bench::doNotOptimize(counts[2]);
+	}
+	bench::report(name + " ft::parallel_count", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		found[0] = scalar::find(v.begin(), v.end(), T(1000));
+		bench::doNotOptimize(found[0]);
+	}
+	bench::report(name + " find loop", n * REPEAT, timer.elapsed());
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		found[1] = ft::find(v.begin(), v.end(), T(1000));
+		bench::doNotOptimize(found[1]);
+	}
+	bench::report(name + " ft::find", n * REPEAT, timer.elapsed());
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		found[2] = ft::parallel_find(v.begin(), v.end(), T(1000));
+		bench::doNotOptimize(found[2]);
+	}
+	bench::report(name + " ft::parallel_find", n * REPEAT, timer.elapsed());
+
+	for (int i = 1; i < 3; ++i)
+	{
+		if (!sameSum(sums[i], sums[0], exactSum, n) || counts[i] != counts[0] || found[i] != found[0]
+			|| minmax[i].first != minmax[0].first || minmax[i].second != minmax[0].second)
+			std::cout << "Error: wrong " << name << " result" << std::endl;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const size_t max = (argc > 1) ? bench::parseCount(argv[1]) : 100000000;
+
+	std::cout << "threads: " << ft::parallel_concurrency() << ", avx2: " << ft::cpu_has_avx2() << std::endl;
+	bench::header("reductions");
+	for (size_t n = 1000000; n <= max; n *= 10)
+	{
+		benchType<int>("int", n);
+		benchType<float>("float", n);
+		benchType<double>("double", n);
+	}
+	return (0);
+}
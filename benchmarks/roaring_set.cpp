@@ -0,0 +1,225 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:23 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+
+#include "memory_resource.hpp"
+#include "roaring_set.hpp"
+#include "set.hpp"
+#include "vector.hpp"
+
+/* ft::set<uint32_t> vs ft::roaring_set, on dense values (n values out of 1.25n: bitmap
+   containers), clustered ones (ranges of 1000 consecutive values: runs after run_optimize) and sparse
+   ones (anywhere in 2^32: arrays of a few values). Bytes per value, insert, contains (half hits),
+   a full scan, then and / or / andnot of two such sets vs merging two ft::sets.
+   The set's bytes are what its nodes asked for, malloc adds its own header to each.
+   ./run.sh roaring_set [values] (default 1M) */
+
+typedef ft::set<uint32_t, std::less<uint32_t>, ft::polymorphic_allocator<uint32_t> > value_set;
+
+// Counts the bytes in use, memory from new / delete
+class counting_resource : public ft::memory_resource
+{
+	public:
+		size_t bytes;
+
+		counting_resource() : bytes(0) { }
+
+	protected:
+		virtual void* do_allocate(size_t bytes, size_t alignment)
+		{
+			this->bytes += bytes;
+			return (ft::new_delete_resource()->allocate(bytes, alignment));
+		}
+
+		virtual void do_deallocate(void* p, size_t bytes, size_t alignment)
+		{
+			this->bytes -= bytes;
+			ft::new_delete_resource()->deallocate(p, bytes, alignment);
+		}
+
+		virtual bool do_is_equal(const ft::memory_resource& other) const { return (this == &other); }
+};
+
+enum distribution { DENSE, CLUSTERED, SPARSE };
+
+uint32_t random32() { return (((uint32_t)rand() << 16) ^ (uint32_t)rand()); }
+
+// Values are below this
+uint32_t limit(distribution kind, size_t n)
+{
+	if (kind == DENSE)
+		return (n + n / 4);
+	if (kind == CLUSTERED)
+		return (3 * n + 2000);
+	return (0xffffffffu);
+}
+
+ft::vector<uint32_t> makeValues(distribution kind, size_t n)
+{
+	ft::vector<uint32_t> values(n);
+	const uint32_t shift = random32() % 2000;
+
+	for (size_t i = 0; i < n; ++i)
+	{
+		if (kind == CLUSTERED) // Ranges of 1000 consecutive values every 3000, shifted a bit for each set
+			values[i] = (i / 1000) * 3000 + i % 1000 + shift;
+		else
+			values[i] = random32() % limit(kind, n);
+	}
+	return (values);
+}
+
+void reportMemory(const std::string& name, size_t n, size_t bytes)
+{
+	std::cout << std::left << std::setw(32) << name << std::right << std::setw(14) << n
+			  << std::setw(12) << bytes / 1024 << " KiB" << std::setw(10) << std::fixed << std::setprecision(2)
+			  << (double)bytes / n << " B/value" << std::endl;
+}
+
+// and (0), or (1), andnot (2) of two sets by walking them, the result in a vector
+size_t mergeSets(const value_set& a, const value_set& b, int op, ft::vector<uint32_t>& out)
+{
+	value_set::const_iterator i = a.begin(), j = b.begin();
+
+	out.clear();
+	while (i != a.end() || j != b.end())
+	{
+		if (j == b.end() || (i != a.end() && *i < *j))
+		{
+			if (op != 0)
+				out.push_back(*i);
+			++i;
+		}
+		else if (i == a.end() || *j < *i)
+		{
+			if (op == 1)
+				out.push_back(*j);
+			++j;
+		}
+		else
+		{
+			if (op != 2)
+				out.push_back(*i);
+			++i;
+			++j;
+		}
+	}
+	return (out.size());
+}
+
+bool compare(distribution kind, const std::string& title, size_t n)
+{
+	const ft::vector<uint32_t> values = makeValues(kind, n);
+	const ft::vector<uint32_t> otherValues = makeValues(kind, n);
+	const size_t queries = 1000000;
+	bool ok = true;
+
+	ft::vector<uint32_t> probes(queries);
+	for (size_t i = 0; i < queries; ++i)
+		probes[i] = (i % 2) ? values[rand() % n] : random32() % limit(kind, n);
+
+	counting_resource resource;
+	value_set set(std::less<uint32_t>(), &resource);
+	value_set otherSet(std::less<uint32_t>(), &resource);
+	ft::roaring_set roaring, otherRoaring;
+
+	bench::header(title + ": insert");
+	bench::Timer timer;
+	for (size_t i = 0; i < n; ++i)
+		set.insert(values[i]);
+	bench::report("ft::set", n, timer.elapsed());
+	const size_t setBytes = resource.bytes;
+
+	timer.reset();
+	for (size_t i = 0; i < n; ++i)
+		roaring.insert(values[i]);
+	bench::report("roaring_set", n, timer.elapsed());
+	for (size_t i = 0; i < n; ++i)
+	{
+		otherSet.insert(otherValues[i]);
+		otherRoaring.insert(otherValues[i]);
+	}
+	ok = (roaring.size() == set.size()) && ok;
+
+	std::cout << std::endl;
+	reportMemory("ft::set", set.size(), setBytes);
+	reportMemory("roaring_set", roaring.size(), roaring.memory_usage());
+	timer.reset();
+	roaring.run_optimize();
+	otherRoaring.run_optimize();
+	const double optimizeTime = timer.elapsed();
+	reportMemory("roaring_set run_optimize", roaring.size(), roaring.memory_usage());
+	std::cout << "(run_optimize of both sets: " << optimizeTime * 1000 << " ms)" << std::endl;
+
+	bench::header(title + ": contains, half hits");
+	size_t hitsSet = 0, hitsRoaring = 0;
+	timer.reset();
+	for (size_t i = 0; i < queries; ++i)
+		hitsSet += set.count(probes[i]);
+	bench::report("ft::set count", queries, timer.elapsed());
+
+	timer.reset();
+	for (size_t i = 0; i < queries; ++i)
+		hitsRoaring += roaring.contains(probes[i]);
+	bench::report("roaring_set contains", queries, timer.elapsed());
+	ok = (hitsSet == hitsRoaring) && ok;
+
+	bench::header(title + ": full scan");
+	unsigned long sumSet = 0, sumRoaring = 0;
+	timer.reset();
+	for (value_set::const_iterator it = set.begin(); it != set.end(); ++it)
+		sumSet += *it;
+	bench::report("ft::set", set.size(), timer.elapsed());
+
+	timer.reset();
+	for (ft::roaring_set::const_iterator it = roaring.begin(); it != roaring.end(); ++it)
+		sumRoaring += *it;
+	bench::report("roaring_set", roaring.size(), timer.elapsed());
+	ok = (sumSet == sumRoaring) && ok;
+
+	bench::header(title + ": set operations");
+	const char* names[3] = { "and", "or", "andnot" };
+	ft::vector<uint32_t> merged;
+	for (int op = 0; op < 3; ++op)
+	{
+		timer.reset();
+		const size_t expected = mergeSets(set, otherSet, op, merged);
+		bench::report(std::string("ft::set merge ") + names[op], set.size() + otherSet.size(), timer.elapsed());
+
+		timer.reset();
+		const ft::roaring_set result = (op == 0) ? (roaring & otherRoaring)
+									   : (op == 1) ? (roaring | otherRoaring) : andnot(roaring, otherRoaring);
+		bench::report(std::string("roaring_set ") + names[op], set.size() + otherSet.size(), timer.elapsed());
+		ok = (result.size() == expected && ft::roaring_set(merged.begin(), merged.end()) == result) && ok;
+	}
+	return (ok);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = std::max((argc > 1) ? bench::parseCount(argv[1]) : 1000000, (size_t)1000);
+	bool ok = true;
+
+	srand(42);
+	ok = compare(DENSE, "dense", n) && ok;
+	ok = compare(CLUSTERED, "clustered", n) && ok;
+	ok = compare(SPARSE, "sparse", n) && ok;
+	if (!ok)
+	{
+		std::cout << "Error: roaring_set and ft::set disagree" << std::endl;
+		return (1);
+	}
+	return (0);
+}
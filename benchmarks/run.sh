@@ -0,0 +1,26 @@
+#!/bin/bash
+
+# Usage: ./run.sh <benchmark> [arguments]
+# eg. ./run.sh radix_sort 10M
+
+compile_bench() {
+	${CXX:-clang++} -Wall -Wextra -Werror -std=c++98 -O2 -pthread -I.. "$1.cpp" -o "$1.out"
+}
+
+if [ -z "$1" ] || ! [ -f "$1.cpp" ]; then
+	echo "Usage: ./run.sh <benchmark> [arguments]"
+	echo "Benchmarks:" $(ls *.cpp | sed 's/\.cpp//')
+	exit 1
+fi
+
+bench=$1
+shift
+
+echo "Compiling $bench"
+compile_bench $bench || exit 1
+
+./$bench.out "$@"
+ret=$?
+
+rm $bench.out
+exit $ret
@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:13 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <sstream>
+
+#include "sharded_map.hpp"
+
+/* Lookups from many threads with some writes mixed in (1 in 10 by default): one ft::map behind
+   a global reader / writer lock vs ft::sharded_map, then the ordered traversal (k-way merge).
+   ./run.sh sharded_map [operations] [keys] [max threads] [writes in 100]
+   (default 2M operations on 100K keys, up to 64 threads, 10% writes) */
+
+// What the lookups were served from before
+class LockedMap
+{
+	private:
+		mutable pthread_rwlock_t	_lock;
+		ft::map<size_t, size_t>		_map;
+
+	public:
+		LockedMap() { pthread_rwlock_init(&this->_lock, NULL); }
+		~LockedMap() { pthread_rwlock_destroy(&this->_lock); }
+
+		void insert_or_assign(size_t k, size_t v)
+		{
+			pthread_rwlock_wrlock(&this->_lock);
+			this->_map[k] = v;
+			pthread_rwlock_unlock(&this->_lock);
+		}
+
+		bool find(size_t k, size_t& v) const
+		{
+			pthread_rwlock_rdlock(&this->_lock);
+			ft::map<size_t, size_t>::const_iterator it = this->_map.find(k);
+			const bool found = (it != this->_map.end());
+			if (found)
+				v = it->second;
+			pthread_rwlock_unlock(&this->_lock);
+			return (found);
+		}
+};
+
+template <class Map>
+struct Client
+{
+	Map*	map;
+	size_t	ops;
+	size_t	keys;
+	size_t	writes; // In 100
+	size_t	seed;
+	size_t	found;
+
+	static void* run(void* arg)
+	{
+		Client* self = static_cast<Client*>(arg);
+		size_t val;
+
+		for (size_t i = 0; i < self->ops; ++i)
+		{
+			self->seed = self->seed * 6364136223846793005ULL + 1442695040888963407ULL;
+			const size_t key = (self->seed >> 33) % self->keys;
+
+			if ((self->seed >> 20) % 100 < self->writes)
+				self->map->insert_or_assign(key, key * 2);
+			else if (self->map->find(key, val) && val == key * 2)
+				++self->found;
+		}
+		return (NULL);
+	}
+};
+
+// Every key is there from the start (values key * 2), so every lookup must find its key
+template <class Map>
+bool run(const std::string& name, Map& map, size_t ops, size_t keys, size_t threads, size_t writes)
+{
+	Client<Map> clients[64];
+	pthread_t ids[64];
+	size_t found = 0;
+	size_t lookups = 0;
+
+	for (size_t i = 0; i < threads; ++i)
+	{
+		clients[i].map = &map;
+		clients[i].ops = ops / threads;
+		clients[i].keys = keys;
+		clients[i].writes = writes;
+		clients[i].seed = i * 7919 + 1;
+		clients[i].found = 0;
+	}
+
+	bench::Timer timer;
+	for (size_t i = 0; i < threads; ++i)
+		pthread_create(&ids[i], NULL, &Client<Map>::run, &clients[i]);
+	for (size_t i = 0; i < threads; ++i)
+		pthread_join(ids[i], NULL);
+	bench::report(name, ops / threads * threads, timer.elapsed());
+
+	// Same draws again to count the lookups
+	for (size_t i = 0; i < threads; ++i)
+	{
+		size_t seed = i * 7919 + 1;
+		for (size_t j = 0; j < ops / threads; ++j)
+		{
+			seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+			lookups += ((seed >> 20) % 100 >= writes);
+		}
+		found += clients[i].found;
+	}
+	if (found != lookups)
+		std::cout << "Error: " << found << " lookups found their key out of " << lookups << std::endl;
+	return (found == lookups);
+}
+
+struct CheckOrder
+{
+	size_t	count;
+	size_t	previous;
+	bool	sorted;
+
+	CheckOrder() : count(0), previous(0), sorted(true) { }
+
+	void operator()(const ft::pair<const size_t, size_t>& val)
+	{
+		if (this->count != 0 && val.first <= this->previous)
+			this->sorted = false;
+		this->previous = val.first;
+		++this->count;
+	}
+};
+
+int main(int argc, char** argv)
+{
+	const size_t ops = (argc > 1) ? bench::parseCount(argv[1]) : 2000000;
+	const size_t keys = (argc > 2) ? bench::parseCount(argv[2]) : 100000;
+	const size_t maxThreads = std::min((argc > 3) ? bench::parseCount(argv[3]) : 64, (size_t)64);
+	const size_t writes = std::min((argc > 4) ? bench::parseCount(argv[4]) : 10, (size_t)100);
+	LockedMap locked;
+	ft::sharded_map<size_t, size_t> sharded;
+	bool ok = true;
+
+	for (size_t k = 0; k < keys; ++k)
+	{
+		locked.insert_or_assign(k, k * 2);
+		sharded.insert_or_assign(k, k * 2);
+	}
+
+	std::cout << keys << " keys, " << writes << "% writes, " << sharded.shard_count()
+			  << " shards, online CPUs: " << ft::parallel_concurrency() << std::endl;
+	for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		std::ostringstream title;
+		title << threads << " threads";
+		bench::header(title.str());
+
+		ok &= run("ft::map + global rwlock", locked, ops, keys, threads, writes);
+		ok &= run("sharded_map", sharded, ops, keys, threads, writes);
+	}
+
+	bench::header("ordered traversal");
+	bench::Timer timer;
+	CheckOrder order = sharded.for_each(CheckOrder());
+	bench::report("for_each (k-way merge)", order.count, timer.elapsed());
+	if (!order.sorted || order.count != keys)
+	{
+		std::cout << "Error: traversal out of order or missing keys" << std::endl;
+		ok = false;
+	}
+	return (ok ? 0 : 1);
+}
@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:54 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "map.hpp"
+#include "shm_allocator.hpp"
+#include "thread_pool.hpp"
+
+/* Worker processes looking keys up in a big map: each one building its own copy vs one copy
+   built once in a shm_segment, that each worker maps (at an address of its own) and reads.
+   Also the cost of offset_ptr links on a lookup, and the multi process check: every worker
+   verifies what it finds. ./run.sh shm_map [elements] [workers] [lookups per worker]
+   (default 1M, online CPUs but at least 4, 1M) */
+
+typedef ft::pair<const int, long> value_type;
+typedef ft::map<int, long, std::less<int>, ft::shm_allocator<value_type> > shm_map;
+typedef ft::map<int, long> local_map;
+
+// Keys are 0, 2, 4... (2 * n - 2) mapped to key * 3, lookups ask for odd keys too
+template <class Map>
+void fill(Map& m, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+	{
+		const size_t k = (i * 2654435761UL) % n; // Shuffled insertion order
+		m.insert(ft::make_pair((int)(k * 2), (long)(k * 6)));
+	}
+}
+
+template <class Map>
+bool lookups(const Map& m, size_t n, size_t count, unsigned seed)
+{
+	long found = 0;
+	long expected = 0;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const int key = rand_r(&seed) % (int)(n * 2);
+		typename Map::const_iterator it = m.find(key);
+		if (it != m.end())
+			found += it->second;
+		if (key % 2 == 0)
+			expected += (long)key * 3;
+	}
+	return (found == expected);
+}
+
+// Runs workers processes calling work(index), false if any of them failed
+template <class Work>
+bool forkWorkers(size_t workers, Work work)
+{
+	for (size_t i = 0; i < workers; ++i)
+	{
+		pid_t pid = fork();
+		if (pid < 0)
+			return (false);
+		if (pid == 0)
+			_exit(work(i) ? 0 : 1);
+	}
+
+	bool ok = true;
+	for (size_t i = 0; i < workers; ++i)
+	{
+		int status;
+		if (wait(&status) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			ok = false;
+	}
+	return (ok);
+}
+
+struct PrivateWorker
+{
+	size_t n;
+	size_t count;
+
+	bool operator()(size_t index) const
+	{
+		local_map m;
+		fill(m, this->n);
+		return (lookups(m, this->n, this->count, (unsigned)index + 1));
+	}
+};
+
+struct SharedWorker
+{
+	const char*	name;
+	size_t		n;
+	size_t		count;
+
+	bool operator()(size_t index) const
+	{
+		ft::shm_segment segment(this->name);
+		const shm_map* m = segment.root<shm_map>();
+		return (m != NULL && m->size() == this->n && lookups(*m, this->n, this->count, (unsigned)index + 1));
+	}
+};
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 1000000;
+	const size_t workers = (argc > 2) ? bench::parseCount(argv[2]) : std::max(ft::parallel_concurrency(), (size_t)4);
+	const size_t count = (argc > 3) ? bench::parseCount(argv[3]) : 1000000;
+	bool ok = true;
+
+	std::ostringstream stream;
+	stream << "/ft_shm_map_bench_" << getpid();
+	const std::string name = stream.str();
+
+	std::cout << "elements: " << n << ", workers: " << workers << ", lookups per worker: " << count << std::endl;
+	{
+		// Nodes are 48 bytes (3 links, the pair and the color), 64 leaves room
+		ft::shm_segment segment(name.c_str(), n * 64 + (1 << 20));
+
+		bench::header("building the map");
+		bench::Timer timer;
+		local_map local;
+		fill(local, n);
+		bench::report("ft::map", n, timer.elapsed());
+
+		timer.reset();
+		shm_map* shared = new (segment.allocate(sizeof(shm_map))) shm_map(std::less<int>(), segment.get_allocator<value_type>());
+		fill(*shared, n);
+		segment.set_root(shared);
+		bench::report("ft::map in shm_segment", n, timer.elapsed());
+		std::cout << "segment bytes used: " << segment.used() << std::endl;
+
+		bench::header("lookups, this process");
+		timer.reset();
+		ok = lookups(local, n, count, 42) && ok;
+		bench::report("ft::map", count, timer.elapsed());
+		timer.reset();
+		ok = lookups(*shared, n, count, 42) && ok;
+		bench::report("ft::map, offset_ptr links", count, timer.elapsed());
+
+		bench::header("worker processes, build (or map) then lookups");
+		PrivateWorker privateWorker;
+		privateWorker.n = n;
+		privateWorker.count = count;
+		timer.reset();
+		ok = forkWorkers(workers, privateWorker) && ok;
+		bench::report("a copy per worker", count * workers, timer.elapsed());
+
+		SharedWorker sharedWorker;
+		sharedWorker.name = name.c_str();
+		sharedWorker.n = n;
+		sharedWorker.count = count;
+		timer.reset();
+		ok = forkWorkers(workers, sharedWorker) && ok;
+		bench::report("one map in shm", count * workers, timer.elapsed());
+
+		shared->~shm_map();
+	}
+	ft::shm_segment::remove(name.c_str());
+
+	if (!ok)
+	{
+		std::cout << "Error: wrong lookup results" << std::endl;
+		return (1);
+	}
+	return (0);
+}
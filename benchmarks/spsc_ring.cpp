@@ -0,0 +1,376 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:07 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstring>
+
+#include "concurrent_queue.hpp"
+#include "spsc_ring.hpp"
+
+/* Parser -> writer hand-off between two threads pinned to two cores (when there are two):
+   throughput one value at a time, by batches and with direct access to the buffer, against
+   ft::concurrent_queue, then the latency of a round trip (ping-pong over two rings).
+   ./run.sh spsc_ring [items] [round trips] (default 10M items, 100K round trips) */
+
+#define RING_CAPACITY 4096
+#define BATCH 64
+
+// Pins the calling thread to a CPU, false if it doesn't exist (or the affinity can't be set)
+bool pinTo(size_t cpu)
+{
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+}
+
+inline void waitABit(size_t& tries)
+{
+	if (++tries < 64)
+		ft::cpu_relax();
+	else
+		sched_yield();
+}
+
+enum Mode { SINGLE, BATCHES, SPANS };
+
+template <class Queue>
+struct Producer
+{
+	Queue*	queue;
+	size_t	n;
+	Mode	mode;
+
+	static void* run(void* arg);
+};
+
+// Pushes 0 .. n - 1
+template <class Queue>
+void* Producer<Queue>::run(void* arg)
+{
+	Producer* self = static_cast<Producer*>(arg);
+	size_t values[BATCH];
+
+	pinTo(1);
+	for (size_t val = 0, tries = 0; val < self->n; )
+	{
+		size_t pushed = 0;
+
+		if (self->mode == SINGLE)
+			pushed = self->queue->try_push(val) ? 1 : 0;
+		else
+		{
+			const size_t n = std::min(self->n - val, (size_t)BATCH);
+			for (size_t i = 0; i < n; ++i)
+				values[i] = val + i;
+			pushed = self->queue->try_push_n(values, n);
+		}
+		val += pushed;
+		if (pushed != 0)
+			tries = 0;
+		else
+			waitABit(tries);
+	}
+	return (NULL);
+}
+
+// The ring has push_n and spans instead of try_push_n
+template <>
+void* Producer<ft::spsc_ring<size_t> >::run(void* arg)
+{
+	Producer* self = static_cast<Producer*>(arg);
+	size_t values[BATCH];
+	size_t* span;
+
+	pinTo(1);
+	for (size_t val = 0, tries = 0; val < self->n; )
+	{
+		size_t pushed = 0;
+
+		if (self->mode == SINGLE)
+			pushed = self->queue->try_push(val) ? 1 : 0;
+		else if (self->mode == BATCHES)
+		{
+			const size_t n = std::min(self->n - val, (size_t)BATCH);
+			for (size_t i = 0; i < n; ++i)
+				values[i] = val + i;
+			pushed = self->queue->push_n(values, n);
+		}
+		else
+		{
+			pushed = std::min(self->queue->write_span(span), self->n - val);
+			for (size_t i = 0; i < pushed; ++i)
+				span[i] = val + i;
+			self->queue->commit_write(pushed);
+		}
+		val += pushed;
+		if (pushed != 0)
+			tries = 0;
+		else
+			waitABit(tries);
+	}
+	return (NULL);
+}
+
+// Pops n values on the calling thread, returns their sum
+template <class Queue>
+size_t consume(Queue& queue, size_t n, Mode mode)
+{
+	size_t values[BATCH];
+	size_t sum = 0;
+	size_t val;
+
+	for (size_t left = n, tries = 0; left != 0; )
+	{
+		size_t popped = 0;
+
+		if (mode == SINGLE)
+		{
+			if (queue.try_pop(val))
+			{
+				sum += val;
+				popped = 1;
+			}
+		}
+		else
+		{
+			popped = queue.try_pop_n(values, std::min(left, (size_t)BATCH));
+			for (size_t i = 0; i < popped; ++i)
+				sum += values[i];
+		}
+		left -= popped;
+		if (popped != 0)
+			tries = 0;
+		else
+			waitABit(tries);
+	}
+	return (sum);
+}
+
+template <>
+size_t consume(ft::spsc_ring<size_t>& ring, size_t n, Mode mode)
+{
+	size_t values[BATCH];
+	const size_t* span;
+	size_t sum = 0;
+	size_t val;
+
+	for (size_t left = n, tries = 0; left != 0; )
+	{
+		size_t popped = 0;
+
+		if (mode == SINGLE)
+		{
+			if (ring.try_pop(val))
+			{
+				sum += val;
+				popped = 1;
+			}
+		}
+		else if (mode == BATCHES)
+		{
+			popped = ring.pop_n(values, std::min(left, (size_t)BATCH));
+			for (size_t i = 0; i < popped; ++i)
+				sum += values[i];
+		}
+		else
+		{
+			popped = ring.read_span(span);
+			for (size_t i = 0; i < popped; ++i)
+				sum += span[i];
+			ring.commit_read(popped);
+		}
+		left -= popped;
+		if (popped != 0)
+			tries = 0;
+		else
+			waitABit(tries);
+	}
+	return (sum);
+}
+
+template <class Queue>
+bool throughput(const std::string& name, size_t n, Mode mode)
+{
+	Queue queue(RING_CAPACITY);
+	Producer<Queue> producer;
+	pthread_t thread;
+
+	producer.queue = &queue;
+	producer.n = n;
+	producer.mode = mode;
+
+	bench::Timer timer;
+	pthread_create(&thread, NULL, &Producer<Queue>::run, &producer);
+	const size_t sum = consume(queue, n, mode);
+	pthread_join(thread, NULL);
+	bench::report(name, n, timer.elapsed());
+
+	if (sum != n * (n - 1) / 2)
+		std::cout << "Error: popped values add up to " << sum << " instead of " << n * (n - 1) / 2 << std::endl;
+	return (sum == n * (n - 1) / 2);
+}
+
+// Bytes through the ring with memcpy in and out of the spans, like a parser handing buffers to a writer
+struct ByteProducer
+{
+	ft::spsc_ring<char>*	ring;
+	const char*				data;
+	size_t					size;
+
+	static void* run(void* arg)
+	{
+		ByteProducer* self = static_cast<ByteProducer*>(arg);
+		char* span;
+
+		pinTo(1);
+		for (size_t done = 0, tries = 0; done < self->size; )
+		{
+			const size_t n = std::min(self->ring->write_span(span), self->size - done);
+
+			std::memcpy(span, self->data + done, n);
+			self->ring->commit_write(n);
+			done += n;
+			if (n != 0)
+				tries = 0;
+			else
+				waitABit(tries);
+		}
+		return (NULL);
+	}
+};
+
+bool bytes(size_t size)
+{
+	ft::spsc_ring<char> ring(1 << 16);
+	char* in = new char[size];
+	char* out = new char[size];
+	ByteProducer producer;
+	pthread_t thread;
+	const char* span;
+
+	for (size_t i = 0; i < size; ++i)
+		in[i] = static_cast<char>(i * 7);
+	producer.ring = &ring;
+	producer.data = in;
+	producer.size = size;
+
+	bench::Timer timer;
+	pthread_create(&thread, NULL, &ByteProducer::run, &producer);
+	for (size_t done = 0, tries = 0; done < size; )
+	{
+		const size_t n = ring.read_span(span);
+
+		std::memcpy(out + done, span, n);
+		ring.commit_read(n);
+		done += n;
+		if (n != 0)
+			tries = 0;
+		else
+			waitABit(tries);
+	}
+	pthread_join(thread, NULL);
+	bench::reportBytes("spans + memcpy, 64K ring", size, timer.elapsed());
+
+	const bool same = (std::memcmp(in, out, size) == 0);
+	if (!same)
+		std::cout << "Error: bytes changed on the way" << std::endl;
+	delete[] in;
+	delete[] out;
+	return (same);
+}
+
+struct Echo
+{
+	ft::spsc_ring<size_t>*	ping;
+	ft::spsc_ring<size_t>*	pong;
+	size_t					trips;
+
+	static void* run(void* arg)
+	{
+		Echo* self = static_cast<Echo*>(arg);
+		size_t val;
+
+		pinTo(1);
+		for (size_t i = 0, tries = 0; i < self->trips; )
+		{
+			if (self->ping->try_pop(val))
+			{
+				while (!self->pong->try_push(val))
+					ft::cpu_relax();
+				++i;
+				tries = 0;
+			}
+			else
+				waitABit(tries);
+		}
+		return (NULL);
+	}
+};
+
+void latency(size_t trips)
+{
+	ft::spsc_ring<size_t> ping(64);
+	ft::spsc_ring<size_t> pong(64);
+	Echo echo;
+	pthread_t thread;
+	size_t val;
+
+	echo.ping = &ping;
+	echo.pong = &pong;
+	echo.trips = trips;
+	pthread_create(&thread, NULL, &Echo::run, &echo);
+
+	bench::Timer timer;
+	for (size_t i = 0, tries = 0; i < trips; ++i)
+	{
+		while (!ping.try_push(i))
+			ft::cpu_relax();
+		while (!pong.try_pop(val))
+			waitABit(tries);
+		tries = 0;
+	}
+	const double seconds = timer.elapsed();
+	pthread_join(thread, NULL);
+
+	bench::report("round trips", trips, seconds);
+	std::cout << "  " << std::fixed << std::setprecision(0) << seconds / trips * 1e9 << " ns per round trip" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	const size_t n = (argc > 1) ? bench::parseCount(argv[1]) : 10000000;
+	const size_t trips = (argc > 2) ? bench::parseCount(argv[2]) : 100000;
+	bool ok = true;
+
+	if (!pinTo(0))
+		std::cout << "Warning: couldn't pin to CPU 0" << std::endl;
+	std::cout << "capacity: " << RING_CAPACITY << ", batches of " << BATCH
+			  << ", online CPUs: " << ft::parallel_concurrency()
+			  << (ft::parallel_concurrency() < 2 ? " (both threads share it, expect yields)" : "") << std::endl;
+
+	bench::header("1 producer, 1 consumer");
+	ok &= throughput<ft::concurrent_queue<size_t> >("concurrent_queue", n, SINGLE);
+	ok &= throughput<ft::concurrent_queue<size_t> >("concurrent_queue, batches", n, BATCHES);
+	ok &= throughput<ft::spsc_ring<size_t> >("spsc_ring", n, SINGLE);
+	ok &= throughput<ft::spsc_ring<size_t> >("spsc_ring, push_n / pop_n", n, BATCHES);
+	ok &= throughput<ft::spsc_ring<size_t> >("spsc_ring, spans", n, SPANS);
+
+	bench::header("bytes");
+	ok &= bytes(n * sizeof(size_t) * 4);
+
+	bench::header("latency");
+	latency(trips);
+	return (ok ? 0 : 1);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:40 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <pthread.h>
+#include <sstream>
+
+#include "map.hpp"
+#include "thread_cache_allocator.hpp"
+#include "thread_pool.hpp"
+
+/* Every thread churns a map of its own: inserts a batch of random keys, erases them, again.
+   Nodes from std::allocator (malloc, shared by all threads) vs ft::thread_cache_allocator.
+   ./run.sh thread_cache [operations per thread] [max threads] (default 2M, online CPUs but at least 8) */
+
+#define CHURN_KEYS 4096
+
+template <class Map>
+struct Churn
+{
+	size_t		operations;
+	unsigned	seed;
+	size_t		left; // Elements still in the map at the end, must be 0
+
+	static void* run(void* arg)
+	{
+		Churn* churn = static_cast<Churn*>(arg);
+		Map m;
+		int keys[CHURN_KEYS];
+		size_t done = 0;
+
+		while (done < churn->operations)
+		{
+			for (size_t i = 0; i < CHURN_KEYS; ++i)
+			{
+				keys[i] = rand_r(&churn->seed);
+				m.insert(ft::make_pair(keys[i], (long)i));
+			}
+			for (size_t i = 0; i < CHURN_KEYS; ++i)
+				m.erase(keys[i]);
+			done += CHURN_KEYS * 2;
+		}
+		churn->left = m.size();
+		return (NULL);
+	}
+};
+
+template <class Map>
+bool runChurn(const std::string& name, size_t threads, size_t operations)
+{
+	Churn<Map> churns[64];
+	pthread_t ids[64];
+
+	bench::Timer timer;
+	for (size_t i = 0; i < threads; ++i)
+	{
+		churns[i].operations = operations;
+		churns[i].seed = (unsigned)i + 1;
+		churns[i].left = 0;
+		pthread_create(&ids[i], NULL, &Churn<Map>::run, &churns[i]);
+	}
+	bool ok = true;
+	for (size_t i = 0; i < threads; ++i)
+	{
+		pthread_join(ids[i], NULL);
+		ok = ok && (churns[i].left == 0);
+	}
+	bench::report(name, operations * threads, timer.elapsed());
+	return (ok);
+}
+
+int main(int argc, char** argv)
+{
+	typedef ft::pair<const int, long> value_type;
+	typedef ft::map<int, long, std::less<int>, std::allocator<value_type> > std_map;
+	typedef ft::map<int, long, std::less<int>, ft::thread_cache_allocator<value_type> > cached_map;
+
+	const size_t operations = (argc > 1) ? bench::parseCount(argv[1]) : 2000000;
+	size_t maxThreads = (argc > 2) ? bench::parseCount(argv[2]) : std::max(ft::parallel_concurrency(), (size_t)8);
+	maxThreads = std::min(std::max(maxThreads, (size_t)1), (size_t)64);
+	bool ok = true;
+
+	std::cout << "operations per thread: " << operations << ", online CPUs: " << ft::parallel_concurrency() << std::endl;
+	for (size_t threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		std::ostringstream title;
+		title << threads << " thread" << (threads > 1 ? "s" : "") << ", insert / erase";
+		bench::header(title.str());
+		ok = runChurn<std_map>("std::allocator", threads, operations) && ok;
+		ok = runChurn<cached_map>("thread_cache_allocator", threads, operations) && ok;
+	}
+
+	if (!ok)
+	{
+		std::cout << "Error: maps not empty after erasing every key inserted" << std::endl;
+		return (1);
+	}
+	return (0);
+}
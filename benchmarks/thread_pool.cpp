@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:02 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include "thread_pool.hpp"
+
+/* What it costs to hand work to threads: a parallel_for doing (almost) nothing, with threads
+   started and joined on every call (what the parallel algorithms used to do) vs the pool,
+   then the cost per chunk when a range is cut in many tiny chunks.
+   ./run.sh thread_pool [calls] [threads] (default 10k calls, online CPUs but at least 4) */
+
+struct Touch
+{
+	size_t* sum;
+
+	void operator()(size_t begin, size_t end) const { __atomic_add_fetch(this->sum, end - begin, __ATOMIC_RELAXED); }
+};
+
+struct SpawnJob
+{
+	Touch	fn;
+	size_t	begin;
+	size_t	end;
+
+	static void* run(void* arg)
+	{
+		SpawnJob* job = static_cast<SpawnJob*>(arg);
+		job->fn(job->begin, job->end);
+		return (NULL);
+	}
+};
+
+// One thread per chunk, started and joined for this call only
+void spawnFor(size_t threads, const Touch& fn)
+{
+	SpawnJob jobs[64];
+	pthread_t ids[64];
+
+	for (size_t i = 0; i < threads; ++i)
+	{
+		jobs[i].fn = fn;
+		jobs[i].begin = i;
+		jobs[i].end = i + 1;
+	}
+	for (size_t i = 1; i < threads; ++i)
+		pthread_create(&ids[i], NULL, &SpawnJob::run, &jobs[i]);
+	SpawnJob::run(&jobs[0]);
+	for (size_t i = 1; i < threads; ++i)
+		pthread_join(ids[i], NULL);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t calls = (argc > 1) ? bench::parseCount(argv[1]) : 10000;
+	size_t threads = (argc > 2) ? bench::parseCount(argv[2]) : std::max(ft::parallel_concurrency(), (size_t)4);
+	threads = std::min(std::max(threads, (size_t)1), (size_t)64);
+
+	size_t sum = 0;
+	size_t expected = calls * threads * 2;
+	Touch touch;
+	touch.sum = &sum;
+	ft::thread_pool pool(threads);
+
+	std::cout << "threads: " << threads << ", online CPUs: " << ft::parallel_concurrency() << std::endl;
+	bench::header("parallel_for calls, one chunk per thread");
+
+	bench::Timer timer;
+	for (size_t i = 0; i < calls; ++i)
+		spawnFor(threads, touch);
+	bench::report("threads spawned per call", calls, timer.elapsed());
+
+	timer.reset();
+	for (size_t i = 0; i < calls; ++i)
+		pool.parallel_for(0, threads, 1, touch);
+	bench::report("thread_pool", calls, timer.elapsed());
+
+	bench::header("chunks of one index");
+	for (size_t chunks = 1000; chunks <= calls * 100; chunks *= 10)
+	{
+		timer.reset();
+		for (size_t i = 0; i < chunks; ++i)
+			touch(i, i + 1);
+		bench::report("sequential calls", chunks, timer.elapsed());
+
+		timer.reset();
+		pool.parallel_for(0, chunks, 1, touch);
+		bench::report("thread_pool chunks", chunks, timer.elapsed());
+		expected += chunks * 2;
+	}
+
+	if (sum != expected)
+		std::cout << "Error: " << sum << " indexes touched instead of " << expected << std::endl;
+	return (0);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:28 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include "vector.hpp"
+
+/* vector ==, < on big vectors which only differ on their last element (worst case, full scan),
+   element by element loop (what ft::equal / ft::lexicographical_compare used to do)
+   vs the dispatched version, double has no fast path and is there for reference */
+
+#define REPEAT 10
+
+template <class Iterator>
+bool scalarEqual(Iterator first1, Iterator last1, Iterator first2)
+{
+	for (; first1 != last1; ++first1, ++first2)
+		if (!(*first1 == *first2))
+			return (false);
+	return (true);
+}
+
+template <class Iterator>
+bool scalarLess(Iterator first1, Iterator last1, Iterator first2, Iterator last2)
+{
+	for (; first1 != last1 && first2 != last2; ++first1, ++first2)
+	{
+		if (*first1 < *first2)
+			return (true);
+		if (*first2 < *first1)
+			return (false);
+	}
+	return (first1 == last1 && first2 != last2);
+}
+
+template <class T>
+void benchType(const std::string& name, size_t n)
+{
+	ft::vector<T> lhs(n, T(1));
+	ft::vector<T> rhs(n, T(1));
+	rhs.back() = T(2);
+
+	bool result = false;
+	bench::Timer timer;
+	for (int i = 0; i < REPEAT; ++i)
+		result ^= scalarEqual(lhs.begin(), lhs.end(), rhs.begin());
+	bench::report(name + " == scalar loop", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+		result ^= (lhs == rhs);
+	bench::report(name + " == ft::vector", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+		result ^= scalarLess(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	bench::report(name + " < scalar loop", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+		result ^= (lhs < rhs);
+	bench::report(name + " < ft::vector", n * REPEAT, timer.elapsed());
+
+	if (lhs == rhs || !(lhs < rhs) || rhs < lhs)
+		std::cout << "Error: wrong " << name << " comparison result" << std::endl;
+	bench::doNotOptimize(result);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t max = (argc > 1) ? bench::parseCount(argv[1]) : 100000000;
+
+	bench::header("vector comparisons");
+	for (size_t n = 1000000; n <= max; n *= 10)
+	{
+		benchType<char>("char", n);
+		benchType<unsigned char>("unsigned char", n);
+		benchType<int>("int", n);
+		benchType<unsigned int>("unsigned", n);
+		benchType<double>("double", n);
+	}
+	return (0);
+}
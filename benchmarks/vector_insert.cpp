@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:33 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include "vector.hpp"
+
+#include <list>
+
+/* insert / erase a few slots before end() of big vectors: positions are now computed
+   with ft::distance, O(1) on VectIterator, so the cost should not depend on the size anymore */
+
+#define OPERATIONS 10000
+
+int main(int argc, char** argv)
+{
+	const size_t max = (argc > 1) ? bench::parseCount(argv[1]) : 100000000;
+
+	bench::header("vector insert / erase near end()");
+	for (size_t n = 1000; n <= max; n *= 10)
+	{
+		ft::vector<int> vect(n, 42);
+		std::cout << "size " << n << std::endl;
+		vect.reserve(n + OPERATIONS * 4); // Only measure the position lookup and the few moves
+
+		bench::Timer timer;
+		for (int i = 0; i < OPERATIONS; ++i)
+			vect.insert(vect.end() - 8, i);
+		bench::report("insert(end() - 8, val)", OPERATIONS, timer.elapsed());
+
+		timer.reset();
+		for (int i = 0; i < OPERATIONS; ++i)
+			vect.erase(vect.end() - 8);
+		bench::report("erase(end() - 8)", OPERATIONS, timer.elapsed());
+
+		int values[4] = { 1, 2, 3, 4 };
+		timer.reset();
+		for (int i = 0; i < OPERATIONS; ++i)
+			vect.insert(vect.end() - 8, values, values + 4);
+		bench::report("insert(end() - 8, first, last)", OPERATIONS, timer.elapsed());
+
+		if (vect.size() != n + OPERATIONS * 4)
+			std::cout << "Error: wrong size " << vect.size() << std::endl;
+	}
+
+	// Range assign from bidirectional iterators still walks them, but only once now
+	std::list<int> list(1000000, 21);
+	ft::vector<int> vect;
+	bench::Timer timer;
+	vect.assign(list.begin(), list.end());
+	bench::report("assign(list.begin(), list.end())", list.size(), timer.elapsed());
+	return (0);
+}
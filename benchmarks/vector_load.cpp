@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:00 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sys/wait.h>
+
+#include "external_sort.hpp"
+#include "vector.hpp"
+
+/* Loading a file into an ft::vector<char> (then into records): push_back per byte from an
+   istreambuf_iterator or from read() chunks, vs append_from_stream and append_from_fd, which read
+   straight into the capacity reserved once. The file was just written, so it is read from the
+   page cache and the numbers are copy costs, not disk speed.
+   ./run.sh vector_load [bytes] [directory] (default 256M, /tmp) */
+
+struct Record
+{
+	long	id;
+	long	value;
+	double	weight;
+	long	flags;
+};
+
+unsigned long checksum(const char* bytes, size_t n)
+{
+	unsigned long sum = 0;
+
+	for (size_t i = 0; i < n; i += 4096)
+		sum = sum * 31 + (unsigned char)bytes[i];
+	return (sum + n);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t bytes = ((argc > 1) ? bench::parseBytes(argv[1]) : (size_t)256 << 20) / sizeof(Record) * sizeof(Record);
+	const std::string path = std::string((argc > 2) ? argv[2] : "/tmp") + "/ft_vector_load_bench";
+	bool ok = true;
+
+	{
+		ft::vector<char> data(bytes);
+		for (size_t i = 0; i < bytes; ++i)
+			data[i] = (char)(i * 7 + (i >> 12));
+		int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0)
+			ft::external_sort_error("open " + path);
+		ft::write_full(fd, &data[0], bytes);
+		close(fd);
+	}
+	unsigned long expected;
+	{
+		ft::vector<char> data;
+		int fd = open(path.c_str(), O_RDONLY);
+		data.append_from_fd(fd);
+		close(fd);
+		expected = checksum(&data[0], bytes);
+	}
+
+	bench::header("file into ft::vector<char>");
+	bench::Timer timer;
+	{
+		std::ifstream in(path.c_str(), std::ios::binary);
+		ft::vector<char> data;
+		for (std::istreambuf_iterator<char> it(in), end; it != end; ++it)
+			data.push_back(*it);
+		ok = (data.size() == bytes && checksum(&data[0], bytes) == expected) && ok;
+	}
+	bench::reportBytes("istreambuf_iterator push_back", bytes, timer.elapsed());
+
+	timer.reset();
+	{
+		int fd = open(path.c_str(), O_RDONLY);
+		ft::vector<char> data;
+		char chunk[65536];
+		size_t got;
+		while ((got = ft::read_full(fd, chunk, sizeof(chunk))) > 0)
+			for (size_t i = 0; i < got; ++i)
+				data.push_back(chunk[i]);
+		close(fd);
+		ok = (data.size() == bytes && checksum(&data[0], bytes) == expected) && ok;
+	}
+	bench::reportBytes("read() 64KiB then push_back", bytes, timer.elapsed());
+
+	timer.reset();
+	{
+		std::ifstream in(path.c_str(), std::ios::binary);
+		ft::vector<char> data;
+		data.append_from_stream(in);
+		ok = (data.size() == bytes && checksum(&data[0], bytes) == expected) && ok;
+	}
+	bench::reportBytes("append_from_stream", bytes, timer.elapsed());
+
+	timer.reset();
+	{
+		int fd = open(path.c_str(), O_RDONLY);
+		ft::vector<char> data;
+		data.append_from_fd(fd);
+		close(fd);
+		ok = (data.size() == bytes && checksum(&data[0], bytes) == expected) && ok;
+	}
+	bench::reportBytes("append_from_fd", bytes, timer.elapsed());
+
+	timer.reset();
+	{
+		int fds[2];
+		if (pipe(fds) < 0)
+			ft::external_sort_error("pipe");
+		pid_t child = fork();
+		if (child == 0)
+		{
+			close(fds[0]);
+			int fd = open(path.c_str(), O_RDONLY);
+			char chunk[1 << 16];
+			size_t got;
+			while ((got = ft::read_full(fd, chunk, sizeof(chunk))) > 0)
+				ft::write_full(fds[1], chunk, got);
+			_exit(0);
+		}
+		close(fds[1]);
+		ft::vector<char> data;
+		data.append_from_fd(fds[0]);
+		close(fds[0]);
+		waitpid(child, NULL, 0);
+		ok = (data.size() == bytes && checksum(&data[0], bytes) == expected) && ok;
+	}
+	bench::reportBytes("append_from_fd (pipe, no size)", bytes, timer.elapsed());
+
+	bench::header("file into ft::vector<Record>");
+	timer.reset();
+	{
+		std::ifstream in(path.c_str(), std::ios::binary);
+		ft::vector<Record> records;
+		Record record;
+		while (in.read(reinterpret_cast<char*>(&record), sizeof(record)))
+			records.push_back(record);
+		ok = (records.size() * sizeof(Record) == bytes
+			  && checksum(reinterpret_cast<char*>(&records[0]), bytes) == expected) && ok;
+	}
+	bench::reportBytes("istream::read push_back", bytes, timer.elapsed());
+
+	timer.reset();
+	{
+		int fd = open(path.c_str(), O_RDONLY);
+		ft::vector<Record> records;
+		records.append_from_fd(fd);
+		close(fd);
+		ok = (records.size() * sizeof(Record) == bytes
+			  && checksum(reinterpret_cast<char*>(&records[0]), bytes) == expected) && ok;
+	}
+	bench::reportBytes("append_from_fd", bytes, timer.elapsed());
+
+	std::remove(path.c_str());
+	if (!ok)
+	{
+		std::cout << "Error: loaded contents differ from the file" << std::endl;
+		return (1);
+	}
+	return (0);
+}
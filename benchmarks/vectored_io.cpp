@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:52 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <fcntl.h>
+
+#include "external_sort.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+#include "vectored_io.hpp"
+
+/* Writing a container to a file: copied into a staging buffer then write(), vs write_all() which
+   hands the container's own memory to writev(). A vector is a single segment, a map<long, long>
+   one segment per node. A map<int, long> has 4 bytes of padding per node, so write_all() packs
+   its keys and values into a buffer (12 bytes each) like the staging copy does.
+   The file lives in the page cache, so both pay the kernel's copy and only the staging copy
+   differs. ./run.sh vectored_io [vector bytes] [map entries] [directory]
+   (default 1G, 4M, /tmp, use /dev/shm if /tmp is slow to absorb 1GiB of dirty pages) */
+
+int openOutput(const std::string& path)
+{
+	int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+	if (fd < 0)
+		ft::external_sort_error("open " + path);
+	return (fd);
+}
+
+// Reads the file back and compares it with the expected bytes, then empties it
+bool checkOutput(int fd, const char* expected, size_t bytes)
+{
+	ft::vector<char> written;
+	bool ok;
+
+	lseek(fd, 0, SEEK_SET);
+	written.append_from_fd(fd);
+	ok = (written.size() == bytes && (bytes == 0 || std::memcmp(&written[0], expected, bytes) == 0));
+	if (ftruncate(fd, 0) < 0)
+		ft::external_sort_error("ftruncate");
+	lseek(fd, 0, SEEK_SET);
+	return (ok);
+}
+
+// Keys then values, without the padding between them
+template <class Map>
+void pack(const Map& map, char* out)
+{
+	for (typename Map::const_iterator it = map.begin(); it != map.end(); ++it)
+	{
+		std::memcpy(out, &it->first, sizeof(it->first));
+		out += sizeof(it->first);
+		std::memcpy(out, &it->second, sizeof(it->second));
+		out += sizeof(it->second);
+	}
+}
+
+template <class Map>
+bool benchMap(int fd, size_t entries, const std::string& title)
+{
+	typedef typename Map::key_type		key_type;
+	typedef typename Map::mapped_type	mapped_type;
+
+	Map map;
+	for (size_t i = 0; i < entries; ++i)
+		map.insert(map.end(), ft::make_pair((key_type)i, (mapped_type)i * 3));
+	const size_t mapBytes = entries * (sizeof(key_type) + sizeof(mapped_type));
+	ft::vector<char> expected(mapBytes);
+	pack(map, &expected[0]);
+	bool ok = true;
+
+	bench::header(title);
+	bench::Timer timer;
+	{
+		ft::vector<char> staging(mapBytes);
+		pack(map, &staging[0]);
+		ft::write_full(fd, &staging[0], mapBytes);
+	}
+	bench::reportBytes("copy then write()", mapBytes, timer.elapsed());
+	ok = checkOutput(fd, &expected[0], mapBytes) && ok;
+
+	timer.reset();
+	ok = (ft::write_all(fd, map) == mapBytes) && ok;
+	bench::reportBytes("write_all", mapBytes, timer.elapsed());
+	ok = checkOutput(fd, &expected[0], mapBytes) && ok;
+	return (ok);
+}
+
+int main(int argc, char** argv)
+{
+	const size_t bytes = (argc > 1) ? bench::parseBytes(argv[1]) : (size_t)1 << 30;
+	const size_t entries = (argc > 2) ? bench::parseCount(argv[2]) : 4000000;
+	const std::string path = std::string((argc > 3) ? argv[3] : "/tmp") + "/ft_vectored_io_bench";
+	int fd = openOutput(path);
+	bool ok = true;
+
+	{
+		ft::vector<char> data(bytes);
+		for (size_t i = 0; i < bytes; ++i)
+			data[i] = (char)(i * 13 + (i >> 16));
+
+		bench::header("ft::vector<char> to a file");
+		bench::Timer timer;
+		{
+			ft::vector<char> staging(data.begin(), data.end());
+			ft::write_full(fd, &staging[0], bytes);
+		}
+		bench::reportBytes("copy then write()", bytes, timer.elapsed());
+		ok = checkOutput(fd, &data[0], bytes) && ok;
+
+		timer.reset();
+		ft::write_all(fd, data);
+		bench::reportBytes("write_all (writev)", bytes, timer.elapsed());
+		ok = checkOutput(fd, &data[0], bytes) && ok;
+	}
+
+	ok = benchMap<ft::map<long, long> >(fd, entries, "ft::map<long, long> to a file") && ok;
+	ok = benchMap<ft::map<int, long> >(fd, entries, "ft::map<int, long> to a file (packed)") && ok;
+
+	close(fd);
+	std::remove(path.c_str());
+	if (!ok)
+	{
+		std::cout << "Error: file contents differ from the container" << std::endl;
+		return (1);
+	}
+	return (0);
+}
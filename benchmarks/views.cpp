@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:53 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+
+#include "map.hpp"
+#include "vector.hpp"
+#include "views.hpp"
+
+/* "Values of the map whose key is in a range, transformed, summed" and "even elements of a vector,
+   squared, first n": each stage materialized in an ft::vector vs the same pipeline as lazy views */
+
+#define REPEAT 10
+
+struct KeyInRange
+{
+	int low;
+	int high;
+
+	KeyInRange(int low, int high) : low(low), high(high) { }
+	bool operator()(const ft::pair<const int, double>& p) const { return (p.first >= this->low && p.first < this->high); }
+};
+
+struct Scale
+{
+	typedef double result_type;
+
+	double operator()(double x) const { return (x * 1.5 + 1.0); }
+};
+
+struct IsEven
+{
+	bool operator()(int x) const { return ((x & 1) == 0); }
+};
+
+struct Square
+{
+	typedef long long result_type;
+
+	long long operator()(int x) const { return (static_cast<long long>(x) * x); }
+};
+
+void benchMap(size_t n)
+{
+	typedef ft::map<int, double> map_type;
+
+	map_type map;
+	for (size_t i = 0; i < n; ++i)
+		map[static_cast<int>(i)] = static_cast<double>(std::rand() % 1000);
+	const KeyInRange inRange(static_cast<int>(n / 4), static_cast<int>(3 * n / 4));
+	double sums[2] = { 0, 0 };
+
+	bench::Timer timer;
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		ft::vector<ft::pair<int, double> > filtered;
+		for (map_type::const_iterator it = map.begin(); it != map.end(); ++it)
+			if (inRange(*it))
+				filtered.push_back(*it);
+		ft::vector<double> values;
+		for (size_t j = 0; j < filtered.size(); ++j)
+			values.push_back(filtered[j].second);
+		ft::vector<double> scaled;
+		for (size_t j = 0; j < values.size(); ++j)
+			scaled.push_back(Scale()(values[j]));
+		sums[0] = ft::reduce(scaled.begin(), scaled.end(), 0.0);
+	}
+	bench::report("map materialized", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+		sums[1] = ft::reduce(map | ft::views::filter(inRange) | ft::views::values() | ft::views::transform(Scale()), 0.0);
+	bench::report("map views", n * REPEAT, timer.elapsed());
+
+	if (sums[0] != sums[1])
+		std::cout << "Error: map pipelines disagree" << std::endl;
+}
+
+void benchVector(size_t n)
+{
+	ft::vector<int> vec(n);
+	for (size_t i = 0; i < n; ++i)
+		vec[i] = std::rand() % 100000;
+	const size_t taken = n / 4;
+	long long sums[2] = { 0, 0 };
+
+	bench::Timer timer;
+	for (int i = 0; i < REPEAT; ++i)
+	{
+		ft::vector<int> evens;
+		for (size_t j = 0; j < vec.size(); ++j)
+			if (IsEven()(vec[j]))
+				evens.push_back(vec[j]);
+		ft::vector<long long> squares;
+		for (size_t j = 0; j < evens.size(); ++j)
+			squares.push_back(Square()(evens[j]));
+		if (squares.size() > taken)
+			squares.resize(taken);
+		sums[0] = ft::reduce(squares.begin(), squares.end(), 0LL);
+	}
+	bench::report("vector materialized", n * REPEAT, timer.elapsed());
+
+	timer.reset();
+	for (int i = 0; i < REPEAT; ++i)
+		sums[1] = ft::reduce(vec | ft::views::filter(IsEven()) | ft::views::transform(Square()) | ft::views::take(taken), 0LL);
+	bench::report("vector views", n * REPEAT, timer.elapsed());
+
+	if (sums[0] != sums[1])
+		std::cout << "Error: vector pipelines disagree" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	const size_t max = (argc > 1) ? bench::parseCount(argv[1]) : 10000000;
+
+	bench::header("pipelines");
+	for (size_t n = 10000; n <= max; n *= 10)
+	{
+		if (n <= max / 10)
+			benchMap(n);
+		benchVector(n);
+	}
+	return (0);
+}
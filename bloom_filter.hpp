@@ -0,0 +1,418 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 07:12 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BLOOM_FILTER_HPP
+# define BLOOM_FILTER_HPP
+
+#include "map.hpp"
+#include "pairs.hpp"
+#include "sharded_map.hpp"
+#include "thread_pool.hpp"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <cstring>
+#include <new>
+
+/* Bits of a block: every key sets and tests bits in a single cache line */
+#define BLOOM_BLOCK_BITS (FT_CACHE_LINE_SIZE * 8)
+#define BLOOM_BLOCK_WORDS (BLOOM_BLOCK_BITS / 64)
+
+/* Bits of a hash indexing a bit in a block (log2 of BLOOM_BLOCK_BITS), and indexes taken from one hash */
+#define BLOOM_BIT_INDEX 9
+#define BLOOM_INDEXES_PER_HASH (64 / BLOOM_BIT_INDEX)
+
+/* Default false positive rate */
+#define BLOOM_DEFAULT_FPR 0.01
+
+/* Keys the filter of a filtered_map is sized for at first, it's rebuilt twice as big when outgrown */
+#define FILTERED_MAP_MIN_CAPACITY 1024
+
+/* Erased keys stay in the filter: once they outnumber this fraction of the keys left, the erase
+   rebuilds the filter */
+#define FILTERED_MAP_REBUILD_RATIO 0.5
+
+namespace ft
+{
+	/*
+		Blocked Bloom filter: a key hashes to one cache line sized block and sets k bits in it,
+		so an insert or a lookup touches a single cache line (a classic filter touches k of them).
+		Sized for a number of keys and a false positive rate, the rate grows past that many keys.
+		No false negatives: may_contain() is false only for keys never inserted. Keys can't be
+		removed, clear() or rebuild with the remaining ones.
+		Keys are hashed with Hash (ft::shard_hash by default), callers that already have a hash
+		use the _hash versions
+	*/
+	template <class Key, class Hash = ft::shard_hash<Key> >
+	class bloom_filter
+	{
+		public:
+			typedef Key		key_type;
+			typedef Hash	hasher;
+
+		private:
+			uint64_t*	_words; // _blocks blocks of BLOOM_BLOCK_WORDS words, cache line aligned
+			size_t		_blocks;
+			unsigned	_hashes;
+			size_t		_capacity;
+			double		_rate;
+			hasher		_hash;
+
+			// Spreads the bits of the hash (integral keys hash to a simple multiplication)
+			static uint64_t mix(uint64_t h)
+			{
+				h ^= h >> 33;
+				h *= 0xff51afd7ed558ccdULL;
+				h ^= h >> 33;
+				h *= 0xc4ceb9fe1a85ec53ULL;
+				return (h ^ (h >> 33));
+			}
+
+			// High bits pick the block (multiplied instead of a modulo), the bits in it come from more hashes
+			const uint64_t* blockOf(uint64_t h) const { return (this->_words + ((h >> 32) * this->_blocks >> 32) * BLOOM_BLOCK_WORDS); }
+
+			void allocate()
+			{
+				void* p = NULL;
+
+				if (posix_memalign(&p, FT_CACHE_LINE_SIZE, this->_blocks * BLOOM_BLOCK_WORDS * sizeof(uint64_t)) != 0)
+					throw (std::bad_alloc());
+				this->_words = static_cast<uint64_t*>(p);
+				std::memset(this->_words, 0, this->_blocks * BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+			}
+
+			// Expected rate of a blocked filter: keys per block follow a Poisson law of mean
+			// load, a miss is a positive when its k bits are set in a block of i keys
+			static double blockedRate(double load, unsigned hashes)
+			{
+				const double clear = std::log(1.0 - 1.0 / BLOOM_BLOCK_BITS) * hashes;
+				double poisson = std::exp(-load), rate = 0;
+
+				for (size_t i = 0; i < (size_t)(load + 10 * std::sqrt(load) + 10); ++i)
+				{
+					rate += poisson * std::pow(1.0 - std::exp(clear * i), (double)hashes);
+					poisson *= load / (i + 1);
+				}
+				return (rate);
+			}
+
+			// Classic sizing first, m / n = -ln(p) / ln(2)^2 bits per key and k = ln(2) * m / n, then
+			// more bits until the blocked rate gets down to p (some blocks are more crowded than others)
+			void plan(size_t capacity, double rate)
+			{
+				if (!(rate > 0 && rate < 1))
+					rate = BLOOM_DEFAULT_FPR;
+				double bitsPerKey = -std::log(rate) / (std::log(2.0) * std::log(2.0));
+				unsigned hashes = 1;
+
+				for (int i = 0; i < 64; ++i, bitsPerKey *= 1.05)
+				{
+					hashes = std::min(std::max((unsigned)(bitsPerKey * std::log(2.0) + 0.5), 1u), 16u);
+					if (blockedRate(BLOOM_BLOCK_BITS / bitsPerKey, hashes) <= rate)
+						break ;
+				}
+				this->_capacity = capacity;
+				this->_rate = rate;
+				this->_hashes = hashes;
+				this->_blocks = std::max((size_t)std::ceil(std::max((double)capacity, 1.0) * bitsPerKey / BLOOM_BLOCK_BITS), (size_t)1);
+			}
+
+		public:
+			explicit bloom_filter(size_t capacity = 0, double false_positive_rate = BLOOM_DEFAULT_FPR,
+								  const hasher& hash = hasher())
+			: _words(NULL), _hash(hash)
+			{
+				this->plan(capacity, false_positive_rate);
+				this->allocate();
+			}
+
+			bloom_filter(const bloom_filter& other)
+			: _words(NULL), _blocks(other._blocks), _hashes(other._hashes), _capacity(other._capacity),
+			  _rate(other._rate), _hash(other._hash)
+			{
+				this->allocate();
+				std::memcpy(this->_words, other._words, this->_blocks * BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+			}
+
+			bloom_filter& operator=(const bloom_filter& other)
+			{
+				if (this != &other)
+				{
+					bloom_filter copy(other);
+					this->swap(copy);
+				}
+				return (*this);
+			}
+
+			~bloom_filter() { free(this->_words); }
+
+			/***************** Keys *****************/
+
+			void insert(const key_type& k) { this->insert_hash(this->_hash(k)); }
+			bool may_contain(const key_type& k) const { return (this->may_contain_hash(this->_hash(k))); }
+
+			// The hash is remixed, any size_t hash of the key works
+			void insert_hash(size_t hash)
+			{
+				const uint64_t h = mix(hash);
+				uint64_t* block = const_cast<uint64_t*>(this->blockOf(h));
+				uint64_t bits = h;
+
+				for (unsigned i = 0; i < this->_hashes; ++i, bits >>= BLOOM_BIT_INDEX)
+				{
+					if (i % BLOOM_INDEXES_PER_HASH == 0)
+						bits = mix(h + i);
+					block[(bits % BLOOM_BLOCK_BITS) / 64] |= (uint64_t)1 << (bits % 64);
+				}
+			}
+
+			bool may_contain_hash(size_t hash) const
+			{
+				const uint64_t h = mix(hash);
+				const uint64_t* block = this->blockOf(h);
+				uint64_t bits = h;
+
+				for (unsigned i = 0; i < this->_hashes; ++i, bits >>= BLOOM_BIT_INDEX)
+				{
+					if (i % BLOOM_INDEXES_PER_HASH == 0)
+						bits = mix(h + i);
+					if (!(block[(bits % BLOOM_BLOCK_BITS) / 64] & ((uint64_t)1 << (bits % 64))))
+						return (false);
+				}
+				return (true);
+			}
+
+			void clear() { std::memset(this->_words, 0, this->_blocks * BLOOM_BLOCK_WORDS * sizeof(uint64_t)); }
+
+			void swap(bloom_filter& other)
+			{
+				std::swap(this->_words, other._words);
+				std::swap(this->_blocks, other._blocks);
+				std::swap(this->_hashes, other._hashes);
+				std::swap(this->_capacity, other._capacity);
+				std::swap(this->_rate, other._rate);
+				std::swap(this->_hash, other._hash);
+			}
+
+			/***************** Sizes *****************/
+
+			// Keys it was sized for, and the false positive rate expected with that many
+			size_t capacity() const { return (this->_capacity); }
+			double false_positive_rate() const { return (this->_rate); }
+
+			unsigned hash_count() const { return (this->_hashes); }
+			size_t bit_count() const { return (this->_blocks * BLOOM_BLOCK_BITS); }
+			size_t memory_usage() const { return (this->_blocks * BLOOM_BLOCK_WORDS * sizeof(uint64_t)); }
+	};
+
+	/*
+		ft::map with a bloom_filter in front: find() and count() of a missing key usually stop at
+		the filter instead of walking the tree. Worth it when many lookups miss, a hit pays
+		for the filter on top of the tree.
+		The filter is kept up to date on insert and doubled when outgrown. Erased keys can't
+		leave it, so it's rebuilt from the keys left once they are many (by the erase crossing
+		FILTERED_MAP_REBUILD_RATIO, amortized over the erases before it). Const lookups only read,
+		so threads can run them at the same time, as on an ft::map.
+		Elements are changed through the wrapper only, map() is read only
+	*/
+	template <class Key,
+			  class T,
+			  class Compare = std::less<Key>,
+			  class Alloc = std::allocator<ft::pair<const Key, T> >,
+			  class Hash = ft::shard_hash<Key> >
+	class filtered_map
+	{
+		public:
+			typedef ft::map<Key, T, Compare, Alloc>		map_type;
+			typedef ft::bloom_filter<Key, Hash>			filter_type;
+
+			typedef typename map_type::key_type			key_type;
+			typedef typename map_type::mapped_type		mapped_type;
+			typedef typename map_type::value_type		value_type;
+			typedef typename map_type::key_compare		key_compare;
+			typedef typename map_type::allocator_type	allocator_type;
+			typedef typename map_type::iterator			iterator;
+			typedef typename map_type::const_iterator	const_iterator;
+			typedef typename map_type::size_type		size_type;
+
+		private:
+			map_type			_map;
+			filter_type			_filter;
+			size_type			_size; // map::size() walks the tree
+			size_type			_erased; // Erased keys still in the filter
+			double				_rate;
+
+			// Sized for twice the keys, to take some inserts before growing again
+			// Same capacity: the filter is cleared and keeps its blocks and sizing
+			void rebuildFilter(size_type capacity)
+			{
+				capacity = std::max(capacity, (size_type)FILTERED_MAP_MIN_CAPACITY);
+				if (capacity == this->_filter.capacity())
+					this->_filter.clear();
+				else
+				{
+					filter_type filter(capacity, this->_rate);
+					this->_filter.swap(filter);
+				}
+				for (const_iterator it = this->_map.begin(); it != this->_map.end(); ++it)
+					this->_filter.insert(it->first);
+				this->_erased = 0;
+			}
+
+			/* Erased keys only use up capacity that would be idle while the filter holds less than
+			   half of it, so they count against at least that half. The filter shrinks only once
+			   the keys fill less than a quarter of it */
+			void removed()
+			{
+				const size_type capacity = this->_filter.capacity();
+
+				--this->_size;
+				if (++this->_erased > FILTERED_MAP_REBUILD_RATIO * std::max(this->_size, capacity / 2))
+					this->rebuildFilter(this->_size * 4 < capacity ? this->_size * 2 : capacity);
+			}
+
+			void added(const key_type& k)
+			{
+				++this->_size;
+				if (this->_size + this->_erased > this->_filter.capacity())
+					this->rebuildFilter(this->_size * 2);
+				else
+					this->_filter.insert(k);
+			}
+
+		public:
+			explicit filtered_map(double false_positive_rate = BLOOM_DEFAULT_FPR,
+								  const key_compare& comp = key_compare(),
+								  const allocator_type& alloc = allocator_type())
+			: _map(comp, alloc), _filter(FILTERED_MAP_MIN_CAPACITY, false_positive_rate), _size(0), _erased(0),
+			  _rate(false_positive_rate) { }
+
+			template <class InputIterator>
+			filtered_map(InputIterator first, InputIterator last, double false_positive_rate = BLOOM_DEFAULT_FPR,
+						 const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+			: _map(first, last, comp, alloc), _filter(FILTERED_MAP_MIN_CAPACITY, false_positive_rate), _size(0),
+			  _erased(0), _rate(false_positive_rate)
+			{
+				this->_size = this->_map.size();
+				this->rebuildFilter(this->_size * 2);
+			}
+
+			/********** Iterators **********/
+			iterator		begin() { return (this->_map.begin()); }
+			const_iterator	begin() const { return (this->_map.begin()); }
+
+			iterator		end() { return (this->_map.end()); }
+			const_iterator	end() const { return (this->_map.end()); }
+
+			/********** Capacity **********/
+			bool empty() const { return (this->_size == 0); }
+			size_type size() const { return (this->_size); }
+
+			/********** Modifiers **********/
+			ft::pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::pair<iterator, bool> ret = this->_map.insert(val);
+
+				if (ret.second)
+					this->added(val.first);
+				return (ret);
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{
+				while (first != last)
+				{
+					this->insert(*first);
+					++first;
+				}
+			}
+
+			mapped_type& operator[](const key_type& k)
+			{ return ((this->insert(ft::make_pair(k, mapped_type())).first)->second); }
+
+			size_type erase(const key_type& k)
+			{
+				if (!this->_filter.may_contain(k) || this->_map.erase(k) == 0)
+					return (0);
+				this->removed();
+				return (1);
+			}
+
+			void erase(iterator position)
+			{
+				this->_map.erase(position);
+				this->removed();
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				while (first != last)
+					this->erase(first++);
+			}
+
+			void swap(filtered_map& x)
+			{
+				this->_map.swap(x._map);
+				this->_filter.swap(x._filter);
+				std::swap(this->_size, x._size);
+				std::swap(this->_erased, x._erased);
+				std::swap(this->_rate, x._rate);
+			}
+
+			void clear()
+			{
+				this->_map.clear();
+				this->_size = 0;
+				this->rebuildFilter(0);
+			}
+
+			/********** Operations **********/
+			iterator find(const key_type& k)
+			{
+				if (!this->_filter.may_contain(k))
+					return (this->end());
+				return (this->_map.find(k));
+			}
+
+			const_iterator find(const key_type& k) const
+			{
+				if (!this->_filter.may_contain(k))
+					return (this->end());
+				return (this->_map.find(k));
+			}
+
+			size_type count(const key_type& k) const
+			{
+				if (!this->_filter.may_contain(k))
+					return (0);
+				return (this->_map.count(k));
+			}
+
+			// Drops the erased keys from the filter now, before FILTERED_MAP_REBUILD_RATIO is reached
+			void rebuild_filter() { this->rebuildFilter(this->_size * 2); }
+
+			/********** Observers **********/
+			const map_type& map() const { return (this->_map); }
+			const filter_type& filter() const { return (this->_filter); }
+			key_compare key_comp() const { return (this->_map.key_comp()); }
+	};
+
+	template <class Key, class T, class Compare, class Alloc, class Hash>
+	void swap(filtered_map<Key, T, Compare, Alloc, Hash>& x, filtered_map<Key, T, Compare, Alloc, Hash>& y)
+	{ x.swap(y); }
+}
+
+#endif
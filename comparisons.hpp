@@ -6,20 +6,45 @@
 /*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
 /*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
 /*   Created: 05-03-2022  by  `-'                        `-'                  */
-/*   Updated: 17-03-2022 13:58 by                                             */
+/*   Updated: 18-10-2026 04:28 by                                             */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef COMPARISONS_HPP
 # define COMPARISONS_HPP
 
+#include "iterators.hpp"
+#include "is_integral.hpp"
+#include "utils.hpp"
+#include "simd.hpp"
+
+#include <cstring>
+#include <limits>
+
 namespace ft
 {
+	/* Both ranges are contiguous memory holding the same integral type: two ranges are equal
+	   if and only if their bytes are, so they can be compared as raw memory.
+	   Not for floating types, 0.0 == -0.0 and NaN != NaN have different bits. */
+	template <class Iterator1, class Iterator2>
+	struct is_bitwise_comparable
+	{
+		typedef typename ft::remove_const<typename ft::iterator_traits<Iterator1>::value_type>::type value_type;
+
+		static const bool value = ft::is_contiguous_iterator<Iterator1>::value
+								  && ft::is_contiguous_iterator<Iterator2>::value
+								  && ft::is_same<value_type,
+												 typename ft::remove_const<typename ft::iterator_traits<Iterator2>::value_type>::type>::value
+								  && ft::is_integral<value_type>::value;
+
+		typedef typename ft::choose<value, ft::true_type, ft::false_type>::type type;
+	};
+
 	// Ranges are almost always [first, last), which means first included, last excluded
 	// "Default" version simply uses operator ==, typically only required operators are == and < for any comparisons
 	template <class InputIterator1, class InputIterator2>
-	bool equal(InputIterator1 first1, InputIterator1 last1,
-			   InputIterator2 first2)
+	bool equal_dispatch(InputIterator1 first1, InputIterator1 last1,
+						InputIterator2 first2, ft::false_type)
 	{
 		while (first1 != last1)
 		{
@@ -31,6 +56,26 @@ namespace ft
 		return (true);
 	}
 
+	// Contiguous integral version, memcmp is already vectorized by the libc
+	template <class InputIterator1, class InputIterator2>
+	bool equal_dispatch(InputIterator1 first1, InputIterator1 last1,
+						InputIterator2 first2, ft::true_type)
+	{
+		const size_t n = last1 - first1;
+
+		if (n == 0)
+			return (true);
+		return (std::memcmp(ft::to_address(first1), ft::to_address(first2), n * sizeof(*first1)) == 0);
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool equal(InputIterator1 first1, InputIterator1 last1,
+			   InputIterator2 first2)
+	{
+		return (ft::equal_dispatch(first1, last1, first2,
+								   typename ft::is_bitwise_comparable<InputIterator1, InputIterator2>::type()));
+	}
+
 	/* A predicate is a function returning a boolean / if the member has a bool operator() overload
 	   which is used in cases like if (i), if (ptr) etc. to return true or false.
 	   A binary predicate takes two arguments and unary takes one, in this case a simple
@@ -55,8 +100,8 @@ namespace ft
 	   In case they are equal, the shortest one is considered smaller, if they are both
 	   the exact same, return false */
 	template <class InputIterator1, class InputIterator2>
-	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
-    							  InputIterator2 first2, InputIterator2 last2)
+	bool lexicographical_compare_dispatch(InputIterator1 first1, InputIterator1 last1,
+										  InputIterator2 first2, InputIterator2 last2, ft::false_type)
 	{
 		while ((first1 != last1) && (first2 != last2))
 		{
@@ -70,6 +115,49 @@ namespace ft
 		return (first1 == last1 && first2 != last2); /* If first1 is shorter, return true, since they are equal but first2 is longer */
 	}
 
+	/* Contiguous integral version. memcmp orders like unsigned bytes, which is the element order
+	   only for unsigned char sized types. For the others (signed, or little endian words whose
+	   first differing byte is not the most significant), a SIMD scan finds the first differing byte,
+	   and the element holding it decides */
+	template <class InputIterator1, class InputIterator2>
+	bool lexicographical_compare_dispatch(InputIterator1 first1, InputIterator1 last1,
+										  InputIterator2 first2, InputIterator2 last2, ft::true_type)
+	{
+		typedef typename ft::is_bitwise_comparable<InputIterator1, InputIterator2>::value_type value_type;
+
+		const size_t n1 = last1 - first1;
+		const size_t n2 = last2 - first2;
+		const size_t n = (n1 < n2) ? n1 : n2;
+
+		if (n == 0)
+			return (n1 < n2);
+
+		const value_type* a = ft::to_address(first1);
+		const value_type* b = ft::to_address(first2);
+
+		if (sizeof(value_type) == 1 && !std::numeric_limits<value_type>::is_signed)
+		{
+			int diff = std::memcmp(a, b, n);
+			if (diff != 0)
+				return (diff < 0);
+			return (n1 < n2);
+		}
+
+		size_t offset = ft::simd_mismatch(reinterpret_cast<const unsigned char*>(a),
+										  reinterpret_cast<const unsigned char*>(b), n * sizeof(value_type));
+		if (offset == n * sizeof(value_type))
+			return (n1 < n2);
+		return (a[offset / sizeof(value_type)] < b[offset / sizeof(value_type)]);
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
+    							  InputIterator2 first2, InputIterator2 last2)
+	{
+		return (ft::lexicographical_compare_dispatch(first1, last1, first2, last2,
+													 typename ft::is_bitwise_comparable<InputIterator1, InputIterator2>::type()));
+	}
+
 	/* Same with a predicate, comp should return true if first argument is smaller than second */
 	template <class InputIterator1, class InputIterator2, class BinaryPredicate>
 	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
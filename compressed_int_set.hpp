@@ -0,0 +1,476 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 07:14 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMPRESSED_INT_SET_HPP
+# define COMPRESSED_INT_SET_HPP
+
+#include "iterators.hpp"
+#include "radix_sort.hpp"
+#include "simd.hpp"
+#include "vector.hpp"
+
+#include <stdint.h>
+#include <cstring>
+#include <stdexcept>
+
+// Values per block, a multiple of the 4 lanes of a 128 bits register
+#define COMPRESSED_INT_SET_BLOCK 128
+
+namespace ft
+{
+	/*******************************************************
+	 *               Block packing / unpacking             *
+	 *******************************************************/
+
+	/* A block of COMPRESSED_INT_SET_BLOCK sorted values is stored as the differences between each
+	   value and the one 4 places before it (the first 4 from the first value of the block, which is
+	   kept aside), all with the bit width of the biggest one. They are packed in 4 interleaved
+	   lanes: value i goes to lane i % 4, each lane is a stream of bits, and word k of a lane is
+	   word 4 * k + lane of the block. So a 128 bits load holds the same bits of 4 consecutive
+	   values, and decoding is a shift, a mask and an add of the previous 4 values, 4 at a time
+	   (the SIMD-BP128 layout with 4 wide deltas). A block takes 4 * bits words */
+
+	inline unsigned compressed_bit_width(uint32_t value) { return (value ? 32 - __builtin_clz(value) : 0); }
+
+	// Deltas of values[0..128) packed in words[0..4 * bits), which must be zeroed
+	inline void compressed_pack(const uint32_t* deltas, unsigned bits, uint32_t* words)
+	{
+		for (unsigned lane = 0; lane < 4; ++lane)
+		{
+			unsigned position = 0;
+			for (unsigned i = lane; i < COMPRESSED_INT_SET_BLOCK; i += 4, position += bits)
+			{
+				const unsigned word = position / 32;
+				const unsigned shift = position % 32;
+				words[4 * word + lane] |= deltas[i] << shift;
+				if (shift + bits > 32)
+					words[4 * (word + 1) + lane] |= deltas[i] >> (32 - shift);
+			}
+		}
+	}
+
+	// Portable version, the same work one lane at a time
+	inline void compressed_unpack_scalar(const uint32_t* words, unsigned bits, uint32_t first, uint32_t* out)
+	{
+		const uint32_t mask = (bits == 32) ? 0xffffffffu : ((uint32_t)1 << bits) - 1;
+
+		for (unsigned lane = 0; lane < 4; ++lane)
+		{
+			uint32_t previous = first;
+			unsigned position = 0;
+			for (unsigned i = lane; i < COMPRESSED_INT_SET_BLOCK; i += 4, position += bits)
+			{
+				const unsigned word = position / 32;
+				const unsigned shift = position % 32;
+				uint32_t delta = 0;
+				if (bits != 0)
+				{
+					delta = words[4 * word + lane] >> shift;
+					if (shift + bits > 32)
+						delta |= words[4 * (word + 1) + lane] << (32 - shift);
+				}
+				previous += delta & mask;
+				out[i] = previous;
+			}
+		}
+	}
+
+#if FT_SIMD_X86
+	// 4 values per iteration, the shift counts are the same for the 4 lanes
+	inline void compressed_unpack_sse2(const uint32_t* words, unsigned bits, uint32_t first, uint32_t* out)
+	{
+		const __m128i mask = _mm_set1_epi32((bits == 32) ? -1 : (int)(((uint32_t)1 << bits) - 1));
+		__m128i previous = _mm_set1_epi32((int)first);
+		unsigned position = 0;
+
+		if (bits == 0)
+		{
+			for (unsigned i = 0; i < COMPRESSED_INT_SET_BLOCK; i += 4)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), previous);
+			return ;
+		}
+		for (unsigned i = 0; i < COMPRESSED_INT_SET_BLOCK; i += 4, position += bits)
+		{
+			const unsigned word = position / 32;
+			const unsigned shift = position % 32;
+			__m128i delta = _mm_srl_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(words + 4 * word)),
+										  _mm_cvtsi32_si128(shift));
+			if (shift + bits > 32)
+				delta = _mm_or_si128(delta, _mm_sll_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(words + 4 * word + 4)),
+														  _mm_cvtsi32_si128(32 - shift)));
+			previous = _mm_add_epi32(previous, _mm_and_si128(delta, mask));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), previous);
+		}
+	}
+#endif
+
+	// Decodes a whole block in out[0..COMPRESSED_INT_SET_BLOCK)
+	inline void compressed_unpack(const uint32_t* words, unsigned bits, uint32_t first, uint32_t* out)
+	{
+#if FT_SIMD_X86
+		compressed_unpack_sse2(words, bits, first, out);
+#else
+		compressed_unpack_scalar(words, bits, first, out);
+#endif
+	}
+
+	/*******************************************************
+	 *                  compressed_int_set                 *
+	 *******************************************************/
+
+	/*
+		Sorted set of uint32_t (eg. document ids of a posting list) in about bits / 8 bytes per
+		value, bits being the width of the gaps between values 4 apart, instead of a node per
+		value for ft::set. Values are in blocks of COMPRESSED_INT_SET_BLOCK (see above), with a skip
+		index of the first and last value of each block, so a lookup is a binary search in the
+		index and the decoding of one block. The last values, until they fill a block, are kept
+		as they are.
+		Built from a range (any order, duplicates ignored) or by appending increasing values
+		with push_back, there is no insert / erase in the middle.
+		Iterators are forward and const, each holds its decoded block: copy them sparingly
+	*/
+	class compressed_int_set
+	{
+		public:
+			typedef uint32_t	value_type;
+			typedef uint32_t	key_type;
+			typedef size_t		size_type;
+
+			class const_iterator
+			{
+				public:
+					typedef ft::forward_iterator_tag	iterator_category;
+					typedef const uint32_t				value_type;
+					typedef ptrdiff_t					difference_type;
+					typedef value_type*					pointer;
+					typedef value_type&					reference;
+
+				private:
+					const compressed_int_set*	_set;
+					size_t						_block;
+					unsigned					_index;
+					unsigned					_count;
+					uint32_t					_values[COMPRESSED_INT_SET_BLOCK];
+
+					friend class compressed_int_set;
+
+					// Decodes _block, skipping to the end past the last one
+					void load()
+					{
+						if (this->_block < this->_set->blockCount())
+							this->_count = this->_set->decodeBlock(this->_block, this->_values);
+						else
+						{
+							this->_block = this->_set->blockCount();
+							this->_count = 0;
+						}
+						this->_index = 0;
+					}
+
+				public:
+					const_iterator() : _set(NULL), _block(0), _index(0), _count(0) { }
+					const_iterator(const compressed_int_set* set, size_t block) : _set(set), _block(block) { this->load(); }
+
+					reference operator*() const { return (this->_values[this->_index]); }
+					pointer operator->() const { return (&this->_values[this->_index]); }
+
+					const_iterator& operator++()
+					{
+						if (++this->_index == this->_count)
+						{
+							++this->_block;
+							this->load();
+						}
+						return (*this);
+					}
+
+					const_iterator operator++(int) { const_iterator tmp(*this); ++(*this); return (tmp); }
+
+					bool operator==(const const_iterator& rhs) const { return (this->_block == rhs._block && this->_index == rhs._index); }
+					bool operator!=(const const_iterator& rhs) const { return (!(*this == rhs)); }
+			};
+
+			typedef const_iterator	iterator;
+
+		private:
+			ft::vector<uint32_t>		_firsts; // Skip index, first and last value of each block
+			ft::vector<uint32_t>		_lasts;
+			ft::vector<uint32_t>		_offsets; // Where each block starts in _words
+			ft::vector<unsigned char>	_bits;
+			ft::vector<uint32_t>		_words;
+			ft::vector<uint32_t>		_tail; // Values after the last block, fewer than a block
+			size_type					_size;
+
+			// Index of the first of values[0..n) not less than value, or n
+			static size_t lowerBound(const uint32_t* values, size_t n, uint32_t value)
+			{
+				size_t low = 0;
+
+				while (n > 0)
+				{
+					size_t half = n / 2;
+					if (values[low + half] < value)
+					{
+						low += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return (low);
+			}
+
+			// Blocks, counting the tail as the last one
+			size_t blockCount() const { return (this->_firsts.size() + !this->_tail.empty()); }
+
+			bool isTail(size_t block) const { return (block == this->_firsts.size()); }
+
+			uint32_t blockFirst(size_t block) const { return (this->isTail(block) ? this->_tail[0] : this->_firsts[block]); }
+			uint32_t blockLast(size_t block) const { return (this->isTail(block) ? this->_tail.back() : this->_lasts[block]); }
+
+			// Writes the values of block in out, returns how many there are
+			unsigned decodeBlock(size_t block, uint32_t* out) const
+			{
+				if (this->isTail(block))
+				{
+					std::memcpy(out, &this->_tail[0], this->_tail.size() * sizeof(uint32_t));
+					return (this->_tail.size());
+				}
+				const uint32_t* words = (this->_words.empty()) ? NULL : &this->_words[0] + this->_offsets[block];
+				ft::compressed_unpack(words, this->_bits[block], this->_firsts[block], out);
+				return (COMPRESSED_INT_SET_BLOCK);
+			}
+
+			// First block whose last value is not less than value, blockCount() if none
+			size_t findBlock(uint32_t value) const
+			{
+				const size_t block = this->nextBlock(0, value);
+
+				if (block == this->_lasts.size() && !this->_tail.empty() && this->_tail.back() < value)
+					return (block + 1);
+				return (block);
+			}
+
+			// Same among the packed blocks from block on, the tail's index if none
+			size_t nextBlock(size_t block, uint32_t value) const
+			{
+				const size_t blocks = this->_lasts.size();
+
+				if (block >= blocks)
+					return (block);
+				return (block + lowerBound(&this->_lasts[block], blocks - block, value));
+			}
+
+			// The tail is full, packs it as a new block
+			void packTail()
+			{
+				uint32_t	deltas[COMPRESSED_INT_SET_BLOCK];
+				uint32_t	all = 0;
+				const uint32_t*	values = &this->_tail[0];
+
+				for (unsigned i = 0; i < COMPRESSED_INT_SET_BLOCK; ++i)
+				{
+					deltas[i] = values[i] - values[(i < 4) ? 0 : i - 4];
+					all |= deltas[i];
+				}
+				const unsigned bits = ft::compressed_bit_width(all);
+				const size_t offset = this->_words.size();
+				if (offset + 4 * bits > this->_words.capacity()) // resize() alone would grow to the exact size
+					this->_words.reserve(std::max(offset + 4 * bits, 2 * this->_words.capacity()));
+				this->_words.resize(offset + 4 * bits, 0);
+				if (bits != 0)
+					ft::compressed_pack(deltas, bits, &this->_words[offset]);
+				this->_firsts.push_back(values[0]);
+				this->_lasts.push_back(values[COMPRESSED_INT_SET_BLOCK - 1]);
+				this->_offsets.push_back(offset);
+				this->_bits.push_back(bits);
+				this->_tail.clear();
+			}
+
+			// Copies to drop the capacity left by push_back doubling
+			void shrink()
+			{
+				ft::vector<uint32_t>(this->_firsts).swap(this->_firsts);
+				ft::vector<uint32_t>(this->_lasts).swap(this->_lasts);
+				ft::vector<uint32_t>(this->_offsets).swap(this->_offsets);
+				ft::vector<unsigned char>(this->_bits).swap(this->_bits);
+				ft::vector<uint32_t>(this->_words).swap(this->_words);
+			}
+
+			friend class const_iterator;
+
+		public:
+			compressed_int_set() : _size(0) { }
+
+			// Values in any order, duplicates are ignored
+			template <class InputIterator>
+			compressed_int_set(InputIterator first, InputIterator last) : _size(0)
+			{
+				ft::vector<uint32_t> values;
+
+				for (; first != last; ++first)
+					values.push_back(*first);
+				if (!values.empty())
+					ft::radix_sort(values.begin(), values.end());
+				for (size_t i = 0; i < values.size(); ++i)
+					if (i == 0 || values[i] != values[i - 1])
+						this->push_back(values[i]);
+				this->shrink();
+			}
+
+			const_iterator begin() const { return (const_iterator(this, 0)); }
+			const_iterator end() const { return (const_iterator(this, this->blockCount())); }
+
+			size_type size() const { return (this->_size); }
+			bool empty() const { return (this->_size == 0); }
+
+			// Biggest value, the set must not be empty
+			uint32_t back() const { return (this->_tail.empty() ? this->_lasts.back() : this->_tail.back()); }
+
+			// Appends a value bigger than all the others
+			void push_back(uint32_t value)
+			{
+				if (this->_size != 0 && value <= this->back())
+					throw (std::invalid_argument("compressed_int_set::push_back: values must be increasing"));
+				if (this->_tail.capacity() < COMPRESSED_INT_SET_BLOCK)
+					this->_tail.reserve(COMPRESSED_INT_SET_BLOCK);
+				this->_tail.push_back(value);
+				++this->_size;
+				if (this->_tail.size() == COMPRESSED_INT_SET_BLOCK)
+					this->packTail();
+			}
+
+			bool contains(uint32_t value) const
+			{
+				uint32_t		values[COMPRESSED_INT_SET_BLOCK];
+				const size_t	block = this->findBlock(value);
+
+				if (block >= this->blockCount() || value < this->blockFirst(block))
+					return (false);
+				if (this->isTail(block))
+				{
+					size_t i = lowerBound(&this->_tail[0], this->_tail.size(), value);
+					return (this->_tail[i] == value);
+				}
+				this->decodeBlock(block, values);
+				return (values[lowerBound(values, COMPRESSED_INT_SET_BLOCK, value)] == value);
+			}
+
+			size_type count(uint32_t value) const { return (this->contains(value)); }
+
+			// First value not less than value
+			const_iterator lower_bound(uint32_t value) const
+			{
+				const_iterator it(this, this->findBlock(value));
+
+				it._index = lowerBound(it._values, it._count, value);
+				return (it);
+			}
+
+			void clear()
+			{
+				this->_firsts.clear();
+				this->_lasts.clear();
+				this->_offsets.clear();
+				this->_bits.clear();
+				this->_words.clear();
+				this->_tail.clear();
+				this->_size = 0;
+			}
+
+			void swap(compressed_int_set& other)
+			{
+				this->_firsts.swap(other._firsts);
+				this->_lasts.swap(other._lasts);
+				this->_offsets.swap(other._offsets);
+				this->_bits.swap(other._bits);
+				this->_words.swap(other._words);
+				this->_tail.swap(other._tail);
+				size_type tmp = this->_size;
+				this->_size = other._size;
+				other._size = tmp;
+			}
+
+			// Bytes allocated for the values and the index
+			size_t memory_usage() const
+			{
+				return (sizeof(*this) + (this->_firsts.capacity() + this->_lasts.capacity() + this->_offsets.capacity()
+										 + this->_words.capacity() + this->_tail.capacity()) * sizeof(uint32_t)
+						+ this->_bits.capacity());
+			}
+
+			/* Values in both a and b. Blocks that can't overlap (told by the skip index) are passed
+			   without being decoded, the others are decoded once each and merged */
+			friend compressed_int_set intersection(const compressed_int_set& a, const compressed_int_set& b)
+			{
+				compressed_int_set	result;
+				uint32_t			valuesA[COMPRESSED_INT_SET_BLOCK];
+				uint32_t			valuesB[COMPRESSED_INT_SET_BLOCK];
+				size_t				blockA = 0, blockB = 0;
+				size_t				decodedA = (size_t)-1, decodedB = (size_t)-1;
+				unsigned			countA = 0, countB = 0;
+				const size_t		blocksA = a.blockCount(), blocksB = b.blockCount();
+
+				while (blockA < blocksA && blockB < blocksB)
+				{
+					if (a.blockLast(blockA) < b.blockFirst(blockB))
+					{
+						blockA = a.nextBlock(blockA + 1, b.blockFirst(blockB));
+						continue ;
+					}
+					if (b.blockLast(blockB) < a.blockFirst(blockA))
+					{
+						blockB = b.nextBlock(blockB + 1, a.blockFirst(blockA));
+						continue ;
+					}
+					if (decodedA != blockA)
+					{
+						countA = a.decodeBlock(blockA, valuesA);
+						decodedA = blockA;
+					}
+					if (decodedB != blockB)
+					{
+						countB = b.decodeBlock(blockB, valuesB);
+						decodedB = blockB;
+					}
+					// Merge, the part of a block past the other one is merged again with the next block
+					for (unsigned i = 0, j = 0; i < countA && j < countB; )
+					{
+						if (valuesA[i] < valuesB[j])
+							++i;
+						else if (valuesB[j] < valuesA[i])
+							++j;
+						else
+						{
+							result.push_back(valuesA[i]);
+							++i;
+							++j;
+						}
+					}
+					if (a.blockLast(blockA) < b.blockLast(blockB))
+						++blockA;
+					else if (b.blockLast(blockB) < a.blockLast(blockA))
+						++blockB;
+					else
+					{
+						++blockA;
+						++blockB;
+					}
+				}
+				return (result);
+			}
+	};
+
+	inline void swap(compressed_int_set& x, compressed_int_set& y) { x.swap(y); }
+}
+
+#endif
@@ -0,0 +1,249 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 07:14 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_QUEUE_HPP
+# define CONCURRENT_QUEUE_HPP
+
+#include <memory>
+#include <sched.h>
+
+#include "thread_pool.hpp"
+
+/* Failed tries of push() / pop() before they start yielding the CPU between tries */
+#define CONCURRENT_QUEUE_SPINS 64
+
+namespace ft
+{
+	/*
+		Bounded multi-producer multi-consumer FIFO queue, lock-free (Dmitry Vyukov's design).
+
+		Every cell has a sequence number telling who may use it: for the turn pos (a push or
+		pop counter), the cell pos & mask is free for a producer when its sequence is pos, and
+		holds a value for a consumer when it's pos + 1. A producer claims the turn with a compare
+		and swap on the push counter, writes the value, then publishes it by setting the
+		sequence to pos + 1. The consumer of that turn sets it back to pos + capacity once it
+		has read it, freeing the cell for the producer of the next lap. Producers and consumers
+		only share the cells, each side has its counter on its own cache line.
+
+		The bulk versions claim several consecutive turns with a single compare and swap.
+		Copies of T must not throw: a claimed turn can't be given back.
+	*/
+	template <class T, class Allocator = std::allocator<T> >
+	class concurrent_queue
+	{
+		public:
+			typedef T				value_type;
+			typedef Allocator		allocator_type;
+			typedef size_t			size_type;
+
+		private:
+			struct cell
+			{
+				size_t	sequence;
+				char	value[sizeof(T)] __attribute__((aligned(__alignof__(T))));
+			};
+
+			typedef typename Allocator::template rebind<cell>::other	cell_allocator;
+
+			// Read only once constructed, shared by everyone without bouncing
+			char			_frontPad[FT_CACHE_LINE_SIZE];
+			cell*			_cells;
+			size_t			_mask;
+			cell_allocator	_alloc;
+			char			_cellsPad[FT_CACHE_LINE_SIZE];
+			size_t			_pushPos;
+			char			_pushPad[FT_CACHE_LINE_SIZE - sizeof(size_t)];
+			size_t			_popPos;
+			char			_popPad[FT_CACHE_LINE_SIZE - sizeof(size_t)];
+
+			// Not copyable, threads may be using it
+			concurrent_queue(const concurrent_queue&);
+			concurrent_queue& operator=(const concurrent_queue&);
+
+			T* valueOf(cell& c) { return (reinterpret_cast<T*>(c.value)); }
+
+			static size_t roundCapacity(size_t capacity)
+			{
+				size_t rounded = 2; // A single cell can't tell full from empty
+
+				while (rounded < capacity)
+					rounded <<= 1;
+				return (rounded);
+			}
+
+			/* Claims up to max consecutive turns of counter, those whose cell sequence is turn + offset
+			   (offset 0: free cells for producers, 1: full cells for consumers). Returns how many
+			   were claimed, the first one in pos */
+			size_t claim(size_t* counter, size_t offset, size_t max, size_t& pos)
+			{
+				pos = __atomic_load_n(counter, __ATOMIC_RELAXED);
+				while (true)
+				{
+					size_t count = 0;
+
+					while (count < max && count <= this->_mask)
+					{
+						const cell& c = this->_cells[(pos + count) & this->_mask];
+						const size_t sequence = __atomic_load_n(&c.sequence, __ATOMIC_ACQUIRE);
+						const long diff = static_cast<long>(sequence - (pos + count + offset));
+
+						if (diff == 0)
+							++count;
+						else if (diff < 0 || count != 0)
+							break;
+						else // Someone else got this turn, try again from the current counter
+						{
+							count = static_cast<size_t>(-1);
+							break;
+						}
+					}
+					if (count == static_cast<size_t>(-1))
+						pos = __atomic_load_n(counter, __ATOMIC_RELAXED);
+					else if (count == 0) // Full (producers) / empty (consumers)
+						return (0);
+					else if (__atomic_compare_exchange_n(counter, &pos, pos + count, true,
+														 __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+						return (count);
+				}
+			}
+
+			void publish(size_t pos, const T& val)
+			{
+				cell& c = this->_cells[pos & this->_mask];
+
+				::new (static_cast<void*>(c.value)) T(val);
+				__atomic_store_n(&c.sequence, pos + 1, __ATOMIC_RELEASE);
+			}
+
+			template <class Output>
+			void consume(size_t pos, Output& out)
+			{
+				cell& c = this->_cells[pos & this->_mask];
+				T* val = this->valueOf(c);
+
+				*out = *val;
+				val->~T();
+				__atomic_store_n(&c.sequence, pos + this->_mask + 1, __ATOMIC_RELEASE);
+			}
+
+			static void backoff(size_t& tries)
+			{
+				if (++tries < CONCURRENT_QUEUE_SPINS)
+					ft::cpu_relax();
+				else
+					sched_yield();
+			}
+
+		public:
+			// capacity is rounded up to a power of 2 (at least 2)
+			explicit concurrent_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+			: _cells(NULL), _mask(roundCapacity(capacity) - 1), _alloc(alloc), _pushPos(0), _popPos(0)
+			{
+				this->_cells = this->_alloc.allocate(this->_mask + 1);
+				for (size_t i = 0; i <= this->_mask; ++i)
+					this->_cells[i].sequence = i;
+			}
+
+			// Not thread safe, nobody may be using the queue anymore
+			~concurrent_queue()
+			{
+				for (size_t pos = this->_popPos; pos != this->_pushPos; ++pos)
+					this->valueOf(this->_cells[pos & this->_mask])->~T();
+				this->_alloc.deallocate(this->_cells, this->_mask + 1);
+			}
+
+			size_type capacity() const { return (this->_mask + 1); }
+
+			// Only a hint while other threads push and pop
+			size_type size_approx() const
+			{
+				const size_t pop = __atomic_load_n(&this->_popPos, __ATOMIC_RELAXED);
+				const size_t push = __atomic_load_n(&this->_pushPos, __ATOMIC_RELAXED);
+
+				return ((push > pop) ? push - pop : 0);
+			}
+
+			bool empty_approx() const { return (this->size_approx() == 0); }
+
+			allocator_type get_allocator() const { return (allocator_type(this->_alloc)); }
+
+			/***************** Non blocking *****************/
+
+			// False if the queue is full
+			bool try_push(const value_type& val)
+			{
+				size_t pos;
+
+				if (this->claim(&this->_pushPos, 0, 1, pos) == 0)
+					return (false);
+				this->publish(pos, val);
+				return (true);
+			}
+
+			// False if the queue is empty (or the next value is still being written)
+			bool try_pop(value_type& val)
+			{
+				size_t pos;
+				value_type* out = &val;
+
+				if (this->claim(&this->_popPos, 1, 1, pos) == 0)
+					return (false);
+				this->consume(pos, out);
+				return (true);
+			}
+
+			/* Pushes as many of the n values from first as fit, returns how many. Their turns are
+			   claimed at once, so they are consecutive in the queue: each one can be popped as soon as
+			   it is published, in order */
+			template <class InputIterator>
+			size_type try_push_n(InputIterator first, size_type n)
+			{
+				size_t pos;
+				const size_t count = this->claim(&this->_pushPos, 0, n, pos);
+
+				for (size_t i = 0; i < count; ++i, ++first)
+					this->publish(pos + i, *first);
+				return (count);
+			}
+
+			// Pops up to n values into out, returns how many
+			template <class OutputIterator>
+			size_type try_pop_n(OutputIterator out, size_type n)
+			{
+				size_t pos;
+				const size_t count = this->claim(&this->_popPos, 1, n, pos);
+
+				for (size_t i = 0; i < count; ++i, ++out)
+					this->consume(pos + i, out);
+				return (count);
+			}
+
+			/***************** Blocking (busy waiting) *****************/
+
+			// Waits for room, spinning then yielding
+			void push(const value_type& val)
+			{
+				for (size_t tries = 0; !this->try_push(val); )
+					backoff(tries);
+			}
+
+			// Waits for a value, spinning then yielding
+			void pop(value_type& val)
+			{
+				for (size_t tries = 0; !this->try_pop(val); )
+					backoff(tries);
+			}
+	};
+
+}
+
+#endif
@@ -0,0 +1,593 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 07:14 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_SKIPLIST_MAP_HPP
+# define CONCURRENT_SKIPLIST_MAP_HPP
+
+#include <cstring>
+#include <functional>
+#include <new>
+#include <pthread.h>
+#include <stdint.h>
+
+#include "epoch.hpp"
+#include "iterators.hpp"
+#include "pairs.hpp"
+
+/* Levels of the towers (each level has 1 in 4 of the nodes of the one below, 4^16 nodes) */
+#define SKIPLIST_MAX_LEVEL 16
+
+/* Free towers a thread keeps per height, and how many move at once between it and the shared pool */
+#define SKIPLIST_POOL_CACHE 64
+#define SKIPLIST_POOL_BATCH 32
+
+namespace ft
+{
+	/*******************************************************
+	 *                      Tower pool                     *
+	 *******************************************************/
+
+	/* Towers of Node, one free list per height. Each thread takes and gives back towers from its own
+	   lists, which trade SKIPLIST_POOL_BATCH towers at a time with the shared ones (behind a mutex)
+	   when they run dry / get too long, and are given back when the thread exits. Memory is never
+	   returned to the system: towers are reused, by any map of the same Node type */
+	template <class Node>
+	class skiplist_pool
+	{
+		private:
+			struct free_lists
+			{
+				Node*	head[SKIPLIST_MAX_LEVEL];
+				size_t	count[SKIPLIST_MAX_LEVEL];
+				bool	registered;
+			};
+
+			// A free tower is raw memory, its first bytes hold the next free one
+			static Node* nextFree(Node* node)
+			{
+				Node* next;
+				std::memcpy(&next, static_cast<void*>(node), sizeof(next));
+				return (next);
+			}
+
+			static void setNextFree(Node* node, Node* next) { std::memcpy(static_cast<void*>(node), &next, sizeof(next)); }
+
+			static free_lists& shared()
+			{
+				static free_lists lists;
+				return (lists);
+			}
+
+			static pthread_mutex_t& sharedMutex()
+			{
+				static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+				return (mutex);
+			}
+
+			static free_lists& local()
+			{
+				static __thread free_lists lists;
+
+				if (!lists.registered)
+				{
+					static pthread_once_t once = PTHREAD_ONCE_INIT;
+					pthread_once(&once, &skiplist_pool::makeExitKey);
+					pthread_setspecific(exitKey(), &lists);
+					lists.registered = true;
+				}
+				return (lists);
+			}
+
+			static pthread_key_t& exitKey()
+			{
+				static pthread_key_t key;
+				return (key);
+			}
+
+			static void makeExitKey() { pthread_key_create(&exitKey(), &skiplist_pool::flush); }
+
+			// Thread exiting: everything it had goes to the shared lists
+			static void flush(void* arg)
+			{
+				free_lists& lists = *static_cast<free_lists*>(arg);
+
+				for (size_t level = 0; level < SKIPLIST_MAX_LEVEL; ++level)
+					move(lists, shared(), level, lists.count[level]);
+				lists.registered = false;
+			}
+
+			// Moves n towers of a height (from the front of a list to the front of the other)
+			static void move(free_lists& from, free_lists& to, size_t level, size_t n)
+			{
+				if (n == 0)
+					return;
+				if (&to == &shared())
+					pthread_mutex_lock(&sharedMutex());
+				else if (&from == &shared())
+					pthread_mutex_lock(&sharedMutex());
+
+				for (size_t i = 0; i < n && from.head[level] != NULL; ++i)
+				{
+					Node* node = from.head[level];
+					from.head[level] = nextFree(node);
+					--from.count[level];
+					setNextFree(node, to.head[level]);
+					to.head[level] = node;
+					++to.count[level];
+				}
+
+				if (&to == &shared() || &from == &shared())
+					pthread_mutex_unlock(&sharedMutex());
+			}
+
+			// Bytes of a tower: the node and its extra levels, rounded so that the next one is aligned too
+			static size_t towerSize(size_t height)
+			{
+				const size_t bytes = sizeof(Node) + (height - 1) * sizeof(uintptr_t);
+				return ((bytes + __alignof__(Node) - 1) / __alignof__(Node) * __alignof__(Node));
+			}
+
+		public:
+			// Raw tower of height levels, the Node isn't constructed
+			static Node* acquire(size_t height)
+			{
+				free_lists& lists = local();
+				const size_t level = height - 1;
+
+				if (lists.head[level] == NULL)
+					move(shared(), lists, level, SKIPLIST_POOL_BATCH);
+				if (lists.head[level] == NULL)
+				{
+					const size_t size = towerSize(height);
+					char* chunk = static_cast<char*>(::operator new(size * SKIPLIST_POOL_BATCH));
+
+					for (size_t i = 0; i < SKIPLIST_POOL_BATCH; ++i)
+					{
+						Node* node = reinterpret_cast<Node*>(chunk + i * size);
+						setNextFree(node, lists.head[level]);
+						lists.head[level] = node;
+					}
+					lists.count[level] += SKIPLIST_POOL_BATCH;
+				}
+
+				Node* node = lists.head[level];
+				lists.head[level] = nextFree(node);
+				--lists.count[level];
+				return (node);
+			}
+
+			static void release(Node* node, size_t height)
+			{
+				free_lists& lists = local();
+				const size_t level = height - 1;
+
+				setNextFree(node, lists.head[level]);
+				lists.head[level] = node;
+				if (++lists.count[level] > SKIPLIST_POOL_CACHE)
+					move(lists, shared(), level, SKIPLIST_POOL_BATCH);
+			}
+	};
+
+	/*******************************************************
+	 *                concurrent_skiplist_map              *
+	 *******************************************************/
+
+	/*
+		Ordered map shared by any number of threads without locks (Fraser / Herlihy & Shavit skip
+		list): insert, erase, find, lower_bound... can all run at the same time.
+
+		Each node is a tower of next pointers, level 0 links every node in key order, each level
+		above skips about 3 in 4 of the nodes of the one below. The lowest bit of a next pointer
+		marks its node as deleted at that level. erase marks the tower top-down, the thread
+		marking level 0 wins the erase (logical deletion), then the node is unlinked level by
+		level, by whichever thread walks past it (locate). Insert links level 0 first (the node is
+		in the map from then on) then the levels above, one compare and swap each.
+
+		A node can only be retired (ft::epoch) once it's unlinked everywhere and nobody links it
+		anymore: the inserter and the eraser each hold a reference on it, the last one to let go
+		retires it. Towers come from skiplist_pool, so a freed one is reused without malloc.
+
+		Iterators are const (values can't be modified in place by several threads) and pin the
+		thread while they live: the nodes they point to can't be freed, even once erased. They
+		must stay on the thread that made them, and not be kept for long, reclamation waits for
+		them. Traversal sees every element present during the whole traversal, maybe some
+		inserted or erased meanwhile.
+	*/
+	template <class Key, class T, class Compare = std::less<Key> >
+	class concurrent_skiplist_map
+	{
+		public:
+			typedef Key										key_type;
+			typedef T										mapped_type;
+			typedef ft::pair<const key_type, mapped_type>	value_type;
+			typedef Compare									key_compare;
+			typedef size_t									size_type;
+			typedef ptrdiff_t								difference_type;
+			typedef const value_type&						const_reference;
+			typedef const value_type*						const_pointer;
+
+		private:
+			struct node
+			{
+				char		value[sizeof(value_type)] __attribute__((aligned(__alignof__(value_type))));
+				size_t		height;
+				size_t		refs; // Inserter and eraser, see release()
+				uintptr_t	next[1]; // height of them, the tower is allocated longer
+
+				value_type& data() { return (*reinterpret_cast<value_type*>(this->value)); }
+			};
+
+			typedef skiplist_pool<node>	pool;
+
+			static const uintptr_t MARK = 1;
+
+			static node* unmarked(uintptr_t next) { return (reinterpret_cast<node*>(next & ~MARK)); }
+			static bool isMarked(uintptr_t next) { return ((next & MARK) != 0); }
+			static uintptr_t word(node* n) { return (reinterpret_cast<uintptr_t>(n)); }
+
+			static uintptr_t loadNext(node* n, size_t level) { return (__atomic_load_n(&n->next[level], __ATOMIC_ACQUIRE)); }
+
+			static bool casNext(node* n, size_t level, uintptr_t expected, uintptr_t desired)
+			{
+				return (__atomic_compare_exchange_n(&n->next[level], &expected, desired, false,
+													__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+			}
+
+		public:
+			class const_iterator
+			{
+				public:
+					typedef ft::forward_iterator_tag		iterator_category;
+					typedef const ft::pair<const Key, T>	value_type;
+					typedef ptrdiff_t						difference_type;
+					typedef value_type*						pointer;
+					typedef value_type&						reference;
+
+				private:
+					node* _node;
+
+				public:
+					explicit const_iterator(node* n = NULL) : _node(n) { ft::epoch::pin(); }
+					const_iterator(const const_iterator& it) : _node(it._node) { ft::epoch::pin(); }
+					~const_iterator() { ft::epoch::unpin(); }
+
+					const_iterator& operator=(const const_iterator& it) { this->_node = it._node; return (*this); }
+
+					reference operator*() const { return (this->_node->data()); }
+					pointer operator->() const { return (&this->_node->data()); }
+
+					// Next node not erased (marked) at the time
+					const_iterator& operator++()
+					{
+						node* n = unmarked(loadNext(this->_node, 0));
+
+						while (n != NULL && isMarked(loadNext(n, 0)))
+							n = unmarked(loadNext(n, 0));
+						this->_node = n;
+						return (*this);
+					}
+
+					const_iterator operator++(int) { const_iterator tmp(*this); ++(*this); return (tmp); }
+
+					bool operator==(const const_iterator& rhs) const { return (this->_node == rhs._node); }
+					bool operator!=(const const_iterator& rhs) const { return (this->_node != rhs._node); }
+			};
+
+			typedef const_iterator	iterator;
+
+		private:
+			node*			_head; // Tower of SKIPLIST_MAX_LEVEL levels without value
+			key_compare		_comp;
+			char			_headPad[FT_CACHE_LINE_SIZE];
+			size_t			_size;
+			char			_sizePad[FT_CACHE_LINE_SIZE - sizeof(size_t)];
+
+			// Not copyable, threads may be using it
+			concurrent_skiplist_map(const concurrent_skiplist_map&);
+			concurrent_skiplist_map& operator=(const concurrent_skiplist_map&);
+
+			bool isInf(const key_type& lhs, const key_type& rhs) const { return (this->_comp(lhs, rhs)); }
+
+			// 1 level, then 1 in 4 chance of each one more
+			static size_t randomHeight()
+			{
+				static __thread uint64_t seed = 0;
+				size_t height = 1;
+
+				if (seed == 0)
+					seed = reinterpret_cast<uintptr_t>(&seed) | 1;
+				seed ^= seed << 13;
+				seed ^= seed >> 7;
+				seed ^= seed << 17;
+				for (uint64_t bits = seed; (bits & 3) == 0 && height < SKIPLIST_MAX_LEVEL; bits >>= 2)
+					++height;
+				return (height);
+			}
+
+			static void destroyNode(node* n)
+			{
+				n->data().~value_type();
+				pool::release(n, n->height);
+			}
+
+			static void freeRetired(void* ptr) { destroyNode(static_cast<node*>(ptr)); }
+
+			// The last of the inserter and the eraser to be done with the node retires it
+			static void release(node* n)
+			{
+				if (__atomic_sub_fetch(&n->refs, 1, __ATOMIC_ACQ_REL) == 0)
+					ft::epoch::retire(n, &concurrent_skiplist_map::freeRetired);
+			}
+
+			/* One walk from the top: fills preds / succs with the nodes around k on every level,
+			   unlinking the marked ones met on the way. False if a pred changed meanwhile */
+			bool tryLocate(const key_type& k, node** preds, node** succs)
+			{
+				node* pred = this->_head;
+
+				for (size_t level = SKIPLIST_MAX_LEVEL; level-- > 0; )
+				{
+					node* curr = unmarked(loadNext(pred, level));
+					while (curr != NULL)
+					{
+						uintptr_t succ = loadNext(curr, level);
+						while (isMarked(succ))
+						{
+							// curr is erased, unlink it here
+							if (!casNext(pred, level, word(curr), word(unmarked(succ))))
+								return (false);
+							curr = unmarked(succ);
+							if (curr == NULL)
+								break;
+							succ = loadNext(curr, level);
+						}
+						if (curr == NULL || !this->isInf(curr->data().first, k))
+							break;
+						pred = curr;
+						curr = unmarked(succ);
+					}
+					preds[level] = pred;
+					succs[level] = curr;
+				}
+				return (true);
+			}
+
+			// Same until it gets through, true if succs[0] has key k. Must be pinned
+			bool locate(const key_type& k, node** preds, node** succs)
+			{
+				while (!this->tryLocate(k, preds, succs))
+					ft::cpu_relax();
+				return (succs[0] != NULL && !this->isInf(k, succs[0]->data().first));
+			}
+
+			/* Links the levels above 0 of n, just linked at level 0, one by one. Gives up as soon as
+			   n gets erased (marked), the eraser unlinks what was linked */
+			void linkUpperLevels(node* n, node** preds, node** succs)
+			{
+				for (size_t level = 1; level < n->height; ++level)
+				{
+					while (true)
+					{
+						const uintptr_t next = loadNext(n, level);
+						if (isMarked(next))
+							return;
+						if (unmarked(next) != succs[level] && !casNext(n, level, next, word(succs[level])))
+							return; // Marked meanwhile
+						if (casNext(preds[level], level, word(succs[level]), word(n)))
+							break;
+						if (!this->locate(n->data().first, preds, succs) || succs[0] != n)
+							return; // Erased
+					}
+				}
+			}
+
+			/* First node not erased whose key isn't before k (strict: after k), without unlinking
+			   anything: reads only. Must be pinned */
+			node* search(const key_type& k, bool strict) const
+			{
+				node* pred = this->_head;
+				node* curr = NULL;
+
+				for (size_t level = SKIPLIST_MAX_LEVEL; level-- > 0; )
+				{
+					curr = unmarked(loadNext(pred, level));
+					while (curr != NULL)
+					{
+						const uintptr_t succ = loadNext(curr, level);
+						if (!isMarked(succ))
+						{
+							const bool before = strict ? !this->isInf(k, curr->data().first) : this->isInf(curr->data().first, k);
+							if (!before)
+								break;
+							pred = curr;
+						}
+						curr = unmarked(succ);
+					}
+				}
+				return (curr);
+			}
+
+			// Not thread safe: every node still linked, their values destroyed
+			void destroyAll()
+			{
+				node* n = unmarked(this->_head->next[0]);
+
+				while (n != NULL)
+				{
+					node* next = unmarked(n->next[0]);
+					destroyNode(n);
+					n = next;
+				}
+				for (size_t level = 0; level < SKIPLIST_MAX_LEVEL; ++level)
+					this->_head->next[level] = 0;
+			}
+
+		public:
+			explicit concurrent_skiplist_map(const key_compare& comp = key_compare())
+			: _head(NULL), _comp(comp), _size(0)
+			{
+				this->_head = static_cast<node*>(::operator new(sizeof(node) + (SKIPLIST_MAX_LEVEL - 1) * sizeof(uintptr_t)));
+				this->_head->height = SKIPLIST_MAX_LEVEL;
+				this->_head->refs = 1;
+				for (size_t level = 0; level < SKIPLIST_MAX_LEVEL; ++level)
+					this->_head->next[level] = 0;
+			}
+
+			// Not thread safe, nobody may be using the map anymore
+			~concurrent_skiplist_map()
+			{
+				this->destroyAll();
+				::operator delete(this->_head);
+			}
+
+			/***************** Capacity *****************/
+
+			// Exact when nobody is writing, a hint otherwise
+			size_type size() const { return (__atomic_load_n(&this->_size, __ATOMIC_RELAXED)); }
+			bool empty() const { return (this->size() == 0); }
+
+			key_compare key_comp() const { return (this->_comp); }
+
+			/***************** Modifiers *****************/
+
+			/* Inserts val if its key isn't there yet. Returns an iterator to the element with that key
+			   and whether it was inserted. Lock-free: a failed compare and swap means another thread
+			   made progress */
+			ft::pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::epoch_guard guard;
+				node* preds[SKIPLIST_MAX_LEVEL];
+				node* succs[SKIPLIST_MAX_LEVEL];
+				const size_t height = randomHeight();
+				node* n = pool::acquire(height);
+
+				try
+				{
+					::new (static_cast<void*>(n->value)) value_type(val);
+				}
+				catch (...)
+				{
+					pool::release(n, height);
+					throw;
+				}
+				n->height = height;
+				n->refs = 2; // The inserter (until its last level is linked) and the list (until erased)
+
+				// Level 0: once there, the value is in the map
+				while (true)
+				{
+					if (this->locate(val.first, preds, succs))
+					{
+						destroyNode(n); // Never seen by anyone
+						return (ft::make_pair(iterator(succs[0]), false));
+					}
+					for (size_t level = 0; level < height; ++level)
+						__atomic_store_n(&n->next[level], word(succs[level]), __ATOMIC_RELAXED);
+					if (casNext(preds[0], 0, word(succs[0]), word(n)))
+						break;
+				}
+				__atomic_add_fetch(&this->_size, 1, __ATOMIC_RELAXED);
+
+				this->linkUpperLevels(n, preds, succs);
+				// Erased while we were linking: our last links may have missed the eraser's cleanup
+				if (isMarked(loadNext(n, 0)))
+					this->locate(val.first, preds, succs);
+				iterator it(n);
+				release(n);
+				return (ft::make_pair(it, true));
+			}
+
+			// 1 if k was erased by this call, 0 if it wasn't there (or another thread erased it first)
+			size_type erase(const key_type& k)
+			{
+				ft::epoch_guard guard;
+				node* preds[SKIPLIST_MAX_LEVEL];
+				node* succs[SKIPLIST_MAX_LEVEL];
+
+				if (!this->locate(k, preds, succs))
+					return (0);
+
+				node* n = succs[0];
+				for (size_t level = n->height; level-- > 1; )
+				{
+					uintptr_t next = loadNext(n, level);
+					while (!isMarked(next) && !casNext(n, level, next, next | MARK))
+						next = loadNext(n, level);
+				}
+				while (true)
+				{
+					const uintptr_t next = loadNext(n, 0);
+					if (isMarked(next))
+						return (0);
+					if (casNext(n, 0, next, next | MARK))
+						break;
+				}
+				__atomic_sub_fetch(&this->_size, 1, __ATOMIC_RELAXED);
+				this->locate(k, preds, succs); // Unlinks it everywhere
+				release(n);
+				return (1);
+			}
+
+			// Not thread safe, nobody else may be using the map
+			void clear()
+			{
+				this->destroyAll();
+				this->_size = 0;
+			}
+
+			/***************** Lookup *****************/
+
+			iterator find(const key_type& k) const
+			{
+				ft::epoch_guard guard;
+				node* n = this->search(k, false);
+
+				if (n == NULL || this->isInf(k, n->data().first))
+					return (this->end());
+				return (iterator(n));
+			}
+
+			size_type count(const key_type& k) const { return ((this->find(k) != this->end()) ? 1 : 0); }
+
+			iterator lower_bound(const key_type& k) const
+			{
+				ft::epoch_guard guard;
+				return (iterator(this->search(k, false)));
+			}
+
+			iterator upper_bound(const key_type& k) const
+			{
+				ft::epoch_guard guard;
+				return (iterator(this->search(k, true)));
+			}
+
+			ft::pair<iterator, iterator> equal_range(const key_type& k) const
+			{ return (ft::make_pair(this->lower_bound(k), this->upper_bound(k))); }
+
+			/***************** Iterators *****************/
+
+			iterator begin() const
+			{
+				ft::epoch_guard guard;
+				node* n = unmarked(loadNext(this->_head, 0));
+
+				while (n != NULL && isMarked(loadNext(n, 0)))
+					n = unmarked(loadNext(n, 0));
+				return (iterator(n));
+			}
+
+			iterator end() const { return (iterator(NULL)); }
+	};
+
+}
+
+#endif
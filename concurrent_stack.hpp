@@ -0,0 +1,322 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:09 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_STACK_HPP
+# define CONCURRENT_STACK_HPP
+
+#include <memory>
+#include <new>
+#include <stdint.h>
+
+#include "thread_pool.hpp"
+
+/* Nodes of the first chunk, each next chunk is twice as big (power of 2) */
+#define CONCURRENT_STACK_FIRST_CHUNK 64
+
+/* Chunks the nodes can come from: 64 << 0 to 64 << 25, almost 2^32 nodes */
+#define CONCURRENT_STACK_CHUNKS 26
+
+/* Slots of the elimination array, and how long a push waits in one for a pop to take its node */
+#define CONCURRENT_STACK_ELIMINATION_SLOTS 8
+#define CONCURRENT_STACK_ELIMINATION_SPINS 64
+
+namespace ft
+{
+	/*
+		Lock-free LIFO stack shared by any number of threads (Treiber stack).
+
+		The top is a single 64 bit word: the index of the top node and a tag incremented by every
+		change. A pop reading top = (A, t), then sleeping while A is popped, reused and pushed
+		back, has its compare and swap fail since the tag is now t + 2: no ABA.
+		Nodes are never given back to the allocator while the stack lives, popped ones go to a
+		free list (a second tagged stack) and are reused by the next pushes: a late thread reading
+		the next index of a node popped by someone else reads a valid node (the value may be
+		wrong, its compare and swap then fails). Nodes are found from their index through chunks
+		of growing sizes, allocated when first needed, so no address ever moves.
+
+		When the compare and swap on the top fails (contention), the thread tries the elimination
+		array instead of trying again right away: a push leaves its node in a random slot for a
+		while, a pop finding one there takes it. A push and a pop meeting this way cancel each
+		other without touching the top at all. Slots are tagged the same way.
+	*/
+	template <class T, class Allocator = std::allocator<T> >
+	class concurrent_stack
+	{
+		public:
+			typedef T				value_type;
+			typedef Allocator		allocator_type;
+			typedef size_t			size_type;
+
+		private:
+			struct node
+			{
+				char		value[sizeof(T)] __attribute__((aligned(__alignof__(T))));
+				uint32_t	next; // Index, 0 for none
+			};
+
+			struct slot
+			{
+				uint64_t	word; // Node index and tag, see pack
+				char		pad[FT_CACHE_LINE_SIZE - sizeof(uint64_t)];
+			};
+
+			typedef typename Allocator::template rebind<node>::other	node_allocator;
+
+			char			_frontPad[FT_CACHE_LINE_SIZE];
+			node*			_chunks[CONCURRENT_STACK_CHUNKS];
+			node_allocator	_alloc;
+			bool			_elimination;
+			char			_chunksPad[FT_CACHE_LINE_SIZE];
+			uint64_t		_top;
+			char			_topPad[FT_CACHE_LINE_SIZE - sizeof(uint64_t)];
+			uint64_t		_free;
+			uint32_t		_allocated; // Nodes handed out by the chunks so far, the free list aside
+			char			_freePad[FT_CACHE_LINE_SIZE - sizeof(uint64_t) - sizeof(uint32_t)];
+			slot			_slots[CONCURRENT_STACK_ELIMINATION_SLOTS];
+
+			// Not copyable, threads may be using it
+			concurrent_stack(const concurrent_stack&);
+			concurrent_stack& operator=(const concurrent_stack&);
+
+			/***************** Tagged indexes *****************/
+
+			static uint64_t pack(uint32_t index, uint32_t tag) { return ((static_cast<uint64_t>(tag) << 32) | index); }
+			static uint32_t indexOf(uint64_t word) { return (static_cast<uint32_t>(word)); }
+			static uint32_t tagOf(uint64_t word) { return (static_cast<uint32_t>(word >> 32)); }
+
+			/***************** Nodes *****************/
+
+			// Index i (from 1) is in chunk k when i - 1 + FIRST_CHUNK is in [FIRST_CHUNK << k, FIRST_CHUNK << (k + 1))
+			static size_t chunkOf(uint32_t index)
+			{
+				const unsigned long shifted = (index - 1 + CONCURRENT_STACK_FIRST_CHUNK) / CONCURRENT_STACK_FIRST_CHUNK;
+				return (sizeof(unsigned long) * 8 - 1 - __builtin_clzl(shifted));
+			}
+
+			static size_t chunkSize(size_t chunk) { return (static_cast<size_t>(CONCURRENT_STACK_FIRST_CHUNK) << chunk); }
+
+			node& nodeAt(uint32_t index)
+			{
+				const size_t chunk = chunkOf(index);
+				node* nodes = __atomic_load_n(&this->_chunks[chunk], __ATOMIC_ACQUIRE);
+
+				return (nodes[index - 1 + CONCURRENT_STACK_FIRST_CHUNK - chunkSize(chunk)]);
+			}
+
+			T* valueOf(uint32_t index) { return (reinterpret_cast<T*>(this->nodeAt(index).value)); }
+
+			uint32_t nextOf(uint32_t index) { return (__atomic_load_n(&this->nodeAt(index).next, __ATOMIC_RELAXED)); }
+			void setNext(uint32_t index, uint32_t next) { __atomic_store_n(&this->nodeAt(index).next, next, __ATOMIC_RELAXED); }
+
+			// The first thread needing a chunk allocates it, the others losing the race free theirs
+			void makeChunk(size_t chunk)
+			{
+				if (__atomic_load_n(&this->_chunks[chunk], __ATOMIC_ACQUIRE) != NULL)
+					return;
+
+				node* nodes = this->_alloc.allocate(chunkSize(chunk));
+				node* expected = NULL;
+				if (!__atomic_compare_exchange_n(&this->_chunks[chunk], &expected, nodes, false,
+												 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+					this->_alloc.deallocate(nodes, chunkSize(chunk));
+			}
+
+			// A node from the free list, or a new one
+			uint32_t takeNode()
+			{
+				uint32_t index = this->popIndex(&this->_free);
+
+				if (index == 0)
+				{
+					index = __atomic_add_fetch(&this->_allocated, 1, __ATOMIC_RELAXED);
+					if (index == 0 || chunkOf(index) >= CONCURRENT_STACK_CHUNKS)
+						throw std::bad_alloc();
+					this->makeChunk(chunkOf(index));
+				}
+				return (index);
+			}
+
+			/***************** Treiber stacks of indexes *****************/
+
+			// One try, false if the top changed meanwhile
+			bool tryPushIndex(uint64_t* top, uint32_t index)
+			{
+				uint64_t old = __atomic_load_n(top, __ATOMIC_RELAXED);
+
+				this->setNext(index, indexOf(old));
+				return (__atomic_compare_exchange_n(top, &old, pack(index, tagOf(old) + 1), false,
+													__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+			}
+
+			// One try: the index popped, 0 if empty, -1 if the top changed meanwhile
+			int64_t tryPopIndex(uint64_t* top)
+			{
+				uint64_t old = __atomic_load_n(top, __ATOMIC_ACQUIRE);
+
+				if (indexOf(old) == 0)
+					return (0);
+
+				const uint32_t next = this->nextOf(indexOf(old));
+				if (!__atomic_compare_exchange_n(top, &old, pack(next, tagOf(old) + 1), false,
+												 __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+					return (-1);
+				return (indexOf(old));
+			}
+
+			void pushIndex(uint64_t* top, uint32_t index)
+			{
+				while (!this->tryPushIndex(top, index))
+					ft::cpu_relax();
+			}
+
+			uint32_t popIndex(uint64_t* top)
+			{
+				int64_t index;
+
+				while ((index = this->tryPopIndex(top)) < 0)
+					ft::cpu_relax();
+				return (static_cast<uint32_t>(index));
+			}
+
+			/***************** Elimination *****************/
+
+			slot& randomSlot()
+			{
+				static __thread size_t seed = 0;
+
+				if (seed == 0)
+					seed = reinterpret_cast<size_t>(&seed) | 1;
+				seed = seed * 1103515245 + 12345;
+				return (this->_slots[(seed >> 16) % CONCURRENT_STACK_ELIMINATION_SLOTS]);
+			}
+
+			// Leaves the node in a slot for a while, true if a pop took it
+			bool offer(uint32_t index)
+			{
+				slot& s = this->randomSlot();
+				uint64_t old = __atomic_load_n(&s.word, __ATOMIC_RELAXED);
+
+				if (indexOf(old) != 0)
+					return (false);
+
+				uint64_t offered = pack(index, tagOf(old) + 1);
+				if (!__atomic_compare_exchange_n(&s.word, &old, offered, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+					return (false);
+				for (size_t i = 0; i < CONCURRENT_STACK_ELIMINATION_SPINS; ++i)
+				{
+					if (__atomic_load_n(&s.word, __ATOMIC_RELAXED) != offered)
+						return (true);
+					ft::cpu_relax();
+				}
+				// Nobody came, take it back unless a pop just did
+				return (!__atomic_compare_exchange_n(&s.word, &offered, pack(0, tagOf(offered) + 1), false,
+													 __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+			}
+
+			// A node a push left in a slot, 0 if there was none
+			uint32_t take()
+			{
+				slot& s = this->randomSlot();
+				uint64_t old = __atomic_load_n(&s.word, __ATOMIC_ACQUIRE);
+
+				if (indexOf(old) == 0 || !__atomic_compare_exchange_n(&s.word, &old, pack(0, tagOf(old) + 1), false,
+																	  __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+					return (0);
+				return (indexOf(old));
+			}
+
+			void moveOut(uint32_t index, value_type& val)
+			{
+				T* stored = this->valueOf(index);
+
+				val = *stored;
+				stored->~T();
+				this->pushIndex(&this->_free, index);
+			}
+
+		public:
+			// Elimination only pays off with many threads pushing and popping at once, it can be turned off
+			explicit concurrent_stack(bool elimination = true, const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _elimination(elimination), _top(0), _free(0), _allocated(0)
+			{
+				for (size_t i = 0; i < CONCURRENT_STACK_CHUNKS; ++i)
+					this->_chunks[i] = NULL;
+				for (size_t i = 0; i < CONCURRENT_STACK_ELIMINATION_SLOTS; ++i)
+					this->_slots[i].word = 0;
+			}
+
+			// Not thread safe, nobody may be using the stack anymore
+			~concurrent_stack()
+			{
+				for (uint32_t index = indexOf(this->_top); index != 0; index = this->nextOf(index))
+					this->valueOf(index)->~T();
+				for (size_t i = 0; i < CONCURRENT_STACK_CHUNKS; ++i)
+				{
+					if (this->_chunks[i] != NULL)
+						this->_alloc.deallocate(this->_chunks[i], chunkSize(i));
+				}
+			}
+
+			// Only a hint while other threads push and pop
+			bool empty_approx() const { return (indexOf(__atomic_load_n(&this->_top, __ATOMIC_RELAXED)) == 0); }
+
+			allocator_type get_allocator() const { return (allocator_type(this->_alloc)); }
+
+			// If T's copy throws, the stack is left as it was
+			void push(const value_type& val)
+			{
+				const uint32_t index = this->takeNode();
+
+				try
+				{
+					::new (static_cast<void*>(this->nodeAt(index).value)) T(val);
+				}
+				catch (...)
+				{
+					this->pushIndex(&this->_free, index);
+					throw;
+				}
+				while (!this->tryPushIndex(&this->_top, index))
+				{
+					if (this->_elimination && this->offer(index))
+						return;
+					ft::cpu_relax();
+				}
+			}
+
+			/* False if the stack is empty. The value is assigned to val then destroyed in the node:
+			   T's assignment must not throw */
+			bool try_pop(value_type& val)
+			{
+				int64_t index;
+
+				while ((index = this->tryPopIndex(&this->_top)) < 0)
+				{
+					const uint32_t given = this->_elimination ? this->take() : 0;
+
+					if (given != 0)
+					{
+						this->moveOut(given, val);
+						return (true);
+					}
+					ft::cpu_relax();
+				}
+				if (index == 0)
+					return (false);
+				this->moveOut(static_cast<uint32_t>(index), val);
+				return (true);
+			}
+	};
+
+}
+
+#endif
@@ -0,0 +1,227 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:15 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+#include <pthread.h>
+
+#include "thread_pool.hpp"
+#include "vector.hpp"
+
+/* Retired pointers a thread keeps before trying to move the epoch forward and free some */
+#define EPOCH_RETIRE_BATCH 128
+
+namespace ft
+{
+	/*
+		Epoch based memory reclamation, for lock-free structures whose nodes can be unlinked while
+		other threads are still reading them.
+
+		A thread reading shared nodes is pinned (epoch_guard): it announces the global epoch it
+		saw. A node unlinked from the structure isn't freed but retired, tagged with the epoch of
+		the thread retiring it. The global epoch only moves from e to e + 1 once every pinned
+		thread has announced e, so when it reaches e + 2, no thread can still be reading a node
+		retired during e: it was unlinked before any of the current readers got pinned.
+
+		Each thread has its own record (announced epoch, retired pointers in 3 buckets by epoch
+		modulo 3), in a list that only grows. A thread exiting gives its record back, the next new
+		thread takes it over with what it still had to free. Pins nest: only the outermost one
+		announces anything, inner ones just count.
+	*/
+	class epoch
+	{
+		public:
+			typedef void (*free_function)(void* ptr);
+
+		private:
+			struct retired
+			{
+				void*			ptr;
+				free_function	free;
+			};
+
+			struct record
+			{
+				size_t					state; // (epoch << 1) | 1 when pinned, 0 when not
+				size_t					nesting;
+				bool					used;
+				record*					next;
+				ft::vector<retired>		bucket[3];
+				size_t					bucketEpoch[3];
+				size_t					retiredCount;
+				char					pad[FT_CACHE_LINE_SIZE];
+			};
+
+			static size_t& globalEpoch()
+			{
+				static size_t global = 2; // Buckets start as epoch 0, already freeable
+				return (global);
+			}
+
+			static record*& records()
+			{
+				static record* head = NULL;
+				return (head);
+			}
+
+			static pthread_key_t& exitKey()
+			{
+				static pthread_key_t key;
+				return (key);
+			}
+
+			static void makeExitKey() { pthread_key_create(&exitKey(), &epoch::releaseRecord); }
+
+			// Thread exiting: its record goes back to the list for the next new thread
+			static void releaseRecord(void* arg)
+			{
+				record* rec = static_cast<record*>(arg);
+
+				currentRecord() = NULL;
+				__atomic_store_n(&rec->used, false, __ATOMIC_RELEASE);
+			}
+
+			static record*& currentRecord()
+			{
+				static __thread record* current = NULL;
+				return (current);
+			}
+
+			// A record given back by an exited thread, or a new one
+			static record* acquireRecord()
+			{
+				static pthread_once_t once = PTHREAD_ONCE_INIT;
+				record* rec;
+
+				pthread_once(&once, &epoch::makeExitKey);
+				for (rec = __atomic_load_n(&records(), __ATOMIC_ACQUIRE); rec != NULL; rec = rec->next)
+				{
+					bool expected = false;
+					if (!__atomic_load_n(&rec->used, __ATOMIC_RELAXED)
+						&& __atomic_compare_exchange_n(&rec->used, &expected, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+						break;
+				}
+				if (rec == NULL)
+				{
+					rec = new record();
+					rec->state = 0;
+					rec->nesting = 0;
+					rec->used = true;
+					rec->retiredCount = 0;
+					for (size_t i = 0; i < 3; ++i)
+						rec->bucketEpoch[i] = 0;
+					rec->next = __atomic_load_n(&records(), __ATOMIC_RELAXED);
+					while (!__atomic_compare_exchange_n(&records(), &rec->next, rec, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+						;
+				}
+				pthread_setspecific(exitKey(), rec);
+				currentRecord() = rec;
+				return (rec);
+			}
+
+			static record& self()
+			{
+				record* rec = currentRecord();
+				return ((rec != NULL) ? *rec : *acquireRecord());
+			}
+
+			// Moves the global epoch forward if every pinned thread has seen the current one
+			static void tryAdvance()
+			{
+				size_t global = __atomic_load_n(&globalEpoch(), __ATOMIC_SEQ_CST);
+
+				for (record* rec = __atomic_load_n(&records(), __ATOMIC_ACQUIRE); rec != NULL; rec = rec->next)
+				{
+					const size_t state = __atomic_load_n(&rec->state, __ATOMIC_SEQ_CST);
+					if ((state & 1) != 0 && (state >> 1) != global)
+						return;
+				}
+				__atomic_compare_exchange_n(&globalEpoch(), &global, global + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+			}
+
+			// Frees the buckets retired 2 epochs ago or more
+			static void collect(record& rec, size_t global)
+			{
+				for (size_t i = 0; i < 3; ++i)
+				{
+					ft::vector<retired>& bucket = rec.bucket[i];
+					if (bucket.empty() || rec.bucketEpoch[i] + 2 > global)
+						continue;
+					for (size_t j = 0; j < bucket.size(); ++j)
+						bucket[j].free(bucket[j].ptr);
+					rec.retiredCount -= bucket.size();
+					bucket.clear();
+				}
+			}
+
+		public:
+			static void pin()
+			{
+				record& rec = self();
+
+				if (rec.nesting++ != 0)
+					return;
+				// The store must be seen before any read of the structure: full fence
+				__atomic_store_n(&rec.state, (__atomic_load_n(&globalEpoch(), __ATOMIC_RELAXED) << 1) | 1, __ATOMIC_SEQ_CST);
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);
+			}
+
+			static void unpin()
+			{
+				record& rec = *currentRecord();
+
+				if (--rec.nesting == 0)
+					__atomic_store_n(&rec.state, 0, __ATOMIC_RELEASE);
+			}
+
+			/* ptr was unlinked by the calling thread (pinned): free(ptr) is called once no thread
+			   can be reading it anymore, from whichever thread retires something later */
+			static void retire(void* ptr, free_function free)
+			{
+				record& rec = self();
+				const size_t global = __atomic_load_n(&globalEpoch(), __ATOMIC_ACQUIRE);
+				const size_t index = global % 3;
+				retired item;
+
+				// The bucket still holds pointers from 3 epochs ago or more: all freeable
+				if (rec.bucketEpoch[index] != global)
+				{
+					collect(rec, global);
+					rec.bucketEpoch[index] = global;
+				}
+				item.ptr = ptr;
+				item.free = free;
+				rec.bucket[index].push_back(item);
+				if (++rec.retiredCount >= EPOCH_RETIRE_BATCH)
+				{
+					tryAdvance();
+					collect(rec, __atomic_load_n(&globalEpoch(), __ATOMIC_ACQUIRE));
+				}
+			}
+	};
+
+	// Keeps the calling thread pinned while it lives
+	class epoch_guard
+	{
+		private:
+			epoch_guard(const epoch_guard&);
+			epoch_guard& operator=(const epoch_guard&);
+
+		public:
+			epoch_guard() { ft::epoch::pin(); }
+			~epoch_guard() { ft::epoch::unpin(); }
+	};
+
+}
+
+#endif
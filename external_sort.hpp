@@ -0,0 +1,363 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:26 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EXTERNAL_SORT_HPP
+# define EXTERNAL_SORT_HPP
+
+#include "sort.hpp"
+#include "vector.hpp"
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <functional>
+
+// Smallest read buffer per run while merging, under it seeks dominate so we merge in several passes
+#define EXTERNAL_SORT_MIN_BUFFER (1 << 20)
+
+namespace ft
+{
+	inline void external_sort_error(const std::string& what)
+	{
+		throw (std::runtime_error("external_sort: " + what + ": " + std::strerror(errno)));
+	}
+
+	// read() until len bytes are read or EOF, returns how many were read
+	inline size_t read_full(int fd, void* buf, size_t len)
+	{
+		size_t total = 0;
+
+		while (total < len)
+		{
+			ssize_t ret = read(fd, static_cast<char*>(buf) + total, len - total);
+			if (ret == 0)
+				break;
+			if (ret < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				external_sort_error("read");
+			}
+			total += ret;
+		}
+		return (total);
+	}
+
+	inline void write_full(int fd, const void* buf, size_t len)
+	{
+		size_t total = 0;
+
+		while (total < len)
+		{
+			ssize_t ret = write(fd, static_cast<const char*>(buf) + total, len - total);
+			if (ret < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				external_sort_error("write");
+			}
+			total += ret;
+		}
+	}
+
+	/*******************************************************
+	 *                     Run files                       *
+	 *******************************************************/
+
+	/* Sorted runs are spilled to anonymous temporary files: created then unlinked right away,
+	   so the disk space goes back to the system as soon as they are closed, even on a crash */
+	class external_runs
+	{
+		private:
+			std::string			_dir;
+			ft::vector<int>		_fds;
+
+			external_runs(const external_runs&);
+			external_runs& operator=(const external_runs&);
+
+		public:
+			external_runs(const char* dir) : _dir(dir) { }
+
+			~external_runs()
+			{
+				for (size_t i = 0; i < this->_fds.size(); ++i)
+					close(this->_fds[i]);
+			}
+
+			int create()
+			{
+				std::string path = this->_dir + "/ft_external_sort.XXXXXX";
+				ft::vector<char> name(path.begin(), path.end());
+				name.push_back('\0');
+
+				int fd = mkstemp(&name[0]);
+				if (fd < 0)
+					external_sort_error("mkstemp " + path);
+				unlink(&name[0]);
+				this->_fds.push_back(fd);
+				return (fd);
+			}
+
+			// Closes the first n runs, once they are merged into a new one
+			void release(size_t n)
+			{
+				for (size_t i = 0; i < n; ++i)
+					close(this->_fds[i]);
+				this->_fds.erase(this->_fds.begin(), this->_fds.begin() + n);
+			}
+
+			size_t	size() const { return (this->_fds.size()); }
+			int		operator[](size_t i) const { return (this->_fds[i]); }
+	};
+
+	/* Buffered sequential reader over a run, holds the record currently competing in the merge */
+	template <class Record>
+	class run_reader
+	{
+		private:
+			int					_fd;
+			ft::vector<Record>	_buffer;
+			size_t				_pos;
+			size_t				_len;
+
+		public:
+			run_reader() : _fd(-1), _buffer(), _pos(0), _len(0) { }
+
+			void open(int fd, size_t bufferRecords)
+			{
+				this->_fd = fd;
+				this->_buffer.resize(bufferRecords);
+				if (lseek(fd, 0, SEEK_SET) < 0)
+					external_sort_error("lseek");
+				this->fill();
+			}
+
+			void fill()
+			{
+				size_t bytes = ft::read_full(this->_fd, &this->_buffer[0], this->_buffer.size() * sizeof(Record));
+				this->_len = bytes / sizeof(Record);
+				this->_pos = 0;
+			}
+
+			bool			exhausted() const { return (this->_pos == this->_len); }
+			const Record&	current() const { return (this->_buffer[this->_pos]); }
+
+			void advance()
+			{
+				if (++this->_pos == this->_len && this->_len == this->_buffer.size())
+					this->fill();
+			}
+	};
+
+	/* Buffered sequential writer, only issues buffer sized writes */
+	template <class Record>
+	class run_writer
+	{
+		private:
+			int					_fd;
+			ft::vector<Record>	_buffer;
+			size_t				_len;
+
+		public:
+			run_writer(int fd, size_t bufferRecords) : _fd(fd), _buffer(bufferRecords), _len(0) { }
+
+			void push(const Record& record)
+			{
+				this->_buffer[this->_len++] = record;
+				if (this->_len == this->_buffer.size())
+					this->flush();
+			}
+
+			void flush()
+			{
+				ft::write_full(this->_fd, &this->_buffer[0], this->_len * sizeof(Record));
+				this->_len = 0;
+			}
+	};
+
+	/*******************************************************
+	 *                     Loser tree                      *
+	 *******************************************************/
+
+	/* Tournament tree for k-way merge: internal nodes keep the loser of the match played there,
+	   _tree[0] the overall winner. Replacing the winner only replays its path to the root,
+	   so log2(k) comparisons per record instead of k for a linear scan.
+	   Leaves are the implicit nodes k to 2k - 1, which works for any k, not only powers of 2 */
+	template <class Record, class Compare>
+	class loser_tree
+	{
+		private:
+			ft::vector<run_reader<Record> >&	_runs;
+			ft::vector<size_t>					_tree;
+			Compare								_comp;
+
+			// An exhausted run loses against everything
+			bool beats(size_t a, size_t b) const
+			{
+				if (this->_runs[a].exhausted())
+					return (false);
+				if (this->_runs[b].exhausted())
+					return (true);
+				return (!this->_comp(this->_runs[b].current(), this->_runs[a].current()));
+			}
+
+			size_t build(size_t node)
+			{
+				const size_t k = this->_runs.size();
+
+				if (node >= k)
+					return (node - k);
+
+				size_t left = this->build(2 * node);
+				size_t right = this->build(2 * node + 1);
+				if (this->beats(left, right))
+				{
+					this->_tree[node] = right;
+					return (left);
+				}
+				this->_tree[node] = left;
+				return (right);
+			}
+
+		public:
+			loser_tree(ft::vector<run_reader<Record> >& runs, Compare comp)
+			: _runs(runs), _tree(runs.size() > 1 ? runs.size() : 1), _comp(comp)
+			{
+				this->_tree[0] = (runs.size() > 1) ? this->build(1) : 0;
+			}
+
+			bool			empty() const { return (this->_runs[this->_tree[0]].exhausted()); }
+			const Record&	top() const { return (this->_runs[this->_tree[0]].current()); }
+
+			// Move the winning run forward and replay its matches up to the root
+			void pop()
+			{
+				size_t winner = this->_tree[0];
+
+				this->_runs[winner].advance();
+				for (size_t node = (winner + this->_runs.size()) / 2; node > 0; node /= 2)
+				{
+					if (this->beats(this->_tree[node], winner))
+					{
+						size_t tmp = this->_tree[node];
+						this->_tree[node] = winner;
+						winner = tmp;
+					}
+				}
+				this->_tree[0] = winner;
+			}
+	};
+
+	/*******************************************************
+	 *                   External sort                     *
+	 *******************************************************/
+
+	// Merge runs [first, first + count) into out_fd, splitting the memory budget between all buffers
+	template <class Record, class Compare>
+	void external_merge(const external_runs& runs, size_t first, size_t count,
+						int out_fd, size_t memory_budget, Compare comp)
+	{
+		const size_t bufferRecords = memory_budget / (count + 1) / sizeof(Record) + 1;
+
+		ft::vector<run_reader<Record> > readers(count);
+		for (size_t i = 0; i < count; ++i)
+			readers[i].open(runs[first + i], bufferRecords);
+
+		run_writer<Record> writer(out_fd, bufferRecords);
+		loser_tree<Record, Compare> tree(readers, comp);
+
+		while (!tree.empty())
+		{
+			writer.push(tree.top());
+			tree.pop();
+		}
+		writer.flush();
+	}
+
+	/* Sorts fixed size records from in_fd to out_fd using at most about memory_budget bytes.
+	   Record must be trivially copyable, it is read and written as raw bytes.
+	   1. Read memory_budget sized chunks, ft::sort them and spill each as a sorted run in tmp_dir
+	   2. k-way merge the runs with a loser tree, each run and the output getting an equal part of
+	      the budget as sequential I/O buffer. If there are too many runs for buffers to stay big
+	      (EXTERNAL_SORT_MIN_BUFFER), merge them by groups first, as many passes as needed.
+	   If everything fits in one chunk, nothing touches the disk besides in_fd and out_fd.
+	   Throws std::runtime_error on I/O errors or if in_fd does not hold a whole number of records */
+	template <class Record, class Compare>
+	void external_sort(int in_fd, int out_fd, size_t memory_budget, Compare comp, const char* tmp_dir = NULL)
+	{
+		if (tmp_dir == NULL)
+			tmp_dir = getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp";
+
+		const size_t chunkRecords = memory_budget / sizeof(Record) ? memory_budget / sizeof(Record) : 1;
+		external_runs runs(tmp_dir);
+
+		/***** Run formation *****/
+		{
+			ft::vector<Record> chunk(chunkRecords);
+
+			while (true)
+			{
+				size_t bytes = ft::read_full(in_fd, &chunk[0], chunkRecords * sizeof(Record));
+				if (bytes % sizeof(Record) != 0)
+				{
+					errno = EINVAL;
+					external_sort_error("input size is not a multiple of the record size");
+				}
+
+				size_t n = bytes / sizeof(Record);
+				if (n == 0)
+					break;
+				ft::sort(chunk.begin(), chunk.begin() + n, comp);
+
+				// Everything fit in memory, no need for runs
+				if (runs.size() == 0 && n < chunkRecords)
+				{
+					ft::write_full(out_fd, &chunk[0], n * sizeof(Record));
+					return;
+				}
+				ft::write_full(runs.create(), &chunk[0], n * sizeof(Record));
+				if (n < chunkRecords)
+					break;
+			}
+		} // Chunk memory is given back before merging
+
+		if (runs.size() == 0)
+			return;
+
+		/***** Merge passes *****/
+		size_t fanIn = memory_budget / EXTERNAL_SORT_MIN_BUFFER;
+		if (fanIn < 2)
+			fanIn = 2;
+
+		while (runs.size() > fanIn)
+		{
+			// Merge the oldest runs into a new one at the back, until one pass can do everything
+			size_t count = (runs.size() - fanIn + 1 < fanIn) ? runs.size() - fanIn + 1 : fanIn;
+			ft::external_merge<Record>(runs, 0, count, runs.create(), memory_budget, comp);
+			runs.release(count);
+		}
+		ft::external_merge<Record>(runs, 0, runs.size(), out_fd, memory_budget, comp);
+	}
+
+	template <class Record>
+	void external_sort(int in_fd, int out_fd, size_t memory_budget)
+	{
+		ft::external_sort<Record>(in_fd, out_fd, memory_budget, std::less<Record>());
+	}
+
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
 /*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
 /*   Created: 28-02-2022  by  `-'                        `-'                  */
-/*   Updated: 17-03-2022 14:48 by                                             */
+/*   Updated: 18-10-2026 04:56 by                                             */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,6 +17,7 @@
 #include "enable_if.hpp"
 
 #include <iostream>
+#include <iterator>
 #include <cstddef>
 
 namespace ft
@@ -80,6 +81,136 @@ namespace ft
 	};
 
 
+	/*******************************************************
+	 *             distance / advance / next / prev        *
+	 *******************************************************/
+
+	/* Picked at compile time from the iterator_category: random access iterators jump with
+	   operator- / operator+=, the others walk one step at a time.
+	   std tags are handled too since they are not related to ours (std::list iterators etc.) */
+
+	template <class InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	distance_dispatch(InputIterator first, InputIterator last, ft::input_iterator_tag)
+	{
+		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
+
+		for (; first != last; ++first)
+			++n;
+		return (n);
+	}
+
+	template <class InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	distance_dispatch(InputIterator first, InputIterator last, std::input_iterator_tag)
+	{ return (ft::distance_dispatch(first, last, ft::input_iterator_tag())); }
+
+	template <class RandomAccessIterator>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type
+	distance_dispatch(RandomAccessIterator first, RandomAccessIterator last, ft::random_access_iterator_tag)
+	{ return (last - first); }
+
+	template <class RandomAccessIterator>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type
+	distance_dispatch(RandomAccessIterator first, RandomAccessIterator last, std::random_access_iterator_tag)
+	{ return (last - first); }
+
+	// Number of increments to go from first to last, O(1) for random access iterators
+	template <class InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	distance(InputIterator first, InputIterator last)
+	{ return (ft::distance_dispatch(first, last, typename ft::iterator_traits<InputIterator>::iterator_category())); }
+
+
+	// Input and forward iterators can only go forward, n must be positive
+	template <class InputIterator, class Distance>
+	void advance_dispatch(InputIterator& it, Distance n, ft::input_iterator_tag)
+	{
+		for (; n > 0; --n)
+			++it;
+	}
+
+	template <class InputIterator, class Distance>
+	void advance_dispatch(InputIterator& it, Distance n, std::input_iterator_tag)
+	{ ft::advance_dispatch(it, n, ft::input_iterator_tag()); }
+
+	template <class BidirectionalIterator, class Distance>
+	void advance_dispatch(BidirectionalIterator& it, Distance n, ft::bidirectional_iterator_tag)
+	{
+		for (; n > 0; --n)
+			++it;
+		for (; n < 0; ++n)
+			--it;
+	}
+
+	template <class BidirectionalIterator, class Distance>
+	void advance_dispatch(BidirectionalIterator& it, Distance n, std::bidirectional_iterator_tag)
+	{ ft::advance_dispatch(it, n, ft::bidirectional_iterator_tag()); }
+
+	template <class RandomAccessIterator, class Distance>
+	void advance_dispatch(RandomAccessIterator& it, Distance n, ft::random_access_iterator_tag)
+	{ it += n; }
+
+	template <class RandomAccessIterator, class Distance>
+	void advance_dispatch(RandomAccessIterator& it, Distance n, std::random_access_iterator_tag)
+	{ it += n; }
+
+	// Moves it n elements, backward if n is negative (bidirectional and random access only)
+	template <class InputIterator, class Distance>
+	void advance(InputIterator& it, Distance n)
+	{ ft::advance_dispatch(it, n, typename ft::iterator_traits<InputIterator>::iterator_category()); }
+
+	template <class InputIterator>
+	InputIterator next(InputIterator it, typename ft::iterator_traits<InputIterator>::difference_type n = 1)
+	{
+		ft::advance(it, n);
+		return (it);
+	}
+
+	template <class BidirectionalIterator>
+	BidirectionalIterator prev(BidirectionalIterator it, typename ft::iterator_traits<BidirectionalIterator>::difference_type n = 1)
+	{
+		ft::advance(it, -n);
+		return (it);
+	}
+
+	// Random access iterators can be moved in O(1), whichever tag (ft or std) they use
+	template <class Iterator>
+	struct is_random_access_iterator
+	{
+		typedef typename ft::iterator_traits<Iterator>::iterator_category category;
+
+		static const bool value = ft::is_same<category, ft::random_access_iterator_tag>::value
+								  || ft::is_same<category, std::random_access_iterator_tag>::value;
+	};
+
+
+
+	/*******************************************************
+	 *                Contiguous iterators                 *
+	 *******************************************************/
+
+	/* random_access_iterator_tag doesn't tell if elements are next to each other in memory
+	   (std::deque isn't), algorithms check this to work on raw memory (memcmp, memcpy, SIMD).
+	   Pointers are, container iterators specialize it (see VectorIterator.hpp) */
+	template <class Iterator>
+	struct is_contiguous_iterator { static const bool value = false; };
+
+	template <class T>
+	struct is_contiguous_iterator<T*> { static const bool value = true; };
+
+	template <class T>
+	struct is_contiguous_iterator<const T*> { static const bool value = true; };
+
+	// Address of the element an iterator points to, without dereferencing it (works on end())
+	template <class T>
+	T* to_address(T* ptr) { return (ptr); }
+
+	template <class Iterator>
+	typename ft::iterator_traits<Iterator>::pointer to_address(const Iterator& it) { return (it.operator->()); }
+
+
+
 	/*******************************************************
 	 *                  Reverse iterator                   *
 	 *******************************************************/
@@ -0,0 +1,427 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 07:13 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LSM_MAP_HPP
+# define LSM_MAP_HPP
+
+#include "bloom_filter.hpp"
+#include "map.hpp"
+#include "pairs.hpp"
+#include "sharded_map.hpp"
+#include "vector.hpp"
+
+#include <functional>
+
+/* Writes buffered in the memtable before it becomes a sorted run */
+#define LSM_MEMTABLE_SIZE 4096
+
+/* A run is merged into the one before it (older) while that one is under LSM_GROWTH times its size,
+   so sizes grow by about LSM_GROWTH from the newest run to the oldest */
+#define LSM_GROWTH 4
+
+/* False positive rate of the Bloom filter of each run */
+#define LSM_BLOOM_FPR 0.01
+
+namespace ft
+{
+	// Counters of an lsm_map: write amplification is records_written / writes, read amplification
+	// runs_searched / lookups
+	struct lsm_stats
+	{
+		size_t	runs;
+		size_t	writes; // insert_or_assign / erase calls
+		size_t	records_written; // Records written to runs, by flushes and merges
+		size_t	lookups; // find / count / insert calls that reached the runs
+		size_t	runs_searched; // Binary searches in runs
+		size_t	runs_filtered; // Runs skipped thanks to their Bloom filter
+
+		lsm_stats() : runs(0), writes(0), records_written(0), lookups(0), runs_searched(0), runs_filtered(0) { }
+	};
+
+	/*******************************************************
+	 *                        lsm_map                      *
+	 *******************************************************/
+
+	/*
+		Ordered map for write heavy loads, organised as a log structured merge tree: writes go to a
+		small ft::map (the memtable), which once LSM_MEMTABLE_SIZE keys are in becomes an immutable
+		sorted array (a run), merged with the previous runs while they aren't much bigger (see
+		LSM_GROWTH). Writes are blind: insert_or_assign and erase (a tombstone) don't look for the
+		key in the runs, the newest record of a key wins, older ones disappear in merges.
+		Lookups check the memtable then the runs from newest to oldest, skipping the runs whose
+		Bloom filter doesn't have the key. for_each merges the memtable and the runs in key order.
+		Writes need exclusive access. Const members only read the map, threads can run them at the
+		same time (the lookup counters they update are relaxed atomics)
+	*/
+	template <class Key, class T, class Compare = std::less<Key>, class Hash = ft::shard_hash<Key> >
+	class lsm_map
+	{
+		public:
+			typedef Key										key_type;
+			typedef T										mapped_type;
+			typedef ft::pair<const key_type, mapped_type>	value_type;
+			typedef Compare									key_compare;
+			typedef Hash									hasher;
+			typedef size_t									size_type;
+
+		private:
+			// Latest write of a key in the memtable
+			struct slot
+			{
+				mapped_type	value;
+				bool		erased;
+
+				slot() : value(), erased(false) { }
+				slot(const mapped_type& v, bool e) : value(v), erased(e) { }
+			};
+
+			typedef ft::map<key_type, slot, key_compare>	memtable_type;
+			typedef ft::bloom_filter<key_type, hasher>		filter_type;
+
+			struct record
+			{
+				key_type	key;
+				mapped_type	value;
+				bool		erased; // Tombstone, hides the key in older runs
+			};
+
+			struct run
+			{
+				ft::vector<record>	records;
+				filter_type			filter;
+
+				void swap(run& other)
+				{
+					this->records.swap(other.records);
+					this->filter.swap(other.filter);
+				}
+			};
+
+			memtable_type		_memtable;
+			size_t				_memtableSize;
+			ft::vector<run>		_runs; // Oldest first
+			key_compare			_comp;
+			hasher				_hash;
+			mutable lsm_stats	_stats; // lookups, runs_searched and runs_filtered are updated atomically
+
+			// Index of the first record not before k
+			size_t lowerBound(const run& r, const key_type& k) const
+			{
+				size_t low = 0, n = r.records.size();
+
+				while (n > 0)
+				{
+					size_t half = n / 2;
+					if (this->_comp(r.records[low + half].key, k))
+					{
+						low += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return (low);
+			}
+
+			void buildFilter(run& r) const
+			{
+				filter_type filter(r.records.size(), LSM_BLOOM_FPR);
+
+				for (size_t i = 0; i < r.records.size(); ++i)
+					filter.insert_hash(this->_hash(r.records[i].key));
+				r.filter.swap(filter);
+			}
+
+			void write(const key_type& k, const slot& s)
+			{
+				++this->_stats.writes;
+				ft::pair<typename memtable_type::iterator, bool> res = this->_memtable.insert(ft::make_pair(k, s));
+				if (!res.second)
+					res.first->second = s;
+				else if (++this->_memtableSize >= LSM_MEMTABLE_SIZE)
+					this->flush();
+			}
+
+			// Newer records win, tombstones are dropped from the oldest run (nothing left to hide)
+			void mergeRuns(const run& older, const run& newer, bool oldest, run& out)
+			{
+				const ft::vector<record>& a = older.records;
+				const ft::vector<record>& b = newer.records;
+				size_t i = 0, j = 0;
+
+				out.records.reserve(a.size() + b.size());
+				while (i < a.size() || j < b.size())
+				{
+					const record* next;
+					if (j == b.size() || (i < a.size() && this->_comp(a[i].key, b[j].key)))
+						next = &a[i++];
+					else
+					{
+						if (i < a.size() && !this->_comp(b[j].key, a[i].key))
+							++i; // Same key, older record dropped
+						next = &b[j++];
+					}
+					if (!oldest || !next->erased)
+						out.records.push_back(*next);
+				}
+				this->buildFilter(out);
+				this->_stats.records_written += out.records.size();
+			}
+
+			// The newest run is merged while the one before isn't LSM_GROWTH times bigger
+			void mergeNewest(bool all)
+			{
+				while (this->_runs.size() >= 2)
+				{
+					run& newer = this->_runs.back();
+					run& older = this->_runs[this->_runs.size() - 2];
+					if (!all && older.records.size() >= newer.records.size() * LSM_GROWTH)
+						break ;
+					run merged;
+					this->mergeRuns(older, newer, this->_runs.size() == 2, merged);
+					older.swap(merged);
+					this->_runs.pop_back();
+				}
+			}
+
+			// Const lookups may run on several threads, their counters are added atomically once per lookup
+			void countLookup(size_t searched, size_t filtered) const
+			{
+				__atomic_add_fetch(&this->_stats.lookups, 1, __ATOMIC_RELAXED);
+				__atomic_add_fetch(&this->_stats.runs_searched, searched, __ATOMIC_RELAXED);
+				if (filtered != 0)
+					__atomic_add_fetch(&this->_stats.runs_filtered, filtered, __ATOMIC_RELAXED);
+			}
+
+			// Newest record of k: 1 if it holds a value (copied to obj when given), 0 if erased, -1 if none
+			int search(const key_type& k, mapped_type* obj) const
+			{
+				const typename memtable_type::const_iterator it = this->_memtable.find(k);
+
+				if (it != this->_memtable.end())
+				{
+					if (obj != NULL && !it->second.erased)
+						*obj = it->second.value;
+					return (it->second.erased ? 0 : 1);
+				}
+				if (this->_runs.empty())
+					return (-1);
+				const size_t hash = this->_hash(k);
+				size_t searched = 0;
+				for (size_t i = this->_runs.size(); i-- > 0; )
+				{
+					const run& r = this->_runs[i];
+					if (!r.filter.may_contain_hash(hash))
+						continue ;
+					++searched;
+					const size_t pos = this->lowerBound(r, k);
+					if (pos < r.records.size() && !this->_comp(k, r.records[pos].key))
+					{
+						if (obj != NULL && !r.records[pos].erased)
+							*obj = r.records[pos].value;
+						this->countLookup(searched, this->_runs.size() - i - searched);
+						return (r.records[pos].erased ? 0 : 1);
+					}
+				}
+				this->countLookup(searched, this->_runs.size() - searched);
+				return (-1);
+			}
+
+			/* Merge of the memtable and the runs, from the first key not before first (if given) to
+			   the last before last (if given): the newest record of each key, tombstones skipped */
+			template <class Function>
+			void merge(const key_type* first, const key_type* last, Function& fn) const
+			{
+				typename memtable_type::const_iterator mem = this->_memtable.begin();
+				const typename memtable_type::const_iterator memEnd = this->_memtable.end();
+				ft::vector<size_t> positions(this->_runs.size(), 0);
+
+				if (first != NULL)
+				{
+					while (mem != memEnd && this->_comp(mem->first, *first))
+						++mem;
+					for (size_t i = 0; i < this->_runs.size(); ++i)
+						positions[i] = this->lowerBound(this->_runs[i], *first);
+				}
+				for (;;)
+				{
+					// Smallest key of all levels
+					const key_type* smallest = (mem != memEnd) ? &mem->first : NULL;
+					for (size_t i = 0; i < this->_runs.size(); ++i)
+						if (positions[i] < this->_runs[i].records.size())
+						{
+							const key_type& k = this->_runs[i].records[positions[i]].key;
+							if (smallest == NULL || this->_comp(k, *smallest))
+								smallest = &k;
+						}
+					if (smallest == NULL || (last != NULL && !this->_comp(*smallest, *last)))
+						break ;
+
+					// Newest level first, older records of the key are passed
+					const key_type key = *smallest;
+					const mapped_type* value = NULL;
+					bool found = false, erased = false;
+					if (mem != memEnd && !this->_comp(key, mem->first))
+					{
+						found = true;
+						erased = mem->second.erased;
+						value = &mem->second.value;
+						++mem;
+					}
+					for (size_t i = this->_runs.size(); i-- > 0; )
+					{
+						size_t& pos = positions[i];
+						const ft::vector<record>& records = this->_runs[i].records;
+						if (pos < records.size() && !this->_comp(key, records[pos].key))
+						{
+							if (!found)
+							{
+								found = true;
+								erased = records[pos].erased;
+								value = &records[pos].value;
+							}
+							++pos;
+						}
+					}
+					if (!erased)
+						fn(value_type(key, *value));
+				}
+			}
+
+			struct counter
+			{
+				size_type n;
+				counter() : n(0) { }
+				void operator()(const value_type&) { ++this->n; }
+			};
+
+		public:
+			explicit lsm_map(const key_compare& comp = key_compare(), const hasher& hash = hasher())
+			: _memtable(comp), _memtableSize(0), _comp(comp), _hash(hash) { }
+
+			// O(n), every level is merged
+			size_type size() const { return (this->for_each(counter()).n); }
+			bool empty() const { return (this->size() == 0); }
+
+			key_compare key_comp() const { return (this->_comp); }
+
+			void clear()
+			{
+				this->_memtable.clear();
+				this->_memtableSize = 0;
+				this->_runs.clear();
+			}
+
+			/***************** Writes *****************/
+
+			// Blind write, replaces any older value
+			void insert_or_assign(const key_type& k, const mapped_type& obj) { this->write(k, slot(obj, false)); }
+
+			// False if the key was already there (its value is left as it was), needs a lookup first
+			bool insert(const value_type& val)
+			{
+				if (this->search(val.first, NULL) == 1)
+					return (false);
+				this->write(val.first, slot(val.second, false));
+				return (true);
+			}
+
+			// Blind erase, a tombstone hides the key until merges reach its older records
+			void erase(const key_type& k) { this->write(k, slot(mapped_type(), true)); }
+
+			// Turns the memtable into the newest run (and merges it as usual)
+			void flush()
+			{
+				if (this->_memtableSize == 0)
+					return ;
+				run r;
+				r.records.reserve(this->_memtableSize);
+				for (typename memtable_type::const_iterator it = this->_memtable.begin(); it != this->_memtable.end(); ++it)
+				{
+					record rec;
+					rec.key = it->first;
+					rec.value = it->second.value;
+					rec.erased = it->second.erased;
+					r.records.push_back(rec);
+				}
+				this->buildFilter(r);
+				this->_stats.records_written += r.records.size();
+				this->_runs.push_back(run());
+				this->_runs.back().swap(r);
+				this->_memtable.clear();
+				this->_memtableSize = 0;
+				this->mergeNewest(false);
+			}
+
+			// Everything in a single run, without tombstones: the fastest reads
+			void compact()
+			{
+				this->flush();
+				const bool single = (this->_runs.size() == 1); // Otherwise the last merge drops tombstones
+				this->mergeNewest(true);
+				if (single)
+				{
+					run merged;
+					this->mergeRuns(run(), this->_runs[0], true, merged);
+					this->_runs[0].swap(merged);
+				}
+			}
+
+			/***************** Reads *****************/
+
+			// Copies the value of k into obj, false if k isn't there
+			bool find(const key_type& k, mapped_type& obj) const { return (this->search(k, &obj) == 1); }
+
+			size_type count(const key_type& k) const { return (this->search(k, NULL) == 1); }
+
+			// Calls fn(const value_type&) on every element in key order
+			template <class Function>
+			Function for_each(Function fn) const
+			{
+				this->merge(NULL, NULL, fn);
+				return (fn);
+			}
+
+			// Same on the keys in [first, last) only
+			template <class Function>
+			Function for_each_in(const key_type& first, const key_type& last, Function fn) const
+			{
+				this->merge(&first, &last, fn);
+				return (fn);
+			}
+
+			/***************** Statistics *****************/
+
+			lsm_stats stats() const
+			{
+				lsm_stats s = this->_stats;
+				s.lookups = __atomic_load_n(&this->_stats.lookups, __ATOMIC_RELAXED);
+				s.runs_searched = __atomic_load_n(&this->_stats.runs_searched, __ATOMIC_RELAXED);
+				s.runs_filtered = __atomic_load_n(&this->_stats.runs_filtered, __ATOMIC_RELAXED);
+				s.runs = this->_runs.size();
+				return (s);
+			}
+
+			void reset_stats() { this->_stats = lsm_stats(); }
+
+			// Records in the runs (with older versions and tombstones) and memtable entries
+			size_type records() const
+			{
+				size_type n = this->_memtableSize;
+				for (size_t i = 0; i < this->_runs.size(); ++i)
+					n += this->_runs[i].records.size();
+				return (n);
+			}
+	};
+}
+
+#endif
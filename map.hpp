@@ -6,7 +6,7 @@
 /*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
 /*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
 /*   Created: 16-03-2022  by  `-'                        `-'                  */
-/*   Updated: 17-03-2022 19:54 by                                             */
+/*   Updated: 18-10-2026 05:48 by                                             */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,6 +57,10 @@ namespace ft
 		private:
 			typedef RedBlackTree<value_type, value_compare, allocator_type> tree_type;
 
+			// Walks the tree for the parallel algorithms (parallel_tree.hpp)
+			template <class Container>
+			friend struct tree_access;
+
 		public:
 			typedef typename tree_type::iterator		iterator;
 			typedef typename tree_type::const_iterator	const_iterator;
@@ -92,14 +96,14 @@ namespace ft
 			// Default constructor / empty
 			explicit map(const key_compare& comp = key_compare(),
 			             const allocator_type& alloc = allocator_type())
-						 : _comp(comp), _alloc(alloc), _tree() { }
+						 : _comp(comp), _alloc(alloc), _tree(value_compare(), alloc) { }
 
 			// Range constructor
 			template <class InputIterator>
 			map(InputIterator first, InputIterator last,
 			     const key_compare& comp = key_compare(),
 				 const allocator_type& alloc = allocator_type())
-				 : _comp(comp), _alloc(alloc), _tree()
+				 : _comp(comp), _alloc(alloc), _tree(value_compare(), alloc)
 			{
 				while (first != last)
 				{
@@ -111,11 +115,10 @@ namespace ft
 			// Copy constructor, deep copy tree
 			map(const map& x) : _comp(x._comp), _alloc(x._alloc), _tree(x._tree) { }
 
-			// Assignation operator
+			// Assignation operator, the allocator stays ours (see RedBlackTree::operator=)
 			map& operator=(const map& x)
 			{
 				this->_comp = x._comp;
-				this->_alloc = x._alloc;
 				this->_tree = x._tree;
 				
 				return (*this);
@@ -187,12 +190,11 @@ namespace ft
 			// Since iterator being erased is invalidated on remove, first save next node
 			void erase(iterator first, iterator last)
 			{
-				iterator tmp;
 				while (first != last)
 				{
-					tmp = first;
-					++first;
-					this->_tree.remove(*tmp);
+					iterator next = ft::next(first);
+					this->_tree.remove(*first);
+					first = next;
 				}
 			}
 
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:36 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MEMORY_HPP
+# define MEMORY_HPP
+
+#include "algorithm.hpp"
+#include "iterators.hpp"
+#include "type_traits.hpp"
+
+#include <new>
+#include <cstring>
+
+namespace ft
+{
+	/* Same as the algorithm.hpp ones, but the destination is raw memory: elements are constructed
+	   (placement new) instead of assigned. If a constructor throws, everything constructed so far
+	   is destroyed before rethrowing, so the memory is raw again, nothing leaks */
+
+	/*******************************************************
+	 *                       destroy                       *
+	 *******************************************************/
+
+	template <class ForwardIterator>
+	void destroy_dispatch(ForwardIterator first, ForwardIterator last, ft::false_type)
+	{
+		typedef typename ft::iterator_traits<ForwardIterator>::value_type value_type;
+
+		for (; first != last; ++first)
+			(&*first)->~value_type();
+	}
+
+	// Trivial destructors do nothing, no need to even walk the range
+	template <class ForwardIterator>
+	void destroy_dispatch(ForwardIterator, ForwardIterator, ft::true_type) { }
+
+	template <class ForwardIterator>
+	void destroy(ForwardIterator first, ForwardIterator last)
+	{
+		typedef typename ft::iterator_traits<ForwardIterator>::value_type value_type;
+
+		ft::destroy_dispatch(first, last,
+							 typename ft::choose<ft::is_trivially_copyable<value_type>::value, ft::true_type, ft::false_type>::type());
+	}
+
+	/*******************************************************
+	 *                 uninitialized_copy                  *
+	 *******************************************************/
+
+	template <class InputIterator, class ForwardIterator>
+	ForwardIterator uninitialized_copy_dispatch(InputIterator first, InputIterator last,
+												ForwardIterator result, ft::false_type)
+	{
+		typedef typename ft::iterator_traits<ForwardIterator>::value_type value_type;
+
+		ForwardIterator current = result;
+		try
+		{
+			for (; first != last; ++first, ++current)
+				new (static_cast<void*>(&*current)) value_type(*first);
+		}
+		catch (...)
+		{
+			ft::destroy(result, current);
+			throw;
+		}
+		return (current);
+	}
+
+	// Raw memory can't overlap live elements, memcpy is enough
+	template <class InputIterator, class ForwardIterator>
+	ForwardIterator uninitialized_copy_dispatch(InputIterator first, InputIterator last,
+												ForwardIterator result, ft::true_type)
+	{
+		const size_t n = last - first;
+
+		if (n != 0)
+			std::memcpy(ft::to_address(result), ft::to_address(first), n * sizeof(*first));
+		return (result + n);
+	}
+
+	template <class InputIterator, class ForwardIterator>
+	ForwardIterator uninitialized_copy(InputIterator first, InputIterator last, ForwardIterator result)
+	{
+		return (ft::uninitialized_copy_dispatch(first, last, result,
+												typename ft::is_memcpyable<InputIterator, ForwardIterator>::type()));
+	}
+
+	/*******************************************************
+	 *                 uninitialized_fill                  *
+	 *******************************************************/
+
+	template <class ForwardIterator, class T>
+	ForwardIterator uninitialized_fill_n_dispatch(ForwardIterator first, size_t n, const T& val, ft::false_type)
+	{
+		typedef typename ft::iterator_traits<ForwardIterator>::value_type value_type;
+
+		ForwardIterator current = first;
+		try
+		{
+			for (; n > 0; --n, ++current)
+				new (static_cast<void*>(&*current)) value_type(val);
+		}
+		catch (...)
+		{
+			ft::destroy(first, current);
+			throw;
+		}
+		return (current);
+	}
+
+	// Trivially copyable elements can be assigned to raw memory: fill_n (memset when it can)
+	template <class ForwardIterator, class T>
+	ForwardIterator uninitialized_fill_n_dispatch(ForwardIterator first, size_t n, const T& val, ft::true_type)
+	{ return (ft::fill_n(first, n, val)); }
+
+	template <class ForwardIterator, class Size, class T>
+	ForwardIterator uninitialized_fill_n(ForwardIterator first, Size n, const T& val)
+	{
+		if (n <= 0)
+			return (first);
+		return (ft::uninitialized_fill_n_dispatch(first, static_cast<size_t>(n), val,
+												  typename ft::is_contiguous_trivial<ForwardIterator>::type()));
+	}
+
+	template <class ForwardIterator, class T>
+	void uninitialized_fill(ForwardIterator first, ForwardIterator last, const T& val)
+	{
+		ft::uninitialized_fill_n(first, ft::distance(first, last), val);
+	}
+
+}
+
+#endif
@@ -0,0 +1,613 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:48 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MEMORY_RESOURCE_HPP
+# define MEMORY_RESOURCE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <pthread.h>
+
+/* Strictest alignment of the fundamental types (what operator new gives) */
+#define MEMORY_RESOURCE_MAX_ALIGN 16
+
+/* First buffer a monotonic_buffer_resource asks upstream for, each next one is twice bigger */
+#define MONOTONIC_BUFFER_INITIAL_SIZE 1024
+
+/* pool_options defaults (0 in the options), and their limits */
+#define POOL_RESOURCE_MAX_BLOCKS_PER_CHUNK 1024
+#define POOL_RESOURCE_LARGEST_BLOCK 4096
+#define POOL_RESOURCE_MAX_LARGEST_BLOCK ((size_t)1 << 20)
+#define POOL_RESOURCE_MIN_BLOCK 8
+#define POOL_RESOURCE_FIRST_BLOCKS 16
+#define POOL_RESOURCE_POOLS 18 // Blocks of 8 bytes to 1MiB
+
+namespace ft
+{
+	/*******************************************************
+	 *                   Memory resource                   *
+	 *******************************************************/
+
+	/*
+		Where a polymorphic_allocator takes its memory from, chosen at run time instead of by a
+		template argument: containers using ft::polymorphic_allocator<T> all have the same type,
+		whichever resource (arena, pool, plain new / delete) they were given.
+
+		Resources aren't copyable and must outlive the containers using them.
+	*/
+	class memory_resource
+	{
+		public:
+			virtual ~memory_resource() { }
+
+			void* allocate(size_t bytes, size_t alignment = MEMORY_RESOURCE_MAX_ALIGN)
+			{ return (this->do_allocate(bytes, alignment)); }
+
+			// bytes and alignment must be the ones p was allocated with
+			void deallocate(void* p, size_t bytes, size_t alignment = MEMORY_RESOURCE_MAX_ALIGN)
+			{ this->do_deallocate(p, bytes, alignment); }
+
+			// Whether memory allocated by one can be deallocated by the other
+			bool is_equal(const memory_resource& other) const { return (this->do_is_equal(other)); }
+
+		private:
+			virtual void* do_allocate(size_t bytes, size_t alignment) = 0;
+			virtual void do_deallocate(void* p, size_t bytes, size_t alignment) = 0;
+			virtual bool do_is_equal(const memory_resource& other) const = 0;
+	};
+
+	inline bool operator==(const memory_resource& a, const memory_resource& b)
+	{ return (&a == &b || a.is_equal(b)); }
+
+	inline bool operator!=(const memory_resource& a, const memory_resource& b)
+	{ return (!(a == b)); }
+
+	// operator new / delete, posix_memalign for the over-aligned
+	class new_delete_resource_type : public memory_resource
+	{
+		private:
+			virtual void* do_allocate(size_t bytes, size_t alignment)
+			{
+				if (alignment <= MEMORY_RESOURCE_MAX_ALIGN)
+					return (::operator new(bytes));
+
+				void* p = NULL;
+				if (posix_memalign(&p, alignment, bytes) != 0)
+					throw std::bad_alloc();
+				return (p);
+			}
+
+			virtual void do_deallocate(void* p, size_t, size_t alignment)
+			{
+				if (alignment <= MEMORY_RESOURCE_MAX_ALIGN)
+					::operator delete(p);
+				else
+					std::free(p);
+			}
+
+			virtual bool do_is_equal(const memory_resource& other) const { return (this == &other); }
+	};
+
+	// Throws std::bad_alloc on every allocation, as the upstream of a buffer which must be enough
+	class null_memory_resource_type : public memory_resource
+	{
+		private:
+			virtual void* do_allocate(size_t, size_t) { throw std::bad_alloc(); }
+			virtual void do_deallocate(void*, size_t, size_t) { }
+			virtual bool do_is_equal(const memory_resource& other) const { return (this == &other); }
+	};
+
+	inline memory_resource* new_delete_resource()
+	{
+		static new_delete_resource_type resource;
+		return (&resource);
+	}
+
+	inline memory_resource* null_memory_resource()
+	{
+		static null_memory_resource_type resource;
+		return (&resource);
+	}
+
+	inline memory_resource*& default_resource_storage()
+	{
+		static memory_resource* resource = NULL;
+		return (resource);
+	}
+
+	// Resource of the default constructed polymorphic_allocators, new_delete_resource() if never set
+	inline memory_resource* get_default_resource()
+	{
+		memory_resource* resource = __atomic_load_n(&ft::default_resource_storage(), __ATOMIC_ACQUIRE);
+		return (resource != NULL ? resource : ft::new_delete_resource());
+	}
+
+	// Returns the previous one, NULL sets back new_delete_resource()
+	inline memory_resource* set_default_resource(memory_resource* resource)
+	{
+		memory_resource* previous = __atomic_exchange_n(&ft::default_resource_storage(), resource, __ATOMIC_ACQ_REL);
+		return (previous != NULL ? previous : ft::new_delete_resource());
+	}
+
+	/*******************************************************
+	 *                Polymorphic allocator                *
+	 *******************************************************/
+
+	/* Allocator forwarding to a memory_resource, eg.
+	     ft::unsynchronized_pool_resource pool;
+	     ft::map<int, int, std::less<int>, ft::polymorphic_allocator<ft::pair<const int, int> > > m(std::less<int>(), &pool);
+	   Copies (and rebound copies, for the nodes) keep the resource. Containers assigned to keep
+	   theirs, swapped ones exchange them */
+	template <class T>
+	class polymorphic_allocator
+	{
+		public:
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef const T*	const_pointer;
+			typedef T&			reference;
+			typedef const T&	const_reference;
+			typedef size_t		size_type;
+			typedef ptrdiff_t	difference_type;
+
+			template <class U>
+			struct rebind { typedef polymorphic_allocator<U> other; };
+
+		private:
+			memory_resource* _resource;
+
+		public:
+			polymorphic_allocator() : _resource(ft::get_default_resource()) { }
+			polymorphic_allocator(memory_resource* resource) : _resource(resource) { }
+			polymorphic_allocator(const polymorphic_allocator& other) : _resource(other._resource) { }
+			template <class U>
+			polymorphic_allocator(const polymorphic_allocator<U>& other) : _resource(other.resource()) { }
+			~polymorphic_allocator() { }
+
+			polymorphic_allocator& operator=(const polymorphic_allocator& other)
+			{
+				this->_resource = other._resource;
+				return (*this);
+			}
+
+			pointer address(reference x) const { return (&x); }
+			const_pointer address(const_reference x) const { return (&x); }
+
+			pointer allocate(size_type n, const void* hint = 0)
+			{
+				(void)hint;
+				if (n > this->max_size())
+					throw std::bad_alloc();
+				return (static_cast<pointer>(this->_resource->allocate(n * sizeof(T), __alignof__(T))));
+			}
+
+			void deallocate(pointer p, size_type n) { this->_resource->deallocate(p, n * sizeof(T), __alignof__(T)); }
+
+			size_type max_size() const { return (std::numeric_limits<size_type>::max() / sizeof(T)); }
+
+			void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) T(val); }
+			void destroy(pointer p) { p->~T(); }
+
+			memory_resource* resource() const { return (this->_resource); }
+	};
+
+	template <class T, class U>
+	bool operator==(const polymorphic_allocator<T>& a, const polymorphic_allocator<U>& b)
+	{ return (*a.resource() == *b.resource()); }
+
+	template <class T, class U>
+	bool operator!=(const polymorphic_allocator<T>& a, const polymorphic_allocator<U>& b)
+	{ return (!(a == b)); }
+
+	/*******************************************************
+	 *              Monotonic buffer resource              *
+	 *******************************************************/
+
+	/*
+		Arena: allocations are carved one after the other from a buffer, deallocate does nothing,
+		everything is given back at once by release() or the destructor. When the buffer is full,
+		a twice bigger one is asked to upstream. Fastest there is, for containers built then
+		thrown away as a whole (a request, a frame...). Not thread safe.
+	*/
+	class monotonic_buffer_resource : public memory_resource
+	{
+		private:
+			// Header of the buffers from upstream, linked to release them
+			struct chunk
+			{
+				chunk*	next;
+				size_t	bytes;
+			};
+
+			memory_resource*	_upstream;
+			void*				_initialBuffer;
+			size_t				_initialSize;
+			char*				_current;
+			size_t				_left;
+			size_t				_nextSize;
+			size_t				_firstSize; // _nextSize back to it on release()
+			chunk*				_chunks;
+
+			monotonic_buffer_resource(const monotonic_buffer_resource&);
+			monotonic_buffer_resource& operator=(const monotonic_buffer_resource&);
+
+			static size_t padding(const char* p, size_t alignment)
+			{ return ((alignment - reinterpret_cast<size_t>(p) % alignment) % alignment); }
+
+			// Sizes are checked before adding, a wrapped sum would ask upstream for a tiny chunk
+			void grow(size_t bytes, size_t alignment)
+			{
+				const size_t max = std::numeric_limits<size_t>::max();
+				if (bytes > max - alignment - sizeof(chunk))
+					throw std::bad_alloc();
+
+				const size_t needed = bytes + alignment + sizeof(chunk);
+				size_t size = this->_nextSize;
+				while (size < needed)
+					size = (size > max / 2) ? needed : size * 2;
+
+				chunk* c = static_cast<chunk*>(this->_upstream->allocate(size, MEMORY_RESOURCE_MAX_ALIGN));
+				c->next = this->_chunks;
+				c->bytes = size;
+				this->_chunks = c;
+				this->_current = reinterpret_cast<char*>(c) + sizeof(chunk);
+				this->_left = size - sizeof(chunk);
+				this->_nextSize = (size > std::numeric_limits<size_t>::max() / 2) ? size : size * 2;
+			}
+
+		public:
+			explicit monotonic_buffer_resource(memory_resource* upstream = ft::get_default_resource())
+			: _upstream(upstream), _initialBuffer(NULL), _initialSize(0), _current(NULL), _left(0),
+			  _nextSize(MONOTONIC_BUFFER_INITIAL_SIZE), _firstSize(_nextSize), _chunks(NULL) { }
+
+			explicit monotonic_buffer_resource(size_t initialSize, memory_resource* upstream = ft::get_default_resource())
+			: _upstream(upstream), _initialBuffer(NULL), _initialSize(0), _current(NULL), _left(0),
+			  _nextSize(initialSize > sizeof(chunk) ? initialSize : MONOTONIC_BUFFER_INITIAL_SIZE), _firstSize(_nextSize), _chunks(NULL) { }
+
+			// Starts with buffer (which isn't freed), then goes to upstream
+			monotonic_buffer_resource(void* buffer, size_t size, memory_resource* upstream = ft::get_default_resource())
+			: _upstream(upstream), _initialBuffer(buffer), _initialSize(size), _current(static_cast<char*>(buffer)),
+			  _left(size), _nextSize(size > MONOTONIC_BUFFER_INITIAL_SIZE ? size * 2 : MONOTONIC_BUFFER_INITIAL_SIZE),
+			  _firstSize(_nextSize), _chunks(NULL) { }
+
+			virtual ~monotonic_buffer_resource() { this->release(); }
+
+			// Everything allocated is given back, the initial buffer (if any) is reused
+			void release()
+			{
+				while (this->_chunks != NULL)
+				{
+					chunk* c = this->_chunks;
+					this->_chunks = c->next;
+					this->_upstream->deallocate(c, c->bytes, MEMORY_RESOURCE_MAX_ALIGN);
+				}
+				this->_current = static_cast<char*>(this->_initialBuffer);
+				this->_left = this->_initialSize;
+				this->_nextSize = this->_firstSize;
+			}
+
+			memory_resource* upstream_resource() const { return (this->_upstream); }
+
+		private:
+			virtual void* do_allocate(size_t bytes, size_t alignment)
+			{
+				size_t pad = padding(this->_current, alignment);
+
+				if (this->_current == NULL || bytes > this->_left || pad > this->_left - bytes)
+				{
+					this->grow(bytes, alignment);
+					pad = padding(this->_current, alignment);
+				}
+
+				char* p = this->_current + pad;
+				this->_current = p + bytes;
+				this->_left -= pad + bytes;
+				return (p);
+			}
+
+			virtual void do_deallocate(void*, size_t, size_t) { }
+
+			virtual bool do_is_equal(const memory_resource& other) const { return (this == &other); }
+	};
+
+	/*******************************************************
+	 *                   Pool resources                    *
+	 *******************************************************/
+
+	struct pool_options
+	{
+		size_t max_blocks_per_chunk; // Blocks a pool asks upstream for at most at once, 0 for the default
+		size_t largest_required_pool_block; // Bigger allocations go straight to upstream, 0 for the default
+
+		pool_options() : max_blocks_per_chunk(0), largest_required_pool_block(0) { }
+	};
+
+	/*
+		Pools of blocks of 8, 16, 32... bytes up to options().largest_required_pool_block: an
+		allocation takes a block of the smallest pool it fits in, from the pool free list, a
+		deallocation puts it back. A pool without free blocks asks upstream for a chunk of them,
+		of twice more blocks each time, up to max_blocks_per_chunk. Bigger (or over-aligned)
+		allocations go to upstream, tracked so that release() / the destructor gives back
+		everything. Memory freed to a pool is only reused by that pool until then.
+		Not thread safe, see synchronized_pool_resource.
+	*/
+	class unsynchronized_pool_resource : public memory_resource
+	{
+		private:
+			struct chunk
+			{
+				chunk*	next;
+				size_t	bytes;
+			};
+
+			struct pool
+			{
+				void*	free;
+				chunk*	chunks;
+				size_t	nextBlocks;
+			};
+
+			// In front of the big allocations, kept in a list to release them
+			struct large_header
+			{
+				large_header*	prev;
+				large_header*	next;
+				size_t			bytes;
+				size_t			alignment;
+			};
+
+			memory_resource*	_upstream;
+			pool_options		_options;
+			size_t				_poolCount;
+			pool				_pools[POOL_RESOURCE_POOLS];
+			large_header		_large; // Sentinel of the big allocations list
+
+			unsynchronized_pool_resource(const unsynchronized_pool_resource&);
+			unsynchronized_pool_resource& operator=(const unsynchronized_pool_resource&);
+
+			void init()
+			{
+				if (this->_options.max_blocks_per_chunk == 0 || this->_options.max_blocks_per_chunk > POOL_RESOURCE_MAX_BLOCKS_PER_CHUNK)
+					this->_options.max_blocks_per_chunk = POOL_RESOURCE_MAX_BLOCKS_PER_CHUNK;
+				if (this->_options.largest_required_pool_block == 0)
+					this->_options.largest_required_pool_block = POOL_RESOURCE_LARGEST_BLOCK;
+
+				size_t largest = POOL_RESOURCE_MIN_BLOCK;
+				this->_poolCount = 1;
+				while (largest < this->_options.largest_required_pool_block && largest < POOL_RESOURCE_MAX_LARGEST_BLOCK)
+				{
+					largest *= 2;
+					++this->_poolCount;
+				}
+				this->_options.largest_required_pool_block = largest;
+
+				for (size_t i = 0; i < POOL_RESOURCE_POOLS; ++i)
+				{
+					this->_pools[i].free = NULL;
+					this->_pools[i].chunks = NULL;
+					this->_pools[i].nextBlocks = POOL_RESOURCE_FIRST_BLOCKS;
+				}
+				this->_large.prev = &this->_large;
+				this->_large.next = &this->_large;
+			}
+
+			static size_t blockSize(size_t index) { return ((size_t)POOL_RESOURCE_MIN_BLOCK << index); }
+
+			static size_t poolIndex(size_t bytes)
+			{
+				size_t index = 0;
+				while (blockSize(index) < bytes)
+					++index;
+				return (index);
+			}
+
+			// Free blocks are raw memory, their first bytes hold the next free one
+			static void* nextFree(void* block)
+			{
+				void* next;
+				std::memcpy(&next, block, sizeof(next));
+				return (next);
+			}
+
+			static void setNextFree(void* block, void* next) { std::memcpy(block, &next, sizeof(next)); }
+
+			// Chunks are aligned on MEMORY_RESOURCE_MAX_ALIGN, the header takes that much
+			static size_t chunkHeaderSize() { return (MEMORY_RESOURCE_MAX_ALIGN); }
+
+			void refill(size_t index)
+			{
+				pool& p = this->_pools[index];
+				const size_t size = blockSize(index);
+				const size_t bytes = chunkHeaderSize() + p.nextBlocks * size;
+
+				chunk* c = static_cast<chunk*>(this->_upstream->allocate(bytes, MEMORY_RESOURCE_MAX_ALIGN));
+				c->next = p.chunks;
+				c->bytes = bytes;
+				p.chunks = c;
+
+				char* blocks = reinterpret_cast<char*>(c) + chunkHeaderSize();
+				for (size_t i = p.nextBlocks; i-- > 0;)
+				{
+					setNextFree(blocks + i * size, p.free);
+					p.free = blocks + i * size;
+				}
+				if (p.nextBlocks * 2 <= this->_options.max_blocks_per_chunk)
+					p.nextBlocks *= 2;
+			}
+
+			// Big allocations: the header sits right before the block, which stays aligned
+			static size_t largeOffset(size_t alignment)
+			{ return ((sizeof(large_header) + alignment - 1) / alignment * alignment); }
+
+			void* allocateLarge(size_t bytes, size_t alignment)
+			{
+				alignment = std::max(alignment, (size_t)MEMORY_RESOURCE_MAX_ALIGN);
+
+				const size_t offset = largeOffset(alignment);
+				if (bytes > std::numeric_limits<size_t>::max() - offset)
+					throw std::bad_alloc();
+				char* raw = static_cast<char*>(this->_upstream->allocate(bytes + offset, alignment));
+				large_header* header = reinterpret_cast<large_header*>(raw + offset) - 1;
+
+				header->bytes = bytes + offset;
+				header->alignment = alignment;
+				header->prev = &this->_large;
+				header->next = this->_large.next;
+				this->_large.next->prev = header;
+				this->_large.next = header;
+				return (raw + offset);
+			}
+
+			void deallocateLarge(large_header* header)
+			{
+				header->prev->next = header->next;
+				header->next->prev = header->prev;
+				this->_upstream->deallocate(reinterpret_cast<char*>(header + 1) - largeOffset(header->alignment),
+											header->bytes, header->alignment);
+			}
+
+			bool pooled(size_t bytes, size_t alignment) const
+			{ return (bytes <= this->_options.largest_required_pool_block && alignment <= MEMORY_RESOURCE_MAX_ALIGN); }
+
+		public:
+			explicit unsynchronized_pool_resource(memory_resource* upstream = ft::get_default_resource())
+			: _upstream(upstream), _options(), _poolCount(0) { this->init(); }
+
+			explicit unsynchronized_pool_resource(const pool_options& options, memory_resource* upstream = ft::get_default_resource())
+			: _upstream(upstream), _options(options), _poolCount(0) { this->init(); }
+
+			virtual ~unsynchronized_pool_resource() { this->release(); }
+
+			// Gives back every chunk and every big allocation to upstream
+			void release()
+			{
+				for (size_t i = 0; i < this->_poolCount; ++i)
+				{
+					pool& p = this->_pools[i];
+					while (p.chunks != NULL)
+					{
+						chunk* c = p.chunks;
+						p.chunks = c->next;
+						this->_upstream->deallocate(c, c->bytes, MEMORY_RESOURCE_MAX_ALIGN);
+					}
+					p.free = NULL;
+					p.nextBlocks = POOL_RESOURCE_FIRST_BLOCKS;
+				}
+				while (this->_large.next != &this->_large)
+					this->deallocateLarge(this->_large.next);
+			}
+
+			memory_resource* upstream_resource() const { return (this->_upstream); }
+
+			pool_options options() const { return (this->_options); }
+
+		private:
+			virtual void* do_allocate(size_t bytes, size_t alignment)
+			{
+				if (!this->pooled(bytes, alignment))
+					return (this->allocateLarge(bytes, alignment));
+
+				// A block of 2^k bytes is aligned on 2^k, up to MEMORY_RESOURCE_MAX_ALIGN
+				const size_t index = poolIndex(std::max(bytes, alignment));
+				pool& p = this->_pools[index];
+
+				if (p.free == NULL)
+					this->refill(index);
+
+				void* block = p.free;
+				p.free = nextFree(block);
+				return (block);
+			}
+
+			virtual void do_deallocate(void* p, size_t bytes, size_t alignment)
+			{
+				if (!this->pooled(bytes, alignment))
+				{
+					this->deallocateLarge(static_cast<large_header*>(p) - 1);
+					return ;
+				}
+
+				pool& pl = this->_pools[poolIndex(std::max(bytes, alignment))];
+				setNextFree(p, pl.free);
+				pl.free = p;
+			}
+
+			virtual bool do_is_equal(const memory_resource& other) const { return (this == &other); }
+	};
+
+	/* unsynchronized_pool_resource behind a mutex, for containers shared by several threads (or
+	   moved from one thread to another). Threads allocating a lot each from their own containers
+	   are better off with a pool resource per thread, or ft::thread_cache_allocator */
+	class synchronized_pool_resource : public memory_resource
+	{
+		private:
+			unsynchronized_pool_resource	_pools;
+			pthread_mutex_t					_mutex;
+
+			synchronized_pool_resource(const synchronized_pool_resource&);
+			synchronized_pool_resource& operator=(const synchronized_pool_resource&);
+
+		public:
+			explicit synchronized_pool_resource(memory_resource* upstream = ft::get_default_resource())
+			: _pools(upstream) { pthread_mutex_init(&this->_mutex, NULL); }
+
+			explicit synchronized_pool_resource(const pool_options& options, memory_resource* upstream = ft::get_default_resource())
+			: _pools(options, upstream) { pthread_mutex_init(&this->_mutex, NULL); }
+
+			virtual ~synchronized_pool_resource() { pthread_mutex_destroy(&this->_mutex); }
+
+			void release()
+			{
+				pthread_mutex_lock(&this->_mutex);
+				this->_pools.release();
+				pthread_mutex_unlock(&this->_mutex);
+			}
+
+			memory_resource* upstream_resource() const { return (this->_pools.upstream_resource()); }
+
+			pool_options options() const { return (this->_pools.options()); }
+
+		private:
+			virtual void* do_allocate(size_t bytes, size_t alignment)
+			{
+				pthread_mutex_lock(&this->_mutex);
+				void* p = NULL;
+				try
+				{
+					p = this->_pools.allocate(bytes, alignment);
+				}
+				catch (...)
+				{
+					pthread_mutex_unlock(&this->_mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&this->_mutex);
+				return (p);
+			}
+
+			virtual void do_deallocate(void* p, size_t bytes, size_t alignment)
+			{
+				pthread_mutex_lock(&this->_mutex);
+				this->_pools.deallocate(p, bytes, alignment);
+				pthread_mutex_unlock(&this->_mutex);
+			}
+
+			virtual bool do_is_equal(const memory_resource& other) const { return (this == &other); }
+	};
+
+}
+
+#endif
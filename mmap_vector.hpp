@@ -0,0 +1,314 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 07:12 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MMAP_VECTOR_HPP
+# define MMAP_VECTOR_HPP
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "VectorIterator.hpp"
+#include "enable_if.hpp"
+#include "iterators.hpp"
+#include "type_traits.hpp"
+
+/* File header, a cache line so that the elements after it stay aligned */
+#define MMAP_VECTOR_HEADER_SIZE 64
+#define MMAP_VECTOR_MAGIC 0x66745f6d6d766331UL
+
+namespace ft
+{
+	inline void mmap_vector_error(const std::string& what)
+	{
+		throw (std::runtime_error("mmap_vector: " + what + ": " + std::strerror(errno)));
+	}
+
+	/*
+		Vector whose elements are the contents of a file, mapped in memory: opening an existing
+		one gives access to its elements at once, pages are read when first touched, no copy.
+		reserve grows the file (ftruncate) and remaps it, the capacity doubles as usual. Changes
+		reach the file when the kernel writes the pages back, flush() waits for it (msync).
+
+		The file starts with a header (magic, sizeof(T), size) then the elements, up to the
+		capacity. Only for trivially copyable T (no pointers inside either, they wouldn't mean
+		anything once reopened): elements are bytes of the file. Not copyable, only one object
+		(in one process) should open a file at a time.
+	*/
+	template <class T>
+	class mmap_vector
+	{
+		private:
+			// Only compiles for trivially copyable T
+			typedef typename ft::enable_if<ft::is_trivially_copyable<T>::value, T>::type checked_type;
+
+			struct header
+			{
+				unsigned long	magic;
+				size_t			elementSize;
+				size_t			size;
+			};
+
+		public:
+			typedef T				value_type;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			typedef VectIterator<T, false>					iterator;
+			typedef VectIterator<T, true>					const_iterator;
+			typedef ft::reverse_iterator<iterator>			reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+		private:
+			std::string	_path;
+			int			_fd;
+			char*		_map;
+			size_type	_capacity;
+
+			mmap_vector(const mmap_vector&);
+			mmap_vector& operator=(const mmap_vector&);
+
+			header* fileHeader() const { return (reinterpret_cast<header*>(this->_map)); }
+			// VectIterator<T, true> is built from a T*, like vector's from its pointer
+			T*		elements() const { return (reinterpret_cast<T*>(this->_map + MMAP_VECTOR_HEADER_SIZE)); }
+
+			// capacity is at most max_size(), checked by the callers before it reaches ftruncate
+			static size_t fileSize(size_type capacity) { return (MMAP_VECTOR_HEADER_SIZE + capacity * sizeof(T)); }
+
+			// Doubling for push_back / append, up to max_size()
+			size_type grownCapacity(size_type needed) const
+			{
+				if (this->_capacity > this->max_size() / 2)
+					return (std::max(needed, this->max_size()));
+				return (std::max(needed, this->_capacity == 0 ? 1 : this->_capacity * 2));
+			}
+
+			void mapFile(size_t bytes)
+			{
+				void* p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+				if (p == MAP_FAILED)
+					mmap_vector_error("mmap " + this->_path);
+				this->_map = static_cast<char*>(p);
+			}
+
+			// Resizes the file to capacity elements, and the mapping with it
+			void remap(size_type capacity)
+			{
+				const size_t oldBytes = fileSize(this->_capacity);
+				const size_t bytes = fileSize(capacity);
+
+				if (ftruncate(this->_fd, bytes) != 0)
+					mmap_vector_error("ftruncate " + this->_path);
+#ifdef MREMAP_MAYMOVE
+				void* p = mremap(this->_map, oldBytes, bytes, MREMAP_MAYMOVE);
+				if (p == MAP_FAILED)
+					mmap_vector_error("mremap " + this->_path);
+				this->_map = static_cast<char*>(p);
+#else
+				munmap(this->_map, oldBytes);
+				this->mapFile(bytes);
+#endif
+				this->_capacity = capacity;
+			}
+
+			void close()
+			{
+				if (this->_map != NULL)
+					munmap(this->_map, fileSize(this->_capacity));
+				if (this->_fd >= 0)
+					::close(this->_fd);
+				this->_map = NULL;
+				this->_fd = -1;
+			}
+
+		public:
+			// Opens path, or creates it empty if it doesn't exist
+			explicit mmap_vector(const std::string& path) : _path(path), _fd(-1), _map(NULL), _capacity(0)
+			{
+				struct stat st;
+
+				this->_fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+				if (this->_fd < 0)
+					mmap_vector_error("open " + path);
+				try
+				{
+					if (fstat(this->_fd, &st) != 0)
+						mmap_vector_error("fstat " + path);
+
+					if (st.st_size == 0)
+					{
+						if (ftruncate(this->_fd, MMAP_VECTOR_HEADER_SIZE) != 0)
+							mmap_vector_error("ftruncate " + path);
+						this->mapFile(MMAP_VECTOR_HEADER_SIZE);
+						this->fileHeader()->magic = MMAP_VECTOR_MAGIC;
+						this->fileHeader()->elementSize = sizeof(T);
+						this->fileHeader()->size = 0;
+						return ;
+					}
+
+					if ((size_t)st.st_size < MMAP_VECTOR_HEADER_SIZE || ((size_t)st.st_size - MMAP_VECTOR_HEADER_SIZE) % sizeof(T) != 0)
+					{
+						errno = EINVAL;
+						mmap_vector_error("not an mmap_vector of this type: " + path);
+					}
+					this->_capacity = ((size_t)st.st_size - MMAP_VECTOR_HEADER_SIZE) / sizeof(T);
+					this->mapFile(st.st_size);
+					if (this->fileHeader()->magic != MMAP_VECTOR_MAGIC || this->fileHeader()->elementSize != sizeof(T)
+						|| this->fileHeader()->size > this->_capacity)
+					{
+						errno = EINVAL;
+						mmap_vector_error("not an mmap_vector of this type: " + path);
+					}
+				}
+				catch (...)
+				{
+					this->close();
+					throw;
+				}
+			}
+
+			// Unmaps the file, without waiting for the pages to be written (see flush)
+			~mmap_vector() { this->close(); }
+
+			/********** Iterators **********/
+			iterator		begin() { return (iterator(this->data())); }
+			const_iterator	begin() const { return (const_iterator(this->elements())); }
+
+			iterator		end() { return (iterator(this->data() + this->size())); }
+			const_iterator	end() const { return (const_iterator(this->elements() + this->size())); }
+
+			reverse_iterator		rbegin() { return (reverse_iterator(this->end())); }
+			const_reverse_iterator	rbegin() const { return (const_reverse_iterator(this->end())); }
+
+			reverse_iterator		rend() { return (reverse_iterator(this->begin())); }
+			const_reverse_iterator	rend() const { return (const_reverse_iterator(this->begin())); }
+
+			/********** Capacity **********/
+			size_type	size() const { return (this->fileHeader()->size); }
+			size_type	capacity() const { return (this->_capacity); }
+			bool		empty() const { return (this->size() == 0); }
+
+			// The most elements a file can hold without its size overflowing
+			size_type	max_size() const { return ((std::numeric_limits<size_t>::max() - MMAP_VECTOR_HEADER_SIZE) / sizeof(T)); }
+
+			void reserve(size_type n)
+			{
+				if (n > this->max_size())
+					throw (std::length_error("mmap_vector: reserve: value requested too big"));
+				if (n > this->_capacity)
+					this->remap(n);
+			}
+
+			// Shrinks the file to the elements
+			void shrink_to_fit()
+			{
+				if (this->size() < this->_capacity)
+					this->remap(this->size());
+			}
+
+			/********** Element access **********/
+			T*			data() { return (reinterpret_cast<T*>(this->_map + MMAP_VECTOR_HEADER_SIZE)); }
+			const T*	data() const { return (reinterpret_cast<const T*>(this->_map + MMAP_VECTOR_HEADER_SIZE)); }
+
+			reference		operator[](size_type n) { return (this->data()[n]); }
+			const_reference	operator[](size_type n) const { return (this->data()[n]); }
+
+			reference at(size_type n)
+			{
+				if (n >= this->size())
+					throw (std::out_of_range("index is out of range"));
+				return ((*this)[n]);
+			}
+
+			const_reference at(size_type n) const
+			{
+				if (n >= this->size())
+					throw (std::out_of_range("index is out of range"));
+				return ((*this)[n]);
+			}
+
+			reference		front() { return (this->data()[0]); }
+			const_reference	front() const { return (this->data()[0]); }
+
+			reference		back() { return (this->data()[this->size() - 1]); }
+			const_reference	back() const { return (this->data()[this->size() - 1]); }
+
+			/********** Modifiers **********/
+			void push_back(const value_type& val)
+			{
+				const size_type n = this->size();
+
+				if (n == this->_capacity)
+				{
+					if (n == this->max_size())
+						throw (std::length_error("mmap_vector: push_back: already at max_size"));
+					this->reserve(this->grownCapacity(n + 1));
+				}
+				std::memcpy(static_cast<void*>(this->data() + n), &val, sizeof(T));
+				this->fileHeader()->size = n + 1;
+			}
+
+			void pop_back() { --this->fileHeader()->size; }
+
+			// Appends count elements at once (one remap at most, one memcpy)
+			void append(const T* first, size_type count)
+			{
+				const size_type n = this->size();
+
+				if (count > this->max_size() - n)
+					throw (std::length_error("mmap_vector: append: source too big"));
+				if (n + count > this->_capacity)
+					this->reserve(this->grownCapacity(n + count));
+				std::memcpy(static_cast<void*>(this->data() + n), first, count * sizeof(T));
+				this->fileHeader()->size = n + count;
+			}
+
+			void resize(size_type n, const value_type& val = value_type())
+			{
+				const size_type size = this->size();
+
+				if (n > this->max_size())
+					throw (std::length_error("mmap_vector: resize: value requested too big"));
+				this->reserve(n);
+				for (size_type i = size; i < n; ++i)
+					std::memcpy(static_cast<void*>(this->data() + i), &val, sizeof(T));
+				this->fileHeader()->size = n;
+			}
+
+			// The file keeps its size, see shrink_to_fit
+			void clear() { this->fileHeader()->size = 0; }
+
+			// Waits for every change to be written to the file
+			void flush()
+			{
+				if (msync(this->_map, fileSize(this->_capacity), MS_SYNC) != 0)
+					mmap_vector_error("msync " + this->_path);
+			}
+
+			const std::string& path() const { return (this->_path); }
+	};
+
+}
+
+#endif
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:44 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NUMERIC_HPP
+# define NUMERIC_HPP
+
+#include "is_integral.hpp"
+#include "iterators.hpp"
+#include "simd_reduce.hpp"
+#include "utils.hpp"
+
+namespace ft
+{
+	/*******************************************************
+	 *                        reduce                       *
+	 *******************************************************/
+
+	/* Like an accumulate, except that the order in which elements are summed is unspecified:
+	   contiguous int / float / double ranges are summed by the SIMD kernels, one partial sum per lane.
+	   Only used when init has the element type, reduce(ints, 0LL) must sum as long long */
+	template <class Iterator, class T>
+	struct is_simd_summable
+	{
+		typedef typename ft::remove_const<typename ft::iterator_traits<Iterator>::value_type>::type value_type;
+
+		static const bool value = ft::is_contiguous_iterator<Iterator>::value
+								  && ft::is_same<value_type, T>::value
+								  && ft::has_simd_reduction<value_type>::value;
+
+		typedef typename ft::choose<value, ft::true_type, ft::false_type>::type type;
+	};
+
+	template <class InputIterator, class T, class BinaryOperation>
+	T reduce(InputIterator first, InputIterator last, T init, BinaryOperation op)
+	{
+		for (; first != last; ++first)
+			init = op(init, *first);
+		return (init);
+	}
+
+	template <class InputIterator, class T>
+	T reduce_dispatch(InputIterator first, InputIterator last, T init, ft::false_type)
+	{
+		for (; first != last; ++first)
+			init = init + *first;
+		return (init);
+	}
+
+	template <class InputIterator, class T>
+	T reduce_dispatch(InputIterator first, InputIterator last, T init, ft::true_type)
+	{ return (init + ft::simd_sum(ft::to_address(first), last - first)); }
+
+	// ints wrap around instead of overflowing
+	template <class InputIterator>
+	int reduce_dispatch(InputIterator first, InputIterator last, int init, ft::true_type)
+	{
+		return (static_cast<int>(static_cast<unsigned int>(init)
+								 + static_cast<unsigned int>(ft::simd_sum(ft::to_address(first), last - first))));
+	}
+
+	template <class InputIterator, class T>
+	T reduce(InputIterator first, InputIterator last, T init)
+	{ return (ft::reduce_dispatch(first, last, init, typename ft::is_simd_summable<InputIterator, T>::type())); }
+
+	template <class InputIterator>
+	typename ft::iterator_traits<InputIterator>::value_type reduce(InputIterator first, InputIterator last)
+	{ return (ft::reduce(first, last, typename ft::iterator_traits<InputIterator>::value_type())); }
+
+}
+
+#endif
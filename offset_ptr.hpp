@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:51 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef OFFSET_PTR_HPP
+# define OFFSET_PTR_HPP
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "iterators.hpp"
+
+namespace ft
+{
+	/*
+		Pointer stored as the distance from itself to what it points to, instead of an address:
+		a structure whose pointers are all offset_ptrs (and which is all in one block of memory)
+		stays valid wherever that block is mapped, eg. a shared memory segment mapped at a
+		different address by each process (see shm_allocator.hpp).
+
+		Copying one recomputes the distance from the new place, so it can live anywhere
+		(stack, registers), only what's pointed to must be in the same block as the offset_ptrs
+		stored in it. Converts to and from T* implicitly: comparisons, NULL and pointer
+		arithmetic are the built-in ones.
+	*/
+	template <class T>
+	class offset_ptr
+	{
+		public:
+			typedef T							element_type;
+			typedef T							value_type;
+			typedef ptrdiff_t					difference_type;
+			typedef T*							pointer;
+			typedef T&							reference;
+			typedef ft::random_access_iterator_tag	iterator_category;
+
+			template <class U>
+			struct rebind { typedef offset_ptr<U> other; };
+
+		private:
+			/* NULL is 1: a pointer to its own second byte can't point to a T. The sums are done on integers,
+			   pointer arithmetic between unrelated objects is undefined (and the compiler acts on it) */
+			ptrdiff_t _offset;
+
+			ptrdiff_t offsetTo(const T* p) const
+			{
+				if (p == NULL)
+					return (1);
+				return ((ptrdiff_t)(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(this)));
+			}
+
+		public:
+			offset_ptr() : _offset(1) { }
+			offset_ptr(T* p) : _offset(offsetTo(p)) { }
+			offset_ptr(const offset_ptr& other) : _offset(offsetTo(other.get())) { }
+			template <class U>
+			offset_ptr(const offset_ptr<U>& other) : _offset(offsetTo(other.get())) { }
+			~offset_ptr() { }
+
+			offset_ptr& operator=(const offset_ptr& other)
+			{
+				this->_offset = this->offsetTo(other.get());
+				return (*this);
+			}
+
+			offset_ptr& operator=(T* p)
+			{
+				this->_offset = this->offsetTo(p);
+				return (*this);
+			}
+
+			T* get() const
+			{
+				if (this->_offset == 1)
+					return (NULL);
+				return (reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(this) + this->_offset));
+			}
+
+			operator T*() const { return (this->get()); }
+
+			T* operator->() const { return (this->get()); }
+			T& operator*() const { return (*this->get()); }
+
+			offset_ptr& operator++() { this->_offset += sizeof(T); return (*this); }
+			offset_ptr& operator--() { this->_offset -= sizeof(T); return (*this); }
+			offset_ptr operator++(int) { offset_ptr tmp(*this); ++(*this); return (tmp); }
+			offset_ptr operator--(int) { offset_ptr tmp(*this); --(*this); return (tmp); }
+
+			offset_ptr& operator+=(difference_type n) { this->_offset += n * (difference_type)sizeof(T); return (*this); }
+			offset_ptr& operator-=(difference_type n) { this->_offset -= n * (difference_type)sizeof(T); return (*this); }
+	};
+
+	// Points to contiguous elements like T*, so the memcpy / SIMD paths apply (ft::to_address gives the T*)
+	template <class T>
+	struct is_contiguous_iterator<offset_ptr<T> > { static const bool value = true; };
+
+}
+
+#endif
@@ -0,0 +1,299 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:03 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLEL_HPP
+# define PARALLEL_HPP
+
+#include "algorithm.hpp"
+#include "memory.hpp"
+#include "numeric.hpp"
+#include "parallel_for.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/*******************************************************
+	 *          Parallel fill / generate / transform       *
+	 *******************************************************/
+
+	/* Each chunk writes its own part of the range: on memory which was just allocated, the pages
+	   are first touched (and so placed, on NUMA machines) by the threads writing them */
+
+	template <class RandomAccessIterator, class T>
+	struct parallel_fill_chunk
+	{
+		RandomAccessIterator	first;
+		const T*				value;
+
+		void operator()(size_t begin, size_t end) { ft::fill_n(this->first + begin, end - begin, *this->value); }
+	};
+
+	template <class RandomAccessIterator, class Size, class T>
+	RandomAccessIterator parallel_fill_n(RandomAccessIterator first, Size count, const T& value)
+	{
+		const size_t n = (count > 0) ? static_cast<size_t>(count) : 0;
+
+		if (!ft::parallel_worth_it(n))
+			return (ft::fill_n(first, n, value));
+
+		parallel_fill_chunk<RandomAccessIterator, T> chunk;
+		chunk.first = first;
+		chunk.value = &value;
+		ft::parallel_for(0, n, ft::parallel_grain(n), chunk);
+		return (first + n);
+	}
+
+	template <class RandomAccessIterator, class T>
+	void parallel_fill(RandomAccessIterator first, RandomAccessIterator last, const T& value)
+	{ ft::parallel_fill_n(first, last - first, value); }
+
+	template <class RandomAccessIterator, class Generator>
+	struct parallel_generate_chunk
+	{
+		RandomAccessIterator	first;
+		const Generator*		gen;
+
+		void operator()(size_t begin, size_t end)
+		{
+			Generator gen = *this->gen;
+			ft::generate(this->first + begin, this->first + end, gen);
+		}
+	};
+
+	/* Each chunk calls its own copy of gen, the copies run at the same time in several threads:
+	   gen can't count on being called in order nor share state without synchronizing it */
+	template <class RandomAccessIterator, class Generator>
+	void parallel_generate(RandomAccessIterator first, RandomAccessIterator last, Generator gen)
+	{
+		const size_t n = last - first;
+
+		if (!ft::parallel_worth_it(n))
+			return (ft::generate(first, last, gen));
+
+		parallel_generate_chunk<RandomAccessIterator, Generator> chunk;
+		chunk.first = first;
+		chunk.gen = &gen;
+		ft::parallel_for(0, n, ft::parallel_grain(n), chunk);
+	}
+
+	template <class RandomAccessIterator1, class RandomAccessIterator2, class UnaryOperation>
+	struct parallel_transform_chunk
+	{
+		RandomAccessIterator1	first;
+		RandomAccessIterator2	result;
+		const UnaryOperation*	op;
+
+		void operator()(size_t begin, size_t end)
+		{ ft::transform(this->first + begin, this->first + end, this->result + begin, *this->op); }
+	};
+
+	// op may be called for several elements at the same time
+	template <class RandomAccessIterator1, class RandomAccessIterator2, class UnaryOperation>
+	RandomAccessIterator2 parallel_transform(RandomAccessIterator1 first, RandomAccessIterator1 last,
+											 RandomAccessIterator2 result, UnaryOperation op)
+	{
+		const size_t n = last - first;
+
+		if (!ft::parallel_worth_it(n))
+			return (ft::transform(first, last, result, op));
+
+		parallel_transform_chunk<RandomAccessIterator1, RandomAccessIterator2, UnaryOperation> chunk;
+		chunk.first = first;
+		chunk.result = result;
+		chunk.op = &op;
+		ft::parallel_for(0, n, ft::parallel_grain(n), chunk);
+		return (result + n);
+	}
+
+	template <class RandomAccessIterator1, class RandomAccessIterator2, class RandomAccessIterator3, class BinaryOperation>
+	struct parallel_transform2_chunk
+	{
+		RandomAccessIterator1	first1;
+		RandomAccessIterator2	first2;
+		RandomAccessIterator3	result;
+		const BinaryOperation*	op;
+
+		void operator()(size_t begin, size_t end)
+		{ ft::transform(this->first1 + begin, this->first1 + end, this->first2 + begin, this->result + begin, *this->op); }
+	};
+
+	template <class RandomAccessIterator1, class RandomAccessIterator2, class RandomAccessIterator3, class BinaryOperation>
+	RandomAccessIterator3 parallel_transform(RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+											 RandomAccessIterator2 first2, RandomAccessIterator3 result, BinaryOperation op)
+	{
+		const size_t n = last1 - first1;
+
+		if (!ft::parallel_worth_it(n))
+			return (ft::transform(first1, last1, first2, result, op));
+
+		parallel_transform2_chunk<RandomAccessIterator1, RandomAccessIterator2, RandomAccessIterator3, BinaryOperation> chunk;
+		chunk.first1 = first1;
+		chunk.first2 = first2;
+		chunk.result = result;
+		chunk.op = &op;
+		ft::parallel_for(0, n, ft::parallel_grain(n), chunk);
+		return (result + n);
+	}
+
+	/*******************************************************
+	 *                   Parallel reductions               *
+	 *******************************************************/
+
+	/* Random access ranges only: each chunk runs the sequential algorithm (and so its
+	   SIMD kernels) on its part, one result per chunk, combined by the calling thread */
+
+	template <class RandomAccessIterator, class T>
+	struct parallel_reduce_chunk
+	{
+		RandomAccessIterator	first;
+		size_t					grain;
+		T*						results;
+
+		void operator()(size_t begin, size_t end)
+		{ this->results[begin / this->grain] = ft::reduce(this->first + begin, this->first + end, T()); }
+	};
+
+	template <class RandomAccessIterator, class T>
+	T parallel_reduce(RandomAccessIterator first, RandomAccessIterator last, T init)
+	{
+		const size_t n = last - first;
+
+		if (!ft::parallel_worth_it(n))
+			return (ft::reduce(first, last, init));
+
+		parallel_reduce_chunk<RandomAccessIterator, T> chunk;
+		chunk.grain = ft::parallel_grain(n);
+		ft::vector<T> results((n - 1) / chunk.grain + 1);
+		chunk.first = first;
+		chunk.results = &results[0];
+		ft::parallel_for(0, n, chunk.grain, chunk);
+		return (ft::reduce(results.begin(), results.end(), init));
+	}
+
+	template <class RandomAccessIterator, class T>
+	struct parallel_count_chunk
+	{
+		RandomAccessIterator	first;
+		size_t					grain;
+		const T*				value;
+		size_t*					results;
+
+		void operator()(size_t begin, size_t end)
+		{ this->results[begin / this->grain] = ft::count(this->first + begin, this->first + end, *this->value); }
+	};
+
+	template <class RandomAccessIterator, class T>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type
+	parallel_count(RandomAccessIterator first, RandomAccessIterator last, const T& value)
+	{
+		const size_t n = last - first;
+
+		if (!ft::parallel_worth_it(n))
+			return (ft::count(first, last, value));
+
+		parallel_count_chunk<RandomAccessIterator, T> chunk;
+		chunk.grain = ft::parallel_grain(n);
+		ft::vector<size_t> results((n - 1) / chunk.grain + 1);
+		chunk.first = first;
+		chunk.value = &value;
+		chunk.results = &results[0];
+		ft::parallel_for(0, n, chunk.grain, chunk);
+		return (ft::reduce(results.begin(), results.end(), size_t(0)));
+	}
+
+	/* Chunks after one where the value was found don't need to be searched, found only goes down
+	   (chunks run in any order, a chunk before the one found is still searched) */
+	template <class RandomAccessIterator, class T>
+	struct parallel_find_chunk
+	{
+		RandomAccessIterator	first;
+		const T*				value;
+		size_t*					found;
+
+		void operator()(size_t begin, size_t end)
+		{
+			if (begin >= __atomic_load_n(this->found, __ATOMIC_RELAXED))
+				return;
+
+			size_t index = ft::find(this->first + begin, this->first + end, *this->value) - this->first;
+			if (index == end)
+				return;
+
+			size_t current = __atomic_load_n(this->found, __ATOMIC_RELAXED);
+			while (index < current
+				   && !__atomic_compare_exchange_n(this->found, &current, index, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				;
+		}
+	};
+
+	template <class RandomAccessIterator, class T>
+	RandomAccessIterator parallel_find(RandomAccessIterator first, RandomAccessIterator last, const T& value)
+	{
+		const size_t n = last - first;
+
+		if (!ft::parallel_worth_it(n))
+			return (ft::find(first, last, value));
+
+		parallel_find_chunk<RandomAccessIterator, T> chunk;
+		size_t found = n;
+		chunk.first = first;
+		chunk.value = &value;
+		chunk.found = &found;
+		ft::parallel_for(0, n, ft::parallel_grain(n), chunk);
+		return (first + found);
+	}
+
+	template <class RandomAccessIterator>
+	struct parallel_minmax_chunk
+	{
+		RandomAccessIterator									first;
+		size_t													grain;
+		ft::pair<RandomAccessIterator, RandomAccessIterator>*	results;
+
+		void operator()(size_t begin, size_t end)
+		{ this->results[begin / this->grain] = ft::minmax_element(this->first + begin, this->first + end); }
+	};
+
+	/* Same rules as minmax_element: earliest chunk holding the smallest, latest one holding the largest.
+	   With NaNs there is no order to speak of, the result may then differ from minmax_element's */
+	template <class RandomAccessIterator>
+	ft::pair<RandomAccessIterator, RandomAccessIterator>
+	parallel_minmax_element(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef ft::pair<RandomAccessIterator, RandomAccessIterator> result_type;
+
+		const size_t n = last - first;
+
+		if (!ft::parallel_worth_it(n))
+			return (ft::minmax_element(first, last));
+
+		parallel_minmax_chunk<RandomAccessIterator> chunk;
+		chunk.grain = ft::parallel_grain(n);
+		ft::vector<result_type> results((n - 1) / chunk.grain + 1);
+		chunk.first = first;
+		chunk.results = &results[0];
+		ft::parallel_for(0, n, chunk.grain, chunk);
+
+		result_type result = results[0];
+		for (size_t i = 1; i < results.size(); ++i)
+		{
+			if (*results[i].first < *result.first)
+				result.first = results[i].first;
+			if (!(*results[i].second < *result.second))
+				result.second = results[i].second;
+		}
+		return (result);
+	}
+
+}
+
+#endif
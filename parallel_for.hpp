@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:03 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLEL_FOR_HPP
+# define PARALLEL_FOR_HPP
+
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+/* Under this many elements, waking threads up costs more than what they would save */
+#define PARALLEL_MIN_SIZE ((size_t)1 << 20)
+
+/* Smallest chunk given to a thread */
+#define PARALLEL_MIN_GRAIN ((size_t)1 << 16)
+
+/* Entry point of the parallel algorithms (parallel.hpp) and of the containers parallel
+   construction, kept apart from them so that containers can include it */
+
+namespace ft
+{
+	// Asks for the parallel version of a constructor, eg. vector(ft::parallel_tag(), n, value)
+	struct parallel_tag { };
+
+	/* Calls fn(begin, end) on the chunks of grain indexes of [first, last) from the threads of
+	   the shared pool, see thread_pool::parallel_for */
+	template <class Function>
+	void parallel_for(size_t first, size_t last, size_t grain, Function fn)
+	{ ft::thread_pool::shared().parallel_for(first, last, grain, fn); }
+
+	// Chunk size splitting n elements in a few chunks per thread
+	inline size_t parallel_grain(size_t n)
+	{ return (std::max(PARALLEL_MIN_GRAIN, n / (ft::parallel_concurrency() * 4) + 1)); }
+
+	inline bool parallel_worth_it(size_t n)
+	{ return (n >= PARALLEL_MIN_SIZE && ft::parallel_concurrency() > 1); }
+
+}
+
+#endif
@@ -0,0 +1,321 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:56 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLEL_TREE_HPP
+# define PARALLEL_TREE_HPP
+
+#include "map.hpp"
+#include "parallel_for.hpp"
+#include "set.hpp"
+#include "vector.hpp"
+
+/* Under this black height, the tree is walked by the calling thread. It means at least
+   2^height - 1 nodes, around 64k for random insertions: far less than the vector algorithms need,
+   each node being a cache miss. map::size() counts the nodes, so it can't be asked before deciding */
+#define PARALLEL_TREE_MIN_BLACK_HEIGHT 10
+
+// Subtrees per thread: pieces aren't the same size, the threads which finish first steal the others
+#define PARALLEL_TREE_PIECES_PER_THREAD 8
+
+// A red-black tree of n nodes is at most 2 * log2(n + 1) deep, more than enough for 64 bits
+#define PARALLEL_TREE_STACK_SIZE 128
+
+namespace ft
+{
+	/*******************************************************
+	 *                  Tree of a map / set                *
+	 *******************************************************/
+
+	// Friend of map and set, gives their red-black tree to the parallel walks
+	template <class Container>
+	struct tree_access
+	{
+		typedef typename Container::tree_type	tree_type;
+		typedef typename tree_type::node		node;
+
+		static const tree_type& tree(const Container& c) { return (c._tree); }
+	};
+
+	/* A part of the tree, in order: the whole subtree under node, or node alone when it was
+	   above the split depth (its subtrees are pieces of their own) */
+	template <class Node>
+	struct tree_piece
+	{
+		Node*	node;
+		bool	whole;
+	};
+
+	template <class Node>
+	size_t tree_black_height(Node* node, Node* end)
+	{
+		size_t height = 0;
+
+		for (; node != NULL && node != end; node = node->left)
+			height += (node->color == BLACK);
+		return (height);
+	}
+
+	// Cuts the tree depth levels down, keeping the in order sequence of the pieces
+	template <class Node>
+	void tree_split(Node* node, Node* end, size_t depth, ft::vector<tree_piece<Node> >& pieces)
+	{
+		if (node == NULL || node == end)
+			return ;
+
+		tree_piece<Node> piece;
+		piece.node = node;
+		piece.whole = (depth == 0);
+		if (piece.whole)
+		{
+			pieces.push_back(piece);
+			return ;
+		}
+		ft::tree_split(ft::to_address(node->left), end, depth - 1, pieces);
+		pieces.push_back(piece);
+		ft::tree_split(ft::to_address(node->right), end, depth - 1, pieces);
+	}
+
+	// In order walk calling visit(node->data), with a stack of its own instead of recursion
+	template <class Node, class Visitor>
+	void tree_walk(const tree_piece<Node>& piece, Node* end, Visitor& visit)
+	{
+		if (!piece.whole)
+		{
+			visit(piece.node->data);
+			return ;
+		}
+
+		Node* stack[PARALLEL_TREE_STACK_SIZE];
+		size_t top = 0;
+		Node* curr = piece.node;
+
+		while (true)
+		{
+			for (; curr != NULL && curr != end; curr = curr->left)
+				stack[top++] = curr;
+			if (top == 0)
+				return ;
+			curr = stack[--top];
+			visit(curr->data);
+			curr = curr->right;
+		}
+	}
+
+	// Pieces of the tree to give to the threads, empty if the tree is too small for it to be worth it
+	template <class Tree>
+	ft::vector<tree_piece<typename Tree::node> > parallel_tree_pieces(const Tree& tree)
+	{
+		typedef typename Tree::node node;
+
+		ft::vector<tree_piece<node> > pieces;
+		const size_t height = ft::tree_black_height(ft::to_address(tree.getRoot()), ft::to_address(tree.getDummyEnd()));
+		const size_t threads = ft::parallel_concurrency();
+
+		if (threads < 2 || height < PARALLEL_TREE_MIN_BLACK_HEIGHT)
+			return (pieces);
+
+		// Black nodes alone make complete levels, so every piece up to height levels down exists
+		size_t depth = 0;
+		while (((size_t)1 << depth) < threads * PARALLEL_TREE_PIECES_PER_THREAD && depth < height)
+			++depth;
+		pieces.reserve(((size_t)2 << depth) - 1);
+		ft::tree_split(ft::to_address(tree.getRoot()), ft::to_address(tree.getDummyEnd()), depth, pieces);
+		return (pieces);
+	}
+
+	/*******************************************************
+	 *                   Parallel for_each                 *
+	 *******************************************************/
+
+	template <class Node, class Function>
+	struct parallel_tree_for_each_chunk
+	{
+		const tree_piece<Node>*	pieces;
+		Node*					end;
+		Function*				fn;
+
+		void operator()(size_t begin, size_t last)
+		{
+			for (size_t i = begin; i < last; ++i)
+				ft::tree_walk(this->pieces[i], this->end, *this->fn);
+		}
+	};
+
+	// Hands the elements of a const container as const
+	template <class Function>
+	struct tree_const_visitor
+	{
+		Function* fn;
+
+		template <class U>
+		void operator()(const U& value) { (*this->fn)(value); }
+	};
+
+	template <class Container, class Visitor>
+	void parallel_tree_for_each(const Container& c, Visitor& visit)
+	{
+		typedef typename tree_access<Container>::tree_type	tree_type;
+		typedef typename tree_access<Container>::node		node;
+
+		const tree_type& tree = tree_access<Container>::tree(c);
+		ft::vector<tree_piece<node> > pieces = ft::parallel_tree_pieces(tree);
+
+		if (pieces.empty())
+		{
+			tree_piece<node> all;
+			all.node = ft::to_address(tree.getRoot());
+			all.whole = true;
+			ft::tree_walk(all, ft::to_address(tree.getDummyEnd()), visit);
+			return ;
+		}
+
+		parallel_tree_for_each_chunk<node, Visitor> chunk;
+		chunk.pieces = &pieces[0];
+		chunk.end = ft::to_address(tree.getDummyEnd());
+		chunk.fn = &visit;
+		ft::parallel_for(0, pieces.size(), 1, chunk);
+	}
+
+	/* fn(value_type&) is called on every element, for several elements at the same time and in no
+	   particular order. Changing the keys (or the tree) from fn is undefined */
+	template <class Key, class T, class Compare, class Alloc, class Function>
+	void parallel_for_each(ft::map<Key, T, Compare, Alloc>& m, Function fn)
+	{ ft::parallel_tree_for_each(m, fn); }
+
+	template <class Key, class T, class Compare, class Alloc, class Function>
+	void parallel_for_each(const ft::map<Key, T, Compare, Alloc>& m, Function fn)
+	{
+		tree_const_visitor<Function> visit;
+		visit.fn = &fn;
+		ft::parallel_tree_for_each(m, visit);
+	}
+
+	template <class T, class Compare, class Alloc, class Function>
+	void parallel_for_each(const ft::set<T, Compare, Alloc>& s, Function fn)
+	{
+		tree_const_visitor<Function> visit;
+		visit.fn = &fn;
+		ft::parallel_tree_for_each(s, visit);
+	}
+
+	/*******************************************************
+	 *                    Parallel reduce                  *
+	 *******************************************************/
+
+	/* Like the random access parallel_reduce, each piece starts from T() and the partial results
+	   are combined in order by the calling thread: combine must be associative, T() its identity,
+	   commutative isn't needed */
+
+	template <class T, class BinaryOperation, class UnaryOperation>
+	struct tree_fold
+	{
+		T						acc;
+		const BinaryOperation*	combine;
+		const UnaryOperation*	transform;
+
+		template <class U>
+		void operator()(const U& value) { this->acc = (*this->combine)(this->acc, (*this->transform)(value)); }
+	};
+
+	template <class Node, class T, class BinaryOperation, class UnaryOperation>
+	struct parallel_tree_reduce_chunk
+	{
+		const tree_piece<Node>*	pieces;
+		Node*					end;
+		T*						results;
+		const BinaryOperation*	combine;
+		const UnaryOperation*	transform;
+
+		void operator()(size_t begin, size_t last)
+		{
+			for (size_t i = begin; i < last; ++i)
+			{
+				tree_fold<T, BinaryOperation, UnaryOperation> fold;
+				fold.acc = T();
+				fold.combine = this->combine;
+				fold.transform = this->transform;
+				ft::tree_walk(this->pieces[i], this->end, fold);
+				this->results[i] = fold.acc;
+			}
+		}
+	};
+
+	template <class Container, class T, class BinaryOperation, class UnaryOperation>
+	T parallel_tree_reduce(const Container& c, T init, BinaryOperation combine, UnaryOperation transform)
+	{
+		typedef typename tree_access<Container>::tree_type	tree_type;
+		typedef typename tree_access<Container>::node		node;
+
+		const tree_type& tree = tree_access<Container>::tree(c);
+		ft::vector<tree_piece<node> > pieces = ft::parallel_tree_pieces(tree);
+
+		if (pieces.empty())
+		{
+			tree_piece<node> all;
+			all.node = ft::to_address(tree.getRoot());
+			all.whole = true;
+			tree_fold<T, BinaryOperation, UnaryOperation> fold;
+			fold.acc = init;
+			fold.combine = &combine;
+			fold.transform = &transform;
+			ft::tree_walk(all, ft::to_address(tree.getDummyEnd()), fold);
+			return (fold.acc);
+		}
+
+		ft::vector<T> results(pieces.size());
+		parallel_tree_reduce_chunk<node, T, BinaryOperation, UnaryOperation> chunk;
+		chunk.pieces = &pieces[0];
+		chunk.end = ft::to_address(tree.getDummyEnd());
+		chunk.results = &results[0];
+		chunk.combine = &combine;
+		chunk.transform = &transform;
+		ft::parallel_for(0, pieces.size(), 1, chunk);
+
+		for (size_t i = 0; i < results.size(); ++i)
+			init = combine(init, results[i]);
+		return (init);
+	}
+
+	template <class Pair>
+	struct select_mapped
+	{
+		const typename Pair::second_type& operator()(const Pair& p) const { return (p.second); }
+	};
+
+	template <class T>
+	struct select_self
+	{
+		const T& operator()(const T& value) const { return (value); }
+	};
+
+	// combine(T, T) over transform(value_type) of every element
+	template <class Key, class T, class Compare, class Alloc, class U, class BinaryOperation, class UnaryOperation>
+	U parallel_reduce(const ft::map<Key, T, Compare, Alloc>& m, U init, BinaryOperation combine, UnaryOperation transform)
+	{ return (ft::parallel_tree_reduce(m, init, combine, transform)); }
+
+	// combine(U, U) over the mapped values, eg. parallel_reduce(m, 0L, std::plus<long>())
+	template <class Key, class T, class Compare, class Alloc, class U, class BinaryOperation>
+	U parallel_reduce(const ft::map<Key, T, Compare, Alloc>& m, U init, BinaryOperation combine)
+	{ return (ft::parallel_tree_reduce(m, init, combine, select_mapped<ft::pair<const Key, T> >())); }
+
+	template <class T, class Compare, class Alloc, class U, class BinaryOperation, class UnaryOperation>
+	U parallel_reduce(const ft::set<T, Compare, Alloc>& s, U init, BinaryOperation combine, UnaryOperation transform)
+	{ return (ft::parallel_tree_reduce(s, init, combine, transform)); }
+
+	// combine(U, U) over the keys
+	template <class T, class Compare, class Alloc, class U, class BinaryOperation>
+	U parallel_reduce(const ft::set<T, Compare, Alloc>& s, U init, BinaryOperation combine)
+	{ return (ft::parallel_tree_reduce(s, init, combine, select_self<T>())); }
+
+}
+
+#endif
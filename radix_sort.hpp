@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:24 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef RADIX_SORT_HPP
+# define RADIX_SORT_HPP
+
+#include "sort.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+#include "iterators.hpp"
+
+#include <cstring>
+#include <limits>
+
+// Below this many elements the 256 buckets histograms cost more than they save
+#define RADIX_SORT_THRESHOLD 256
+
+namespace ft
+{
+	/*******************************************************
+	 *                    Radix traits                     *
+	 *******************************************************/
+
+	/* Maps a key to an unsigned integer of the same width whose natural order
+	   is the key order, so that sorting bytes from least to most significant works */
+
+	// Unsigned keys are already in the right order
+	template <class Key, class Unsigned>
+	struct radix_unsigned_traits
+	{
+		typedef Unsigned radix_type;
+
+		static radix_type toRadix(Key key) { return (radix_type(key)); }
+	};
+
+	// Two's complement: negatives have the sign bit set, flipping it puts them before positives
+	template <class Key, class Unsigned>
+	struct radix_signed_traits
+	{
+		typedef Unsigned radix_type;
+
+		static radix_type toRadix(Key key)
+		{ return (radix_type(key) ^ (radix_type(1) << (sizeof(radix_type) * 8 - 1))); }
+	};
+
+	/* IEEE 754: positives compare like their bits once the sign bit is set,
+	   negatives are sign + magnitude so all their bits must be flipped to reverse their order */
+	template <class Key, class Unsigned>
+	struct radix_float_traits
+	{
+		typedef Unsigned radix_type;
+
+		static radix_type toRadix(Key key)
+		{
+			const radix_type signBit = radix_type(1) << (sizeof(radix_type) * 8 - 1);
+			radix_type bits;
+
+			std::memcpy(&bits, &key, sizeof(bits)); // Only way to read the bits without breaking aliasing rules
+			if (bits & signBit)
+				return (~bits);
+			return (bits | signBit);
+		}
+	};
+
+	// No default, sorting an unsupported key by radix will not compile
+	template <class Key>
+	struct radix_traits;
+
+	template <> struct radix_traits<unsigned char> : public radix_unsigned_traits<unsigned char, unsigned char> { };
+	template <> struct radix_traits<unsigned short> : public radix_unsigned_traits<unsigned short, unsigned short> { };
+	template <> struct radix_traits<unsigned int> : public radix_unsigned_traits<unsigned int, unsigned int> { };
+	template <> struct radix_traits<unsigned long> : public radix_unsigned_traits<unsigned long, unsigned long> { };
+	template <> struct radix_traits<unsigned long long> : public radix_unsigned_traits<unsigned long long, unsigned long long> { };
+
+	template <> struct radix_traits<signed char> : public radix_signed_traits<signed char, unsigned char> { };
+	template <> struct radix_traits<short> : public radix_signed_traits<short, unsigned short> { };
+	template <> struct radix_traits<int> : public radix_signed_traits<int, unsigned int> { };
+	template <> struct radix_traits<long> : public radix_signed_traits<long, unsigned long> { };
+	template <> struct radix_traits<long long> : public radix_signed_traits<long long, unsigned long long> { };
+
+	// char signedness is implementation defined
+	template <> struct radix_traits<char>
+	: public ft::choose<std::numeric_limits<char>::is_signed,
+						radix_signed_traits<char, unsigned char>,
+						radix_unsigned_traits<char, unsigned char> >::type { };
+
+	template <> struct radix_traits<float> : public radix_float_traits<float, unsigned int> { };
+	template <> struct radix_traits<double> : public radix_float_traits<double, unsigned long long> { };
+
+
+	/*******************************************************
+	 *                     Radix sort                      *
+	 *******************************************************/
+
+	/* Comparison used for small ranges, compares the radix images so that the order
+	   is exactly the one the radix passes give (-0.0 before 0.0, NaNs sorted by bits) */
+	template <class KeyExtractor>
+	struct radix_compare
+	{
+		typedef ft::radix_traits<typename KeyExtractor::result_type> traits;
+
+		KeyExtractor key;
+
+		radix_compare(const KeyExtractor& k) : key(k) { }
+
+		template <class T>
+		bool operator()(const T& lhs, const T& rhs) const
+		{ return (traits::toRadix(this->key(lhs)) < traits::toRadix(this->key(rhs))); }
+	};
+
+	// One counting pass: every element goes at the next free slot of its bucket
+	template <class InputIterator, class OutputIterator, class KeyExtractor>
+	void radix_scatter(InputIterator src, size_t n, OutputIterator dst,
+					   size_t* offsets, unsigned int shift, KeyExtractor key)
+	{
+		typedef ft::radix_traits<typename KeyExtractor::result_type> traits;
+
+		for (size_t i = 0; i < n; ++i, ++src)
+		{
+			const unsigned int digit = (traits::toRadix(key(*src)) >> shift) & 0xff;
+			*(dst + offsets[digit]++) = *src;
+		}
+	}
+
+	/* LSD radix sort, one byte per pass from least to most significant.
+	   KeyExtractor must define result_type (an integral or floating type) and return
+	   the key of an element, eg. ft::select_first for pairs keyed by an integer.
+	   All histograms are computed in a single read of the range, passes where every key
+	   has the same byte are skipped (typically the high bytes of small values).
+	   Needs a buffer as big as the range, falls back to ft::sort on small ranges */
+	template <class RandomAccessIterator, class KeyExtractor>
+	void radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyExtractor key)
+	{
+		typedef typename ft::iterator_traits<RandomAccessIterator>::value_type	value_type;
+		typedef ft::radix_traits<typename KeyExtractor::result_type>			traits;
+		typedef typename traits::radix_type										radix_type;
+
+		const size_t n = last - first;
+		if (n < RADIX_SORT_THRESHOLD)
+		{
+			ft::sort(first, last, ft::radix_compare<KeyExtractor>(key));
+			return;
+		}
+
+		// histograms[byte][digit] = how many keys have this digit at this byte
+		size_t histograms[sizeof(radix_type)][256];
+		std::memset(histograms, 0, sizeof(histograms));
+
+		RandomAccessIterator it = first;
+		for (size_t i = 0; i < n; ++i, ++it)
+		{
+			radix_type bits = traits::toRadix(key(*it));
+			for (size_t byte = 0; byte < sizeof(radix_type); ++byte, bits >>= 8)
+				++histograms[byte][bits & 0xff];
+		}
+
+		ft::vector<value_type> buffer(first, last);
+		bool inBuffer = false; // Which of the range or the buffer holds the last pass result
+
+		for (size_t byte = 0; byte < sizeof(radix_type); ++byte)
+		{
+			size_t* counts = histograms[byte];
+
+			// All keys share this digit, the pass would not move anything
+			if (counts[(traits::toRadix(key(*first)) >> (byte * 8)) & 0xff] == n)
+				continue;
+
+			// Turn the counts into the first slot of each bucket
+			size_t offset = 0;
+			for (unsigned int digit = 0; digit < 256; ++digit)
+			{
+				size_t count = counts[digit];
+				counts[digit] = offset;
+				offset += count;
+			}
+
+			if (inBuffer)
+				ft::radix_scatter(buffer.begin(), n, first, counts, byte * 8, key);
+			else
+				ft::radix_scatter(first, n, buffer.begin(), counts, byte * 8, key);
+			inBuffer = !inBuffer;
+		}
+
+		if (inBuffer)
+		{
+			typename ft::vector<value_type>::iterator src = buffer.begin();
+			for (it = first; it != last; ++it, ++src)
+				*it = *src;
+		}
+	}
+
+	template <class RandomAccessIterator>
+	void radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::radix_sort(first, last, ft::identity<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+}
+
+#endif
@@ -0,0 +1,865 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 07:14 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ROARING_SET_HPP
+# define ROARING_SET_HPP
+
+#include "iterators.hpp"
+#include "vector.hpp"
+
+#include <stdint.h>
+#include <algorithm>
+
+// Values of an array container before it becomes a bitmap (4096 * 2 bytes = the bitmap's size)
+#define ROARING_ARRAY_MAX 4096
+
+// 64 bits words of a bitmap container, one bit per value of its 2^16
+#define ROARING_BITMAP_WORDS 1024
+
+namespace ft
+{
+	/*******************************************************
+	 *                      Containers                     *
+	 *******************************************************/
+
+	/* The 2^16 values sharing the high 16 bits of a roaring_set, their low 16 bits stored as:
+	   - ARRAY: sorted in values, while there are at most ROARING_ARRAY_MAX
+	   - BITMAP: one bit per value in words, past that
+	   - RUN: sorted (start, length - 1) pairs in values, when that is smaller than both (only
+	     after roaring_set::run_optimize(), and while it stays smaller) */
+	struct roaring_container
+	{
+		enum kind { ARRAY, BITMAP, RUN };
+
+		kind					type;
+		uint32_t				cardinality;
+		ft::vector<uint16_t>	values;
+		ft::vector<uint64_t>	words;
+
+		roaring_container() : type(ARRAY), cardinality(0) { }
+
+		size_t runCount() const { return (this->values.size() / 2); }
+		uint32_t runStart(size_t run) const { return (this->values[2 * run]); }
+		uint32_t runEnd(size_t run) const { return ((uint32_t)this->values[2 * run] + this->values[2 * run + 1]); }
+
+		// Index of the first of values[first, first + n) greater than value (upper bound)
+		static size_t upperBound(const uint16_t* values, size_t n, uint32_t value, size_t stride)
+		{
+			size_t low = 0;
+
+			while (n > 0)
+			{
+				size_t half = n / 2;
+				if (values[(low + half) * stride] <= value)
+				{
+					low += half + 1;
+					n -= half + 1;
+				}
+				else
+					n = half;
+			}
+			return (low);
+		}
+
+		size_t arrayLowerBound(uint32_t low) const
+		{
+			size_t i = (this->values.empty()) ? 0 : upperBound(&this->values[0], this->values.size(), low, 1);
+			return ((i > 0 && this->values[i - 1] == low) ? i - 1 : i);
+		}
+
+		// Run whose start is the last not greater than low, runCount() if none
+		size_t findRun(uint32_t low) const
+		{
+			size_t i = (this->values.empty()) ? 0 : upperBound(&this->values[0], this->runCount(), low, 2);
+			return ((i == 0) ? this->runCount() : i - 1);
+		}
+
+		bool testBit(uint32_t low) const { return ((this->words[low >> 6] >> (low & 63)) & 1); }
+
+		bool contains(uint32_t low) const
+		{
+			if (this->type == BITMAP)
+				return (this->testBit(low));
+			if (this->type == ARRAY)
+			{
+				size_t i = this->arrayLowerBound(low);
+				return (i < this->values.size() && this->values[i] == low);
+			}
+			size_t run = this->findRun(low);
+			return (run < this->runCount() && low <= this->runEnd(run));
+		}
+
+		// Bytes each encoding would take
+		static size_t arrayBytes(uint32_t cardinality) { return (2 * cardinality); }
+		static size_t bitmapBytes() { return (ROARING_BITMAP_WORDS * sizeof(uint64_t)); }
+		static size_t runBytes(size_t runs) { return (4 * runs); }
+
+		size_t countRuns() const
+		{
+			size_t runs = 0;
+
+			if (this->type == RUN)
+				return (this->runCount());
+			if (this->type == ARRAY)
+			{
+				for (size_t i = 0; i < this->values.size(); ++i)
+					runs += (i == 0 || this->values[i] != this->values[i - 1] + 1);
+				return (runs);
+			}
+			// A run starts at each set bit whose previous bit is clear
+			uint64_t carry = 0;
+			for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+			{
+				const uint64_t word = this->words[i];
+				runs += __builtin_popcountll(word & ~((word << 1) | carry));
+				carry = word >> 63;
+			}
+			return (runs);
+		}
+
+		// Calls fn(low) for each value, in order
+		template <class Function>
+		void forEach(Function& fn) const
+		{
+			if (this->type == ARRAY)
+				for (size_t i = 0; i < this->values.size(); ++i)
+					fn(this->values[i]);
+			else if (this->type == RUN)
+			{
+				for (size_t run = 0; run < this->runCount(); ++run)
+					for (uint32_t low = this->runStart(run); low <= this->runEnd(run); ++low)
+						fn(low);
+			}
+			else
+				for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+					for (uint64_t word = this->words[i]; word != 0; word &= word - 1)
+						fn((uint32_t)(i * 64 + __builtin_ctzll(word)));
+		}
+
+		struct arrayAppender
+		{
+			ft::vector<uint16_t>* values;
+			void operator()(uint32_t low) { this->values->push_back(low); }
+		};
+
+		struct bitSetter
+		{
+			uint64_t* words;
+			void operator()(uint32_t low) { this->words[low >> 6] |= (uint64_t)1 << (low & 63); }
+		};
+
+		/********** Conversions **********/
+
+		void toBitmap()
+		{
+			ft::vector<uint64_t> words(ROARING_BITMAP_WORDS, 0);
+			bitSetter setter;
+
+			if (this->type == BITMAP)
+				return ;
+			setter.words = &words[0];
+			this->forEach(setter);
+			this->words.swap(words);
+			ft::vector<uint16_t>().swap(this->values);
+			this->type = BITMAP;
+		}
+
+		void toArray()
+		{
+			ft::vector<uint16_t> values;
+			arrayAppender appender;
+
+			if (this->type == ARRAY)
+				return ;
+			values.reserve(this->cardinality);
+			appender.values = &values;
+			this->forEach(appender);
+			this->values.swap(values);
+			ft::vector<uint64_t>().swap(this->words);
+			this->type = ARRAY;
+		}
+
+		void toRun()
+		{
+			ft::vector<uint16_t> runs;
+			arrayAppender appender;
+
+			if (this->type == RUN)
+				return ;
+			ft::vector<uint16_t> values;
+			appender.values = &values;
+			this->forEach(appender);
+			runs.reserve(2 * this->countRuns());
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				if (i == 0 || values[i] != values[i - 1] + 1)
+				{
+					runs.push_back(values[i]);
+					runs.push_back(0);
+				}
+				else
+					++runs.back();
+			}
+			this->values.swap(runs);
+			ft::vector<uint64_t>().swap(this->words);
+			this->type = RUN;
+		}
+
+		// Array or bitmap, whichever the cardinality calls for
+		void normalize()
+		{
+			if (this->cardinality > ROARING_ARRAY_MAX)
+				this->toBitmap();
+			else
+				this->toArray();
+		}
+
+		// After a change to a run container, leaves runs if they aren't the smallest anymore
+		void checkRuns()
+		{
+			if (this->runBytes(this->runCount()) >= std::min(arrayBytes(this->cardinality), bitmapBytes()))
+				this->normalize();
+		}
+
+		/********** Changes, true if the container changed **********/
+
+		bool insert(uint32_t low)
+		{
+			if (this->type == RUN)
+				return (this->insertRun(low));
+			if (this->type == BITMAP)
+			{
+				uint64_t& word = this->words[low >> 6];
+				const uint64_t bit = (uint64_t)1 << (low & 63);
+				if (word & bit)
+					return (false);
+				word |= bit;
+			}
+			else
+			{
+				size_t i = this->arrayLowerBound(low);
+				if (i < this->values.size() && this->values[i] == low)
+					return (false);
+				this->values.insert(this->values.begin() + i, (uint16_t)low);
+			}
+			if (++this->cardinality > ROARING_ARRAY_MAX)
+				this->toBitmap();
+			return (true);
+		}
+
+		bool insertRun(uint32_t low)
+		{
+			const size_t runs = this->runCount();
+			size_t next = (runs == 0) ? 0 : upperBound(&this->values[0], runs, low, 2);
+			const bool hasPrevious = (next > 0);
+
+			if (hasPrevious && low <= this->runEnd(next - 1))
+				return (false);
+			const bool joinsPrevious = hasPrevious && low == this->runEnd(next - 1) + 1;
+			const bool joinsNext = next < runs && low + 1 == this->runStart(next);
+			if (joinsPrevious && joinsNext)
+			{
+				this->values[2 * (next - 1) + 1] = this->runEnd(next) - this->runStart(next - 1);
+				this->values.erase(this->values.begin() + 2 * next, this->values.begin() + 2 * next + 2);
+			}
+			else if (joinsPrevious)
+				++this->values[2 * (next - 1) + 1];
+			else if (joinsNext)
+			{
+				this->values[2 * next] = low;
+				++this->values[2 * next + 1];
+			}
+			else
+			{
+				uint16_t run[2] = { (uint16_t)low, 0 };
+				this->values.insert(this->values.begin() + 2 * next, run, run + 2);
+			}
+			++this->cardinality;
+			this->checkRuns();
+			return (true);
+		}
+
+		bool erase(uint32_t low)
+		{
+			if (this->type == BITMAP)
+			{
+				uint64_t& word = this->words[low >> 6];
+				const uint64_t bit = (uint64_t)1 << (low & 63);
+				if (!(word & bit))
+					return (false);
+				word &= ~bit;
+				if (--this->cardinality <= ROARING_ARRAY_MAX)
+					this->toArray();
+				return (true);
+			}
+			if (this->type == ARRAY)
+			{
+				size_t i = this->arrayLowerBound(low);
+				if (i == this->values.size() || this->values[i] != low)
+					return (false);
+				this->values.erase(this->values.begin() + i);
+				--this->cardinality;
+				return (true);
+			}
+			size_t run = this->findRun(low);
+			if (run == this->runCount() || low > this->runEnd(run))
+				return (false);
+			const uint32_t start = this->runStart(run), end = this->runEnd(run);
+			if (start == end)
+				this->values.erase(this->values.begin() + 2 * run, this->values.begin() + 2 * run + 2);
+			else if (low == start)
+			{
+				++this->values[2 * run];
+				--this->values[2 * run + 1];
+			}
+			else if (low == end)
+				--this->values[2 * run + 1];
+			else
+			{
+				// Split in [start, low - 1] and [low + 1, end]
+				uint16_t after[2] = { (uint16_t)(low + 1), (uint16_t)(end - low - 1) };
+				this->values[2 * run + 1] = low - 1 - start;
+				this->values.insert(this->values.begin() + 2 * run + 2, after, after + 2);
+			}
+			--this->cardinality;
+			this->checkRuns();
+			return (true);
+		}
+
+		/********** Iteration **********/
+
+		// Smallest value not less than low, false if none. position is the array / run index
+		// (hint in, value out), unused for bitmaps
+		bool next(uint32_t low, size_t& position, uint32_t& found) const
+		{
+			if (this->type == ARRAY)
+			{
+				// Iterating, the hint is the previous value's index
+				if (position < this->values.size() && this->values[position] < low)
+					++position;
+				if (position > this->values.size() || (position < this->values.size() && this->values[position] < low)
+					|| (position > 0 && this->values[position - 1] >= low))
+					position = this->arrayLowerBound(low);
+				if (position == this->values.size())
+					return (false);
+				found = this->values[position];
+				return (true);
+			}
+			if (this->type == RUN)
+			{
+				if (position >= this->runCount() || low < this->runStart(position) || low > this->runEnd(position) + 1)
+				{
+					position = this->findRun(low);
+					if (position == this->runCount())
+						position = 0;
+				}
+				if (low > this->runEnd(position))
+					++position;
+				if (position == this->runCount())
+					return (false);
+				found = std::max(low, this->runStart(position));
+				return (true);
+			}
+			if (low >= ROARING_BITMAP_WORDS * 64)
+				return (false);
+			size_t i = low >> 6;
+			uint64_t word = this->words[i] & (~(uint64_t)0 << (low & 63));
+			while (word == 0)
+			{
+				if (++i == ROARING_BITMAP_WORDS)
+					return (false);
+				word = this->words[i];
+			}
+			found = i * 64 + __builtin_ctzll(word);
+			return (true);
+		}
+
+		size_t memoryUsage() const
+		{
+			return (sizeof(*this) + this->values.capacity() * sizeof(uint16_t) + this->words.capacity() * sizeof(uint64_t));
+		}
+	};
+
+	/*******************************************************
+	 *               Container set operations              *
+	 *******************************************************/
+
+	enum roaring_operation { ROARING_AND, ROARING_OR, ROARING_ANDNOT };
+
+	// Word loops on two bitmaps, cardinality from popcount
+	inline void roaring_bitmap_op(const roaring_container& a, const roaring_container& b, roaring_operation op,
+								  roaring_container& out)
+	{
+		const uint64_t* wa = &a.words[0];
+		const uint64_t* wb = &b.words[0];
+		uint32_t cardinality = 0;
+
+		out.type = roaring_container::BITMAP;
+		out.words.resize(ROARING_BITMAP_WORDS);
+		uint64_t* wo = &out.words[0];
+		if (op == ROARING_AND)
+			for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+				wo[i] = wa[i] & wb[i];
+		else if (op == ROARING_OR)
+			for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+				wo[i] = wa[i] | wb[i];
+		else
+			for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+				wo[i] = wa[i] & ~wb[i];
+		for (size_t i = 0; i < ROARING_BITMAP_WORDS; ++i)
+			cardinality += __builtin_popcountll(wo[i]);
+		out.cardinality = cardinality;
+		if (cardinality <= ROARING_ARRAY_MAX)
+			out.toArray();
+	}
+
+	// Merges two sorted arrays
+	inline void roaring_array_op(const roaring_container& a, const roaring_container& b, roaring_operation op,
+								 roaring_container& out)
+	{
+		const ft::vector<uint16_t>& va = a.values;
+		const ft::vector<uint16_t>& vb = b.values;
+		size_t i = 0, j = 0;
+
+		out.type = roaring_container::ARRAY;
+		out.values.reserve((op == ROARING_OR) ? va.size() + vb.size() : va.size());
+		while (i < va.size() && j < vb.size())
+		{
+			if (va[i] < vb[j])
+			{
+				if (op != ROARING_AND)
+					out.values.push_back(va[i]);
+				++i;
+			}
+			else if (vb[j] < va[i])
+			{
+				if (op == ROARING_OR)
+					out.values.push_back(vb[j]);
+				++j;
+			}
+			else
+			{
+				if (op != ROARING_ANDNOT)
+					out.values.push_back(va[i]);
+				++i;
+				++j;
+			}
+		}
+		if (op != ROARING_AND)
+			out.values.insert(out.values.end(), va.begin() + i, va.end());
+		if (op == ROARING_OR)
+			out.values.insert(out.values.end(), vb.begin() + j, vb.end());
+		out.cardinality = out.values.size();
+		if (out.cardinality > ROARING_ARRAY_MAX)
+			out.toBitmap();
+	}
+
+	// An array and a bitmap, in that order (a is the array) or the other (a is the bitmap)
+	inline void roaring_mixed_op(const roaring_container& a, const roaring_container& b, roaring_operation op,
+								 roaring_container& out)
+	{
+		const roaring_container& array = (a.type == roaring_container::ARRAY) ? a : b;
+		const roaring_container& bitmap = (a.type == roaring_container::ARRAY) ? b : a;
+
+		if (op == ROARING_AND || (op == ROARING_ANDNOT && &array == &a))
+		{
+			// Values of the array kept or dropped by testing the bitmap, an array either way
+			const bool keep = (op == ROARING_AND);
+			out.type = roaring_container::ARRAY;
+			out.values.reserve(array.values.size());
+			for (size_t i = 0; i < array.values.size(); ++i)
+				if (bitmap.testBit(array.values[i]) == keep)
+					out.values.push_back(array.values[i]);
+			out.cardinality = out.values.size();
+			return ;
+		}
+		// OR, or bitmap minus array: the bitmap with the array's bits set / cleared
+		out.type = roaring_container::BITMAP;
+		out.words = bitmap.words;
+		out.cardinality = bitmap.cardinality;
+		for (size_t i = 0; i < array.values.size(); ++i)
+		{
+			const uint32_t low = array.values[i];
+			uint64_t& word = out.words[low >> 6];
+			const uint64_t bit = (uint64_t)1 << (low & 63);
+			if (op == ROARING_OR)
+			{
+				out.cardinality += !(word & bit);
+				word |= bit;
+			}
+			else
+			{
+				out.cardinality -= !!(word & bit);
+				word &= ~bit;
+			}
+		}
+		if (out.cardinality <= ROARING_ARRAY_MAX)
+			out.toArray();
+	}
+
+	// Any two containers, runs are first turned into arrays / bitmaps. out.cardinality may be 0
+	inline void roaring_container_op(const roaring_container& a, const roaring_container& b, roaring_operation op,
+									 roaring_container& out)
+	{
+		if (a.type == roaring_container::RUN || b.type == roaring_container::RUN)
+		{
+			roaring_container ca(a), cb(b);
+			if (ca.type == roaring_container::RUN)
+				ca.normalize();
+			if (cb.type == roaring_container::RUN)
+				cb.normalize();
+			roaring_container_op(ca, cb, op, out);
+		}
+		else if (a.type == roaring_container::BITMAP && b.type == roaring_container::BITMAP)
+			roaring_bitmap_op(a, b, op, out);
+		else if (a.type == roaring_container::ARRAY && b.type == roaring_container::ARRAY)
+			roaring_array_op(a, b, op, out);
+		else
+			roaring_mixed_op(a, b, op, out);
+	}
+
+	/*******************************************************
+	 *                      roaring_set                    *
+	 *******************************************************/
+
+	/*
+		Set of uint32_t as a compressed bitmap (Roaring): values are grouped by their high 16
+		bits, each group being a container of their low 16 bits (array, bitmap or runs, see
+		roaring_container) in a sorted vector of keys. Dense clusters take down to a bit per
+		value (a run for consecutive ones), sparse values 2 bytes and the key's share, against
+		a node per value for ft::set. and / or / andnot work a container at a time, with word
+		loops and popcount between bitmaps.
+		Iterators are forward and const, and stay valid until the set changes
+	*/
+	class roaring_set
+	{
+		public:
+			typedef uint32_t	value_type;
+			typedef uint32_t	key_type;
+			typedef size_t		size_type;
+
+			class const_iterator
+			{
+				public:
+					typedef ft::forward_iterator_tag	iterator_category;
+					typedef const uint32_t				value_type;
+					typedef ptrdiff_t					difference_type;
+					typedef value_type*					pointer;
+					typedef value_type&					reference;
+
+				private:
+					const roaring_set*	_set;
+					size_t				_container;
+					size_t				_position; // In the container, see roaring_container::next
+					uint32_t			_value;
+
+					friend class roaring_set;
+
+					// First value not less than (_container's key, low), from _container on
+					void seek(uint32_t low)
+					{
+						uint32_t found;
+
+						for (; this->_container < this->_set->_keys.size(); ++this->_container, low = 0, this->_position = 0)
+							if (this->_set->_containers[this->_container]->next(low, this->_position, found))
+							{
+								this->_value = ((uint32_t)this->_set->_keys[this->_container] << 16) | found;
+								return ;
+							}
+						this->_value = 0;
+					}
+
+				public:
+					const_iterator() : _set(NULL), _container(0), _position(0), _value(0) { }
+					const_iterator(const roaring_set* set, size_t container, uint32_t low)
+						: _set(set), _container(container), _position(0), _value(0) { this->seek(low); }
+
+					reference operator*() const { return (this->_value); }
+					pointer operator->() const { return (&this->_value); }
+
+					const_iterator& operator++()
+					{
+						const uint32_t low = this->_value & 0xffff;
+
+						if (low == 0xffff)
+						{
+							++this->_container;
+							this->_position = 0;
+							this->seek(0);
+						}
+						else
+							this->seek(low + 1);
+						return (*this);
+					}
+
+					const_iterator operator++(int) { const_iterator tmp(*this); ++(*this); return (tmp); }
+
+					bool operator==(const const_iterator& rhs) const { return (this->_container == rhs._container && this->_value == rhs._value); }
+					bool operator!=(const const_iterator& rhs) const { return (!(*this == rhs)); }
+			};
+
+			typedef const_iterator	iterator;
+
+		private:
+			ft::vector<uint16_t>			_keys; // High 16 bits of the values of each container, sorted
+			ft::vector<roaring_container*>	_containers;
+			size_type						_size;
+
+			friend class const_iterator;
+
+			static uint16_t high(uint32_t value) { return (value >> 16); }
+			static uint32_t low(uint32_t value) { return (value & 0xffff); }
+
+			// Index of the first key not less than key
+			size_t findKey(uint16_t key) const
+			{
+				size_t low = 0, n = this->_keys.size();
+
+				while (n > 0)
+				{
+					size_t half = n / 2;
+					if (this->_keys[low + half] < key)
+					{
+						low += half + 1;
+						n -= half + 1;
+					}
+					else
+						n = half;
+				}
+				return (low);
+			}
+
+			void copyFrom(const roaring_set& other)
+			{
+				this->_keys = other._keys;
+				this->_containers.reserve(other._containers.size());
+				for (size_t i = 0; i < other._containers.size(); ++i)
+					this->_containers.push_back(new roaring_container(*other._containers[i]));
+				this->_size = other._size;
+			}
+
+			// Takes out (a container for a key after the last one) if not empty, room must be reserved
+			void append(uint16_t key, roaring_container* out)
+			{
+				if (out->cardinality == 0)
+				{
+					delete out;
+					return ;
+				}
+				this->_containers.push_back(out);
+				this->_keys.push_back(key);
+				this->_size += out->cardinality;
+			}
+
+			// Result of a container op, then the set's
+			static roaring_container* operate(const roaring_container& a, const roaring_container& b, roaring_operation op)
+			{
+				roaring_container* out = new roaring_container();
+
+				try
+				{
+					ft::roaring_container_op(a, b, op, *out);
+				}
+				catch (...)
+				{
+					delete out;
+					throw;
+				}
+				return (out);
+			}
+
+			static roaring_set operate(const roaring_set& a, const roaring_set& b, roaring_operation op)
+			{
+				roaring_set result;
+				size_t i = 0, j = 0;
+
+				result._keys.reserve(a._keys.size() + b._keys.size());
+				result._containers.reserve(a._keys.size() + b._keys.size());
+				while (i < a._keys.size() || j < b._keys.size())
+				{
+					if (j == b._keys.size() || (i < a._keys.size() && a._keys[i] < b._keys[j]))
+					{
+						// Only in a
+						if (op != ROARING_AND)
+							result.append(a._keys[i], new roaring_container(*a._containers[i]));
+						++i;
+					}
+					else if (i == a._keys.size() || b._keys[j] < a._keys[i])
+					{
+						if (op == ROARING_OR)
+							result.append(b._keys[j], new roaring_container(*b._containers[j]));
+						++j;
+					}
+					else
+					{
+						result.append(a._keys[i], operate(*a._containers[i], *b._containers[j], op));
+						++i;
+						++j;
+					}
+				}
+				return (result);
+			}
+
+		public:
+			roaring_set() : _size(0) { }
+
+			template <class InputIterator>
+			roaring_set(InputIterator first, InputIterator last) : _size(0)
+			{
+				for (; first != last; ++first)
+					this->insert(*first);
+			}
+
+			roaring_set(const roaring_set& other) : _size(0) { this->copyFrom(other); }
+
+			roaring_set& operator=(const roaring_set& other)
+			{
+				if (this != &other)
+				{
+					roaring_set copy(other);
+					this->swap(copy);
+				}
+				return (*this);
+			}
+
+			~roaring_set() { this->clear(); }
+
+			const_iterator begin() const { return (const_iterator(this, 0, 0)); }
+			const_iterator end() const { return (const_iterator(this, this->_keys.size(), 0)); }
+
+			size_type size() const { return (this->_size); }
+			bool empty() const { return (this->_size == 0); }
+
+			bool contains(uint32_t value) const
+			{
+				const size_t i = this->findKey(high(value));
+
+				return (i < this->_keys.size() && this->_keys[i] == high(value) && this->_containers[i]->contains(low(value)));
+			}
+
+			size_type count(uint32_t value) const { return (this->contains(value)); }
+
+			// True if value wasn't in the set
+			bool insert(uint32_t value)
+			{
+				const size_t i = this->findKey(high(value));
+
+				if (i == this->_keys.size() || this->_keys[i] != high(value))
+				{
+					roaring_container* container = new roaring_container();
+					try
+					{
+						container->insert(low(value));
+						this->_containers.insert(this->_containers.begin() + i, container);
+					}
+					catch (...)
+					{
+						delete container;
+						throw;
+					}
+					this->_keys.insert(this->_keys.begin() + i, high(value));
+					++this->_size;
+					return (true);
+				}
+				if (!this->_containers[i]->insert(low(value)))
+					return (false);
+				++this->_size;
+				return (true);
+			}
+
+			// Number of values erased (0 or 1)
+			size_type erase(uint32_t value)
+			{
+				const size_t i = this->findKey(high(value));
+
+				if (i == this->_keys.size() || this->_keys[i] != high(value) || !this->_containers[i]->erase(low(value)))
+					return (0);
+				--this->_size;
+				if (this->_containers[i]->cardinality == 0)
+				{
+					delete this->_containers[i];
+					this->_containers.erase(this->_containers.begin() + i);
+					this->_keys.erase(this->_keys.begin() + i);
+				}
+				return (1);
+			}
+
+			// First value not less than value
+			const_iterator lower_bound(uint32_t value) const
+			{
+				const size_t i = this->findKey(high(value));
+
+				if (i < this->_keys.size() && this->_keys[i] == high(value))
+					return (const_iterator(this, i, low(value)));
+				return (const_iterator(this, i, 0));
+			}
+
+			/* Turns each container into runs where they take less memory, run containers go back to
+			   arrays / bitmaps when changes make them bigger */
+			void run_optimize()
+			{
+				for (size_t i = 0; i < this->_containers.size(); ++i)
+				{
+					roaring_container& container = *this->_containers[i];
+					const size_t runs = container.countRuns();
+					if (roaring_container::runBytes(runs) < std::min(roaring_container::arrayBytes(container.cardinality),
+																	  roaring_container::bitmapBytes()))
+						container.toRun();
+					else
+						container.normalize();
+				}
+			}
+
+			void clear()
+			{
+				for (size_t i = 0; i < this->_containers.size(); ++i)
+					delete this->_containers[i];
+				this->_containers.clear();
+				this->_keys.clear();
+				this->_size = 0;
+			}
+
+			void swap(roaring_set& other)
+			{
+				this->_keys.swap(other._keys);
+				this->_containers.swap(other._containers);
+				size_type tmp = this->_size;
+				this->_size = other._size;
+				other._size = tmp;
+			}
+
+			// Bytes allocated for the keys and containers
+			size_t memory_usage() const
+			{
+				size_t bytes = sizeof(*this) + this->_keys.capacity() * sizeof(uint16_t)
+							   + this->_containers.capacity() * sizeof(roaring_container*);
+
+				for (size_t i = 0; i < this->_containers.size(); ++i)
+					bytes += this->_containers[i]->memoryUsage();
+				return (bytes);
+			}
+
+			friend roaring_set operator&(const roaring_set& a, const roaring_set& b) { return (operate(a, b, ROARING_AND)); }
+			friend roaring_set operator|(const roaring_set& a, const roaring_set& b) { return (operate(a, b, ROARING_OR)); }
+			// Values of a not in b
+			friend roaring_set andnot(const roaring_set& a, const roaring_set& b) { return (operate(a, b, ROARING_ANDNOT)); }
+
+			friend bool operator==(const roaring_set& a, const roaring_set& b)
+			{
+				return (a._size == b._size && a._keys == b._keys && andnot(a, b).empty());
+			}
+	};
+
+	inline void swap(roaring_set& x, roaring_set& y) { x.swap(y); }
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
 /*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
 /*   Created: 16-03-2022  by  `-'                        `-'                  */
-/*   Updated: 18-03-2022 11:32 by                                             */
+/*   Updated: 18-10-2026 05:48 by                                             */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -45,6 +45,10 @@ namespace ft
 		private:
 			typedef RedBlackTree<value_type, value_compare, allocator_type> tree_type;
 
+			// Walks the tree for the parallel algorithms (parallel_tree.hpp)
+			template <class Container>
+			friend struct tree_access;
+
 		public:
 			// Since in a set all values are const, simply use the const_iterator as iterator, smort
 			typedef typename tree_type::const_iterator	iterator;
@@ -81,14 +85,14 @@ namespace ft
 			// Default constructor / empty
 			explicit set(const key_compare& comp = key_compare(),
 			             const allocator_type& alloc = allocator_type())
-						 : _comp(comp), _alloc(alloc), _tree() { }
+						 : _comp(comp), _alloc(alloc), _tree(comp, alloc) { }
 
 			// Range constructor
 			template <class InputIterator>
 			set(InputIterator first, InputIterator last,
 			     const key_compare& comp = key_compare(),
 				 const allocator_type& alloc = allocator_type())
-				 : _comp(comp), _alloc(alloc), _tree()
+				 : _comp(comp), _alloc(alloc), _tree(comp, alloc)
 			{
 				while (first != last)
 				{
@@ -100,11 +104,10 @@ namespace ft
 			// Copy constructor, deep copy tree
 			set(const set& x) : _comp(x._comp), _alloc(x._alloc), _tree(x._tree) { }
 
-			// Assignation operator
+			// Assignation operator, the allocator stays ours (see RedBlackTree::operator=)
 			set& operator=(const set& x)
 			{
 				this->_comp = x._comp;
-				this->_alloc = x._alloc;
 				this->_tree = x._tree;
 				
 				return (*this);
@@ -174,12 +177,11 @@ namespace ft
 			// Since iterator being erased is invalidated on remove, first save next node
 			void erase(iterator first, iterator last)
 			{
-				iterator tmp;
 				while (first != last)
 				{
-					tmp = first;
-					++first;
-					this->_tree.remove(*tmp);
+					iterator next = ft::next(first);
+					this->_tree.remove(*first);
+					first = next;
 				}
 			}
 
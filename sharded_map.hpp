@@ -0,0 +1,379 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:46 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SHARDED_MAP_HPP
+# define SHARDED_MAP_HPP
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <pthread.h>
+
+#include "enable_if.hpp"
+#include "is_integral.hpp"
+#include "map.hpp"
+#include "thread_pool.hpp"
+#include "vector.hpp"
+
+/* Default number of shards (rounded up to a power of 2 when given) */
+#define SHARDED_MAP_SHARDS 64
+
+namespace ft
+{
+	/*******************************************************
+	 *                      shard_hash                     *
+	 *******************************************************/
+
+	/* Picks the shard of a key. Only integral types and std::string have one, other keys need
+	   their own (any function object returning a size_t, the low bits are used) */
+	template <class Key, class Enable = void>
+	struct shard_hash { };
+
+	// Consecutive keys end up in different shards: multiplied by 2^64 / golden ratio, high bits folded down
+	template <class Key>
+	struct shard_hash<Key, typename ft::enable_if<ft::is_integral<Key>::value>::type>
+	{
+		size_t operator()(Key key) const
+		{
+			const unsigned long long mixed = static_cast<unsigned long long>(key) * 0x9E3779B97F4A7C15ULL;
+			return (static_cast<size_t>(mixed ^ (mixed >> 32)));
+		}
+	};
+
+	// FNV-1a
+	template <>
+	struct shard_hash<std::string>
+	{
+		size_t operator()(const std::string& key) const
+		{
+			unsigned long long hash = 14695981039346656037ULL;
+
+			for (size_t i = 0; i < key.size(); ++i)
+				hash = (hash ^ static_cast<unsigned char>(key[i])) * 1099511628211ULL;
+			return (static_cast<size_t>(hash ^ (hash >> 32)));
+		}
+	};
+
+	/*******************************************************
+	 *                      sharded_map                    *
+	 *******************************************************/
+
+	/*
+		Map shared by many threads: keys are spread by hash over independent ft::map shards,
+		each behind its own reader / writer lock, on its own cache lines. A point operation
+		locks a single shard, so a write only stalls the readers of that shard.
+
+		Elements can't be handed out by reference (the lock is released on return): lookups
+		copy the value out, update() runs a function on it under the lock.
+		Ordered traversal (for_each, for_each_in) read locks every shard, in order so that two
+		of them can't deadlock, and merges the shards (each already sorted) with a heap.
+	*/
+	template <class Key,
+			  class T,
+			  class Compare = std::less<Key>,
+			  class Hash = ft::shard_hash<Key>,
+			  class Alloc = std::allocator<ft::pair<const Key, T> >
+			 >
+	class sharded_map
+	{
+		public:
+			typedef Key										key_type;
+			typedef T										mapped_type;
+			typedef ft::pair<const key_type, mapped_type>	value_type;
+			typedef Compare									key_compare;
+			typedef Hash									hasher;
+			typedef Alloc									allocator_type;
+			typedef ft::map<Key, T, Compare, Alloc>			map_type;
+			typedef size_t									size_type;
+
+		private:
+			struct shard
+			{
+				pthread_rwlock_t	lock;
+				map_type			map;
+				char				pad[FT_CACHE_LINE_SIZE]; // The next shard's lock is on another line
+			};
+
+			typedef typename map_type::const_iterator	const_iterator;
+
+			// Position of a shard in the merge, the heap keeps the smallest key on top
+			struct cursor
+			{
+				const_iterator	it;
+				const_iterator	end;
+			};
+
+			struct cursor_after
+			{
+				key_compare comp;
+
+				explicit cursor_after(const key_compare& c) : comp(c) { }
+				bool operator()(const cursor& lhs, const cursor& rhs) const { return (this->comp(rhs.it->first, lhs.it->first)); }
+			};
+
+			shard*			_shards;
+			size_t			_mask;
+			key_compare		_comp;
+			hasher			_hash;
+
+			// Not copyable, threads may be using it
+			sharded_map(const sharded_map&);
+			sharded_map& operator=(const sharded_map&);
+
+			static size_t roundShards(size_t shards)
+			{
+				size_t rounded = 1;
+
+				while (rounded < shards)
+					rounded <<= 1;
+				return (rounded);
+			}
+
+			shard& shardOf(const key_type& k) const { return (this->_shards[this->_hash(k) & this->_mask]); }
+
+			/* Scoped locks: released by their destructor, so a throwing map (bad_alloc, a key or
+			   value copy) or fn doesn't leave a shard locked for good */
+			class read_lock
+			{
+				private:
+					pthread_rwlock_t&	_lock;
+
+					read_lock(const read_lock&);
+					read_lock& operator=(const read_lock&);
+
+				public:
+					explicit read_lock(pthread_rwlock_t& lock) : _lock(lock) { pthread_rwlock_rdlock(&this->_lock); }
+					~read_lock() { pthread_rwlock_unlock(&this->_lock); }
+			};
+
+			class write_lock
+			{
+				private:
+					pthread_rwlock_t&	_lock;
+
+					write_lock(const write_lock&);
+					write_lock& operator=(const write_lock&);
+
+				public:
+					explicit write_lock(pthread_rwlock_t& lock) : _lock(lock) { pthread_rwlock_wrlock(&this->_lock); }
+					~write_lock() { pthread_rwlock_unlock(&this->_lock); }
+			};
+
+			// Every shard read locked, in order
+			class read_lock_all
+			{
+				private:
+					shard*	_shards;
+					size_t	_count;
+
+					read_lock_all(const read_lock_all&);
+					read_lock_all& operator=(const read_lock_all&);
+
+				public:
+					read_lock_all(shard* shards, size_t count) : _shards(shards), _count(count)
+					{
+						for (size_t i = 0; i < this->_count; ++i)
+							pthread_rwlock_rdlock(&this->_shards[i].lock);
+					}
+
+					~read_lock_all()
+					{
+						for (size_t i = 0; i < this->_count; ++i)
+							pthread_rwlock_unlock(&this->_shards[i].lock);
+					}
+			};
+
+			// K-way merge of the shard ranges in the heap, stops at the first key not before last (if bounded)
+			template <class Function>
+			void merge(ft::vector<cursor>& heap, const key_type* last, Function& fn) const
+			{
+				if (heap.empty())
+					return;
+
+				cursor* first = &heap[0];
+				cursor* end = first + heap.size();
+				const cursor_after after(this->_comp);
+
+				std::make_heap(first, end, after);
+				while (first != end)
+				{
+					std::pop_heap(first, end, after);
+					cursor& top = *(end - 1);
+					if (last != NULL && !this->_comp(top.it->first, *last))
+						break;
+					fn(*top.it);
+					if (++top.it == top.end)
+						--end;
+					else
+						std::push_heap(first, end, after);
+				}
+			}
+
+		public:
+			explicit sharded_map(size_type shards = SHARDED_MAP_SHARDS,
+								 const key_compare& comp = key_compare(),
+								 const hasher& hash = hasher())
+			: _shards(NULL), _mask(roundShards(shards) - 1), _comp(comp), _hash(hash)
+			{
+				this->_shards = new shard[this->_mask + 1];
+				for (size_t i = 0; i <= this->_mask; ++i)
+					pthread_rwlock_init(&this->_shards[i].lock, NULL);
+			}
+
+			~sharded_map()
+			{
+				for (size_t i = 0; i <= this->_mask; ++i)
+					pthread_rwlock_destroy(&this->_shards[i].lock);
+				delete[] this->_shards;
+			}
+
+			size_type shard_count() const { return (this->_mask + 1); }
+
+			// Sum of the shard sizes, each read at a different time: only a hint while others write
+			size_type size() const
+			{
+				size_type total = 0;
+
+				for (size_t i = 0; i <= this->_mask; ++i)
+				{
+					read_lock lock(this->_shards[i].lock);
+					total += this->_shards[i].map.size();
+				}
+				return (total);
+			}
+
+			bool empty() const { return (this->size() == 0); }
+
+			void clear()
+			{
+				for (size_t i = 0; i <= this->_mask; ++i)
+				{
+					write_lock lock(this->_shards[i].lock);
+					this->_shards[i].map.clear();
+				}
+			}
+
+			/***************** Point operations, one shard locked *****************/
+
+			// False if the key was already there (its value is left as it was)
+			bool insert(const value_type& val)
+			{
+				shard& s = this->shardOf(val.first);
+
+				write_lock lock(s.lock);
+				return (s.map.insert(val).second);
+			}
+
+			// True if the key is new, false if its value was replaced
+			bool insert_or_assign(const key_type& k, const mapped_type& obj)
+			{
+				shard& s = this->shardOf(k);
+
+				write_lock lock(s.lock);
+				ft::pair<typename map_type::iterator, bool> res = s.map.insert(value_type(k, obj));
+				if (!res.second)
+					res.first->second = obj;
+				return (res.second);
+			}
+
+			size_type erase(const key_type& k)
+			{
+				shard& s = this->shardOf(k);
+
+				write_lock lock(s.lock);
+				return (s.map.erase(k));
+			}
+
+			// Copies the value of k into obj, false if k isn't there
+			bool find(const key_type& k, mapped_type& obj) const
+			{
+				shard& s = this->shardOf(k);
+
+				read_lock lock(s.lock);
+				const const_iterator it = s.map.find(k);
+				const bool found = (it != s.map.end());
+				if (found)
+					obj = it->second;
+				return (found);
+			}
+
+			size_type count(const key_type& k) const
+			{
+				shard& s = this->shardOf(k);
+
+				read_lock lock(s.lock);
+				return (s.map.count(k));
+			}
+
+			/* Calls fn(mapped_type&) on the value of k with its shard write locked, false if k isn't
+			   there. fn must not use the map (its shard is locked) */
+			template <class Function>
+			bool update(const key_type& k, Function fn)
+			{
+				shard& s = this->shardOf(k);
+
+				write_lock lock(s.lock);
+				const typename map_type::iterator it = s.map.find(k);
+				const bool found = (it != s.map.end());
+				if (found)
+					fn(it->second);
+				return (found);
+			}
+
+			/***************** Ordered traversal, every shard read locked *****************/
+
+			/* Calls fn(const value_type&) on every element in key order: a consistent snapshot,
+			   writers wait until it's done. fn must not write to the map */
+			template <class Function>
+			Function for_each(Function fn) const
+			{
+				ft::vector<cursor> heap;
+
+				heap.reserve(this->_mask + 1);
+				read_lock_all lock(this->_shards, this->_mask + 1);
+				for (size_t i = 0; i <= this->_mask; ++i)
+				{
+					cursor c;
+					c.it = this->_shards[i].map.begin();
+					c.end = this->_shards[i].map.end();
+					if (c.it != c.end)
+						heap.push_back(c);
+				}
+				this->merge(heap, NULL, fn);
+				return (fn);
+			}
+
+			// Same on the keys in [first, last) only
+			template <class Function>
+			Function for_each_in(const key_type& first, const key_type& last, Function fn) const
+			{
+				ft::vector<cursor> heap;
+
+				heap.reserve(this->_mask + 1);
+				read_lock_all lock(this->_shards, this->_mask + 1);
+				for (size_t i = 0; i <= this->_mask; ++i)
+				{
+					cursor c;
+					c.it = this->_shards[i].map.lower_bound(first);
+					c.end = this->_shards[i].map.end();
+					if (c.it != c.end)
+						heap.push_back(c);
+				}
+				this->merge(heap, &last, fn);
+				return (fn);
+			}
+	};
+
+}
+
+#endif
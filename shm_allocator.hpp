@@ -0,0 +1,355 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:52 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SHM_ALLOCATOR_HPP
+# define SHM_ALLOCATOR_HPP
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include "offset_ptr.hpp"
+
+/* Blocks are multiples of 16 bytes up to SHM_SMALL_MAX, powers of 2 above, one free list per size */
+#define SHM_ALIGNMENT 16
+#define SHM_SMALL_MAX 1024
+#define SHM_SMALL_CLASSES (SHM_SMALL_MAX / SHM_ALIGNMENT)
+#define SHM_CLASSES (SHM_SMALL_CLASSES + 64)
+
+// First bytes of a segment, to recognize one when opening it
+#define SHM_MAGIC 0x66745f73686d3031UL
+
+namespace ft
+{
+	inline void shm_error(const std::string& what)
+	{
+		throw (std::runtime_error("shm_segment: " + what + ": " + std::strerror(errno)));
+	}
+
+	/*
+		Start of a shared memory segment, the allocator state every process shares. Everything in
+		it is an offset from the segment start, so each process can map it anywhere.
+
+		Blocks are taken from the free list of their size, or carved at the top of the segment.
+		Freed blocks go back to their list and are never merged: fine for nodes and vectors
+		(which double their capacity), the sizes come back. A process shared mutex protects it all.
+	*/
+	struct shm_header
+	{
+		unsigned long	magic;
+		size_t			size;		// Of the whole segment
+		size_t			top;		// Offset of the memory never allocated yet
+		size_t			used;		// Bytes in allocated blocks
+		size_t			root;		// Offset of the object set_root() was given, 0 if none
+		size_t			freeLists[SHM_CLASSES]; // Offsets of the first free block of each size, 0 if none
+		pthread_mutex_t	mutex;
+
+		char* base() { return (reinterpret_cast<char*>(this)); }
+
+		static size_t sizeClass(size_t bytes)
+		{
+			if (bytes <= SHM_SMALL_MAX)
+				return ((bytes + SHM_ALIGNMENT - 1) / SHM_ALIGNMENT - 1);
+
+			size_t index = SHM_SMALL_CLASSES;
+			for (size_t size = SHM_SMALL_MAX * 2; size < bytes; size *= 2)
+				++index;
+			return (index);
+		}
+
+		static size_t classSize(size_t index)
+		{
+			if (index < SHM_SMALL_CLASSES)
+				return ((index + 1) * SHM_ALIGNMENT);
+			return ((size_t)SHM_SMALL_MAX * 2 << (index - SHM_SMALL_CLASSES));
+		}
+
+		void init(size_t segmentSize)
+		{
+			pthread_mutexattr_t attr;
+
+			this->size = segmentSize;
+			this->top = (sizeof(shm_header) + SHM_ALIGNMENT - 1) / SHM_ALIGNMENT * SHM_ALIGNMENT;
+			this->used = 0;
+			this->root = 0;
+			for (size_t i = 0; i < SHM_CLASSES; ++i)
+				this->freeLists[i] = 0;
+			pthread_mutexattr_init(&attr);
+			pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+			pthread_mutex_init(&this->mutex, &attr);
+			pthread_mutexattr_destroy(&attr);
+			__atomic_store_n(&this->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+		}
+
+		// Free blocks are raw memory, their first bytes hold the offset of the next free one
+		size_t nextFree(size_t offset)
+		{
+			size_t next;
+			std::memcpy(&next, this->base() + offset, sizeof(next));
+			return (next);
+		}
+
+		void setNextFree(size_t offset, size_t next) { std::memcpy(this->base() + offset, &next, sizeof(next)); }
+
+		void* allocate(size_t bytes)
+		{
+			if (bytes == 0)
+				bytes = 1;
+			if (bytes > this->size)
+				throw std::bad_alloc();
+
+			const size_t index = sizeClass(bytes);
+			const size_t blockSize = classSize(index);
+			size_t offset;
+
+			pthread_mutex_lock(&this->mutex);
+			offset = this->freeLists[index];
+			if (offset != 0)
+				this->freeLists[index] = this->nextFree(offset);
+			else if (blockSize <= this->size - this->top)
+			{
+				offset = this->top;
+				this->top += blockSize;
+			}
+			if (offset != 0)
+				this->used += blockSize;
+			pthread_mutex_unlock(&this->mutex);
+
+			if (offset == 0)
+				throw std::bad_alloc();
+			return (this->base() + offset);
+		}
+
+		// bytes must be the ones p was allocated with
+		void deallocate(void* p, size_t bytes)
+		{
+			if (p == NULL)
+				return ;
+			if (bytes == 0)
+				bytes = 1;
+
+			const size_t index = sizeClass(bytes);
+			const size_t offset = static_cast<char*>(p) - this->base();
+
+			pthread_mutex_lock(&this->mutex);
+			this->setNextFree(offset, this->freeLists[index]);
+			this->freeLists[index] = offset;
+			this->used -= classSize(index);
+			pthread_mutex_unlock(&this->mutex);
+		}
+	};
+
+	/*******************************************************
+	 *                    Shm allocator                    *
+	 *******************************************************/
+
+	/* Allocator of a shm_segment (see shm_segment::get_allocator), its pointer type is offset_ptr:
+	   a map or a vector placed in the segment with it is usable from any process mapping it.
+	   Values must themselves be position independent (no raw pointers, no std::string...) */
+	template <class T>
+	class shm_allocator
+	{
+		public:
+			typedef T						value_type;
+			typedef ft::offset_ptr<T>		pointer;
+			typedef ft::offset_ptr<const T>	const_pointer;
+			typedef T&						reference;
+			typedef const T&				const_reference;
+			typedef size_t					size_type;
+			typedef ptrdiff_t				difference_type;
+
+			template <class U>
+			struct rebind { typedef shm_allocator<U> other; };
+
+		private:
+			ft::offset_ptr<shm_header> _segment;
+
+		public:
+			explicit shm_allocator(shm_header* segment) : _segment(segment) { }
+			shm_allocator(const shm_allocator& other) : _segment(other._segment) { }
+			template <class U>
+			shm_allocator(const shm_allocator<U>& other) : _segment(other.segment()) { }
+			~shm_allocator() { }
+
+			shm_allocator& operator=(const shm_allocator& other)
+			{
+				this->_segment = other._segment;
+				return (*this);
+			}
+
+			pointer address(reference x) const { return (pointer(&x)); }
+			const_pointer address(const_reference x) const { return (const_pointer(&x)); }
+
+			pointer allocate(size_type n, const void* hint = 0)
+			{
+				(void)hint;
+				if (n > this->max_size() || __alignof__(T) > SHM_ALIGNMENT)
+					throw std::bad_alloc();
+				return (pointer(static_cast<T*>(this->_segment->allocate(n * sizeof(T)))));
+			}
+
+			void deallocate(pointer p, size_type n) { this->_segment->deallocate(p.get(), n * sizeof(T)); }
+
+			size_type max_size() const { return (std::numeric_limits<size_type>::max() / sizeof(T)); }
+
+			void construct(pointer p, const_reference val) { new (static_cast<void*>(p.get())) T(val); }
+			void destroy(pointer p) { p->~T(); }
+
+			shm_header* segment() const { return (this->_segment.get()); }
+	};
+
+	template <class T, class U>
+	bool operator==(const shm_allocator<T>& a, const shm_allocator<U>& b) { return (a.segment() == b.segment()); }
+
+	template <class T, class U>
+	bool operator!=(const shm_allocator<T>& a, const shm_allocator<U>& b) { return (a.segment() != b.segment()); }
+
+	/*******************************************************
+	 *                     Shm segment                     *
+	 *******************************************************/
+
+	/*
+		A POSIX shared memory object (shm_open) mapped in this process. One process creates it
+		with a size, builds its containers in it with get_allocator() and publishes the top one
+		with set_root(); others open it by name and find it with root(), wherever it got mapped.
+
+		  ft::shm_segment segment("/my_map", 1 << 30);
+		  map_type* m = new (segment.allocate(sizeof(map_type))) map_type(std::less<int>(), segment.get_allocator<value_type>());
+		  segment.set_root(m);
+		  ...
+		  ft::shm_segment other("/my_map");            // in another process
+		  map_type* same = other.root<map_type>();
+
+		The segment stays until remove(name), even once no process has it mapped. Containers
+		are as thread safe as usual: writers must be alone, readers can be many.
+	*/
+	class shm_segment
+	{
+		private:
+			int				_fd;
+			shm_header*		_header;
+			size_t			_size;
+
+			shm_segment(const shm_segment&);
+			shm_segment& operator=(const shm_segment&);
+
+			void map(size_t size)
+			{
+				void* p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+				if (p == MAP_FAILED)
+				{
+					close(this->_fd);
+					shm_error("mmap");
+				}
+				this->_header = static_cast<shm_header*>(p);
+				this->_size = size;
+			}
+
+		public:
+			// Creates the segment name (eg. "/name"), which must not exist yet
+			shm_segment(const char* name, size_t size) : _fd(-1), _header(NULL), _size(0)
+			{
+				if (size < sizeof(shm_header) + SHM_ALIGNMENT)
+				{
+					errno = EINVAL;
+					shm_error(name);
+				}
+				this->_fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+				if (this->_fd < 0)
+					shm_error(std::string("shm_open ") + name);
+				if (ftruncate(this->_fd, size) != 0)
+				{
+					close(this->_fd);
+					shm_unlink(name);
+					shm_error("ftruncate");
+				}
+				this->map(size);
+				this->_header->init(size);
+			}
+
+			// Opens an existing segment
+			explicit shm_segment(const char* name) : _fd(-1), _header(NULL), _size(0)
+			{
+				struct stat st;
+
+				this->_fd = shm_open(name, O_RDWR, 0600);
+				if (this->_fd < 0)
+					shm_error(std::string("shm_open ") + name);
+				if (fstat(this->_fd, &st) != 0)
+				{
+					close(this->_fd);
+					shm_error("fstat");
+				}
+				this->map(st.st_size);
+				if (this->_size < sizeof(shm_header) || __atomic_load_n(&this->_header->magic, __ATOMIC_ACQUIRE) != SHM_MAGIC)
+				{
+					munmap(this->_header, this->_size);
+					close(this->_fd);
+					errno = EINVAL;
+					shm_error(std::string("not a segment: ") + name);
+				}
+			}
+
+			~shm_segment()
+			{
+				munmap(this->_header, this->_size);
+				close(this->_fd);
+			}
+
+			// Deletes the segment name, mapped ones stay usable until unmapped
+			static bool remove(const char* name) { return (shm_unlink(name) == 0); }
+
+			void* allocate(size_t bytes) { return (this->_header->allocate(bytes)); }
+			void deallocate(void* p, size_t bytes) { this->_header->deallocate(p, bytes); }
+
+			template <class T>
+			shm_allocator<T> get_allocator() const { return (shm_allocator<T>(this->_header)); }
+
+			// Publishes the object the other processes will find with root()
+			void set_root(void* object)
+			{
+				const size_t offset = (object == NULL) ? 0 : static_cast<char*>(object) - this->_header->base();
+				__atomic_store_n(&this->_header->root, offset, __ATOMIC_RELEASE);
+			}
+
+			template <class T>
+			T* root() const
+			{
+				const size_t offset = __atomic_load_n(&this->_header->root, __ATOMIC_ACQUIRE);
+				return (offset == 0 ? NULL : reinterpret_cast<T*>(this->_header->base() + offset));
+			}
+
+			void* base() const { return (this->_header); }
+			size_t size() const { return (this->_size); }
+
+			// Bytes in allocated blocks (rounded to their size class)
+			size_t used() const
+			{
+				pthread_mutex_lock(&this->_header->mutex);
+				const size_t bytes = this->_header->used;
+				pthread_mutex_unlock(&this->_header->mutex);
+				return (bytes);
+			}
+	};
+
+}
+
+#endif
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:27 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SIMD_HPP
+# define SIMD_HPP
+
+#include <cstring>
+#include <cstddef>
+
+/* SSE2 is part of x86-64, AVX2 kernels are compiled anyway with the target attribute
+   and only called when the CPU running the program supports them */
+#if defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+# include <immintrin.h>
+# define FT_SIMD_X86 1
+#else
+# define FT_SIMD_X86 0
+#endif
+
+namespace ft
+{
+	/*******************************************************
+	 *                  CPU feature detection              *
+	 *******************************************************/
+
+	// Asked once, the answer can't change while running
+	inline bool cpu_has_avx2()
+	{
+#if FT_SIMD_X86
+		static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+		return (hasAvx2);
+#else
+		return (false);
+#endif
+	}
+
+	/*******************************************************
+	 *                 First mismatching byte              *
+	 *******************************************************/
+
+	/* All kernels return the offset of the first byte that differs between a and b, or n */
+
+	// Portable version, 8 bytes at a time
+	inline size_t simd_mismatch_scalar(const unsigned char* a, const unsigned char* b, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + sizeof(unsigned long long) <= n; i += sizeof(unsigned long long))
+		{
+			unsigned long long wa, wb;
+			std::memcpy(&wa, a + i, sizeof(wa));
+			std::memcpy(&wb, b + i, sizeof(wb));
+			if (wa != wb)
+				break;
+		}
+		while (i < n && a[i] == b[i])
+			++i;
+		return (i);
+	}
+
+#if FT_SIMD_X86
+	// 16 bytes per iteration, movemask gives one bit per equal byte
+	inline size_t simd_mismatch_sse2(const unsigned char* a, const unsigned char* b, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 16 <= n; i += 16)
+		{
+			__m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+			__m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+			unsigned int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(va, vb));
+			if (mask != 0xffff)
+				return (i + __builtin_ctz(~mask));
+		}
+		return (i + simd_mismatch_scalar(a + i, b + i, n - i));
+	}
+
+	// Same with 32 bytes, two loads in flight per iteration to hide latency
+	__attribute__((target("avx2")))
+	inline size_t simd_mismatch_avx2(const unsigned char* a, const unsigned char* b, size_t n)
+	{
+		size_t i = 0;
+
+		for (; i + 64 <= n; i += 64)
+		{
+			__m256i eq0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+											_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+			__m256i eq1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32)),
+											_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32)));
+			if (static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_and_si256(eq0, eq1))) != 0xffffffffu)
+			{
+				unsigned int mask = _mm256_movemask_epi8(eq0);
+				if (mask != 0xffffffffu)
+					return (i + __builtin_ctz(~mask));
+				mask = _mm256_movemask_epi8(eq1);
+				return (i + 32 + __builtin_ctz(~mask));
+			}
+		}
+		return (i + simd_mismatch_sse2(a + i, b + i, n - i));
+	}
+#endif
+
+	inline size_t simd_mismatch(const unsigned char* a, const unsigned char* b, size_t n)
+	{
+#if FT_SIMD_X86
+		if (n >= 64 && cpu_has_avx2())
+			return (simd_mismatch_avx2(a, b, n));
+		return (simd_mismatch_sse2(a, b, n));
+#else
+		return (simd_mismatch_scalar(a, b, n));
+#endif
+	}
+
+}
+
+#endif
@@ -0,0 +1,680 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:43 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SIMD_REDUCE_HPP
+# define SIMD_REDUCE_HPP
+
+#include "simd.hpp"
+
+/* Reduction kernels over raw arrays of int, float and double: sum, min / max, count and find.
+   Each one has a portable version, an SSE2 one (part of x86-64) and an AVX2 one only called when
+   the CPU supports it. They are overloaded on the pointer type so that templates can just call
+   ft::simd_sum(ptr, n) and get the right one.
+   Float sums are computed in a different order than a loop would (one partial sum per lane),
+   which is allowed for ft::reduce but may round differently than ft::accumulate would */
+
+namespace ft
+{
+	/*******************************************************
+	 *                   Portable kernels                  *
+	 *******************************************************/
+
+	template <class T>
+	T simd_sum_scalar(const T* a, size_t n)
+	{
+		T sum0 = T();
+		T sum1 = T();
+		size_t i = 0;
+
+		for (; i + 2 <= n; i += 2)
+		{
+			sum0 += a[i];
+			sum1 += a[i + 1];
+		}
+		if (i < n)
+			sum0 += a[i];
+		return (sum0 + sum1);
+	}
+
+	// ints wrap instead of overflowing (which would be undefined)
+	inline int simd_sum_scalar(const int* a, size_t n)
+	{
+		unsigned int sum = 0;
+
+		for (size_t i = 0; i < n; ++i)
+			sum += static_cast<unsigned int>(a[i]);
+		return (static_cast<int>(sum));
+	}
+
+	// Returns false if a NaN was met, min and max are then meaningless (n must not be 0)
+	template <class T>
+	bool simd_minmax_scalar(const T* a, size_t n, T& min, T& max)
+	{
+		min = a[0];
+		max = a[0];
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (a[i] != a[i])
+				return (false);
+			if (a[i] < min)
+				min = a[i];
+			if (max < a[i])
+				max = a[i];
+		}
+		return (true);
+	}
+
+	template <class T>
+	size_t simd_count_scalar(const T* a, size_t n, T value)
+	{
+		size_t count = 0;
+
+		for (size_t i = 0; i < n; ++i)
+			count += (a[i] == value);
+		return (count);
+	}
+
+	// Index of the first element equal to value, or n
+	template <class T>
+	size_t simd_find_scalar(const T* a, size_t n, T value)
+	{
+		size_t i = 0;
+
+		while (i < n && !(a[i] == value))
+			++i;
+		return (i);
+	}
+
+#if FT_SIMD_X86
+	/*******************************************************
+	 *                     SSE2 kernels                    *
+	 *******************************************************/
+
+	/* Horizontal reductions of a whole register, the lanes are just spilled:
+	   it only happens once per call */
+
+	inline int simd_hsum_sse2(__m128i v)
+	{
+		int lanes[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), v);
+		return (simd_sum_scalar(lanes, 4));
+	}
+
+	inline float simd_hsum_sse2(__m128 v)
+	{
+		float lanes[4];
+		_mm_storeu_ps(lanes, v);
+		return ((lanes[0] + lanes[2]) + (lanes[1] + lanes[3]));
+	}
+
+	inline double simd_hsum_sse2(__m128d v)
+	{
+		double lanes[2];
+		_mm_storeu_pd(lanes, v);
+		return (lanes[0] + lanes[1]);
+	}
+
+	inline int simd_sum_sse2(const int* a, size_t n)
+	{
+		__m128i sum0 = _mm_setzero_si128();
+		__m128i sum1 = _mm_setzero_si128();
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			sum0 = _mm_add_epi32(sum0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+			sum1 = _mm_add_epi32(sum1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 4)));
+		}
+		return (static_cast<int>(static_cast<unsigned int>(simd_hsum_sse2(_mm_add_epi32(sum0, sum1)))
+								 + static_cast<unsigned int>(simd_sum_scalar(a + i, n - i))));
+	}
+
+	inline float simd_sum_sse2(const float* a, size_t n)
+	{
+		__m128 sum0 = _mm_setzero_ps();
+		__m128 sum1 = _mm_setzero_ps();
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			sum0 = _mm_add_ps(sum0, _mm_loadu_ps(a + i));
+			sum1 = _mm_add_ps(sum1, _mm_loadu_ps(a + i + 4));
+		}
+		return (simd_hsum_sse2(_mm_add_ps(sum0, sum1)) + simd_sum_scalar(a + i, n - i));
+	}
+
+	inline double simd_sum_sse2(const double* a, size_t n)
+	{
+		__m128d sum0 = _mm_setzero_pd();
+		__m128d sum1 = _mm_setzero_pd();
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			sum0 = _mm_add_pd(sum0, _mm_loadu_pd(a + i));
+			sum1 = _mm_add_pd(sum1, _mm_loadu_pd(a + i + 2));
+		}
+		return (simd_hsum_sse2(_mm_add_pd(sum0, sum1)) + simd_sum_scalar(a + i, n - i));
+	}
+
+	// SSE2 has no 32 bits min / max (SSE4.1 has), select with a compare mask
+	inline __m128i simd_select_sse2(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+	{ return (_mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse))); }
+
+	inline bool simd_minmax_sse2(const int* a, size_t n, int& min, int& max)
+	{
+		if (n < 4)
+			return (simd_minmax_scalar(a, n, min, max));
+
+		__m128i vmin = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+		__m128i vmax = vmin;
+		size_t i = 4;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+			vmin = simd_select_sse2(_mm_cmplt_epi32(v, vmin), v, vmin);
+			vmax = simd_select_sse2(_mm_cmpgt_epi32(v, vmax), v, vmax);
+		}
+
+		int mins[4], maxs[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(mins), vmin);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(maxs), vmax);
+		int tailMin, tailMax;
+		simd_minmax_scalar(mins, 4, min, tailMax);
+		simd_minmax_scalar(maxs, 4, tailMin, max);
+		if (i < n)
+		{
+			simd_minmax_scalar(a + i, n - i, tailMin, tailMax);
+			min = (tailMin < min) ? tailMin : min;
+			max = (max < tailMax) ? tailMax : max;
+		}
+		return (true);
+	}
+
+	/* NaNs are looked for along the way (unordered compare with itself),
+	   min / max instructions don't treat them like operator< does */
+	inline bool simd_minmax_sse2(const float* a, size_t n, float& min, float& max)
+	{
+		if (n < 4)
+			return (simd_minmax_scalar(a, n, min, max));
+
+		__m128 vmin = _mm_loadu_ps(a);
+		__m128 vmax = vmin;
+		__m128 nan = _mm_cmpunord_ps(vmin, vmin);
+		size_t i = 4;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 v = _mm_loadu_ps(a + i);
+			vmin = _mm_min_ps(vmin, v);
+			vmax = _mm_max_ps(vmax, v);
+			nan = _mm_or_ps(nan, _mm_cmpunord_ps(v, v));
+		}
+		if (_mm_movemask_ps(nan) != 0)
+			return (false);
+
+		float mins[4], maxs[4];
+		_mm_storeu_ps(mins, vmin);
+		_mm_storeu_ps(maxs, vmax);
+		float tailMin, tailMax;
+		simd_minmax_scalar(mins, 4, min, tailMax);
+		simd_minmax_scalar(maxs, 4, tailMin, max);
+		if (i < n)
+		{
+			if (!simd_minmax_scalar(a + i, n - i, tailMin, tailMax))
+				return (false);
+			min = (tailMin < min) ? tailMin : min;
+			max = (max < tailMax) ? tailMax : max;
+		}
+		return (true);
+	}
+
+	inline bool simd_minmax_sse2(const double* a, size_t n, double& min, double& max)
+	{
+		if (n < 2)
+			return (simd_minmax_scalar(a, n, min, max));
+
+		__m128d vmin = _mm_loadu_pd(a);
+		__m128d vmax = vmin;
+		__m128d nan = _mm_cmpunord_pd(vmin, vmin);
+		size_t i = 2;
+
+		for (; i + 2 <= n; i += 2)
+		{
+			__m128d v = _mm_loadu_pd(a + i);
+			vmin = _mm_min_pd(vmin, v);
+			vmax = _mm_max_pd(vmax, v);
+			nan = _mm_or_pd(nan, _mm_cmpunord_pd(v, v));
+		}
+		if (_mm_movemask_pd(nan) != 0)
+			return (false);
+
+		double mins[2], maxs[2];
+		_mm_storeu_pd(mins, vmin);
+		_mm_storeu_pd(maxs, vmax);
+		double tailMin, tailMax;
+		simd_minmax_scalar(mins, 2, min, tailMax);
+		simd_minmax_scalar(maxs, 2, tailMin, max);
+		if (i < n)
+		{
+			if (!simd_minmax_scalar(a + i, n - i, tailMin, tailMax))
+				return (false);
+			min = (tailMin < min) ? tailMin : min;
+			max = (max < tailMax) ? tailMax : max;
+		}
+		return (true);
+	}
+
+	/* Equal lanes are all ones, which is -1: subtracting the mask counts them. A lane could
+	   overflow after 2^32 matches, so the counters are flushed every block */
+	#define SIMD_COUNT_BLOCK ((size_t)1 << 30)
+
+	inline size_t simd_count_sse2(const int* a, size_t n, int value)
+	{
+		const __m128i needle = _mm_set1_epi32(value);
+		size_t count = 0;
+		size_t i = 0;
+
+		while (i + 4 <= n)
+		{
+			const size_t blockEnd = (n - i > SIMD_COUNT_BLOCK) ? i + SIMD_COUNT_BLOCK : n;
+			__m128i counts = _mm_setzero_si128();
+
+			for (; i + 4 <= blockEnd; i += 4)
+				counts = _mm_sub_epi32(counts, _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)), needle));
+			count += static_cast<unsigned int>(simd_hsum_sse2(counts));
+		}
+		return (count + simd_count_scalar(a + i, n - i, value));
+	}
+
+	inline size_t simd_count_sse2(const float* a, size_t n, float value)
+	{
+		const __m128 needle = _mm_set1_ps(value);
+		size_t count = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+			count += __builtin_popcount(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i), needle)));
+		return (count + simd_count_scalar(a + i, n - i, value));
+	}
+
+	inline size_t simd_count_sse2(const double* a, size_t n, double value)
+	{
+		const __m128d needle = _mm_set1_pd(value);
+		size_t count = 0;
+		size_t i = 0;
+
+		for (; i + 2 <= n; i += 2)
+			count += __builtin_popcount(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), needle)));
+		return (count + simd_count_scalar(a + i, n - i, value));
+	}
+
+	inline size_t simd_find_sse2(const int* a, size_t n, int value)
+	{
+		const __m128i needle = _mm_set1_epi32(value);
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)), needle)));
+			if (mask != 0)
+				return (i + __builtin_ctz(mask));
+		}
+		return (i + simd_find_scalar(a + i, n - i, value));
+	}
+
+	inline size_t simd_find_sse2(const float* a, size_t n, float value)
+	{
+		const __m128 needle = _mm_set1_ps(value);
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i), needle));
+			if (mask != 0)
+				return (i + __builtin_ctz(mask));
+		}
+		return (i + simd_find_scalar(a + i, n - i, value));
+	}
+
+	inline size_t simd_find_sse2(const double* a, size_t n, double value)
+	{
+		const __m128d needle = _mm_set1_pd(value);
+		size_t i = 0;
+
+		for (; i + 2 <= n; i += 2)
+		{
+			int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(a + i), needle));
+			if (mask != 0)
+				return (i + __builtin_ctz(mask));
+		}
+		return (i + simd_find_scalar(a + i, n - i, value));
+	}
+
+	/*******************************************************
+	 *                     AVX2 kernels                    *
+	 *******************************************************/
+
+	/* Same algorithms with 256 bits registers, the 128 bits halves are folded together
+	   and handed to the SSE2 horizontal reductions */
+
+	__attribute__((target("avx2")))
+	inline int simd_sum_avx2(const int* a, size_t n)
+	{
+		__m256i sum0 = _mm256_setzero_si256();
+		__m256i sum1 = _mm256_setzero_si256();
+		size_t i = 0;
+
+		for (; i + 16 <= n; i += 16)
+		{
+			sum0 = _mm256_add_epi32(sum0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)));
+			sum1 = _mm256_add_epi32(sum1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 8)));
+		}
+		sum0 = _mm256_add_epi32(sum0, sum1);
+		__m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum0), _mm256_extracti128_si256(sum0, 1));
+		return (static_cast<int>(static_cast<unsigned int>(simd_hsum_sse2(half))
+								 + static_cast<unsigned int>(simd_sum_sse2(a + i, n - i))));
+	}
+
+	__attribute__((target("avx2")))
+	inline float simd_sum_avx2(const float* a, size_t n)
+	{
+		__m256 sum0 = _mm256_setzero_ps();
+		__m256 sum1 = _mm256_setzero_ps();
+		size_t i = 0;
+
+		for (; i + 16 <= n; i += 16)
+		{
+			sum0 = _mm256_add_ps(sum0, _mm256_loadu_ps(a + i));
+			sum1 = _mm256_add_ps(sum1, _mm256_loadu_ps(a + i + 8));
+		}
+		sum0 = _mm256_add_ps(sum0, sum1);
+		__m128 half = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+		return (simd_hsum_sse2(half) + simd_sum_sse2(a + i, n - i));
+	}
+
+	__attribute__((target("avx2")))
+	inline double simd_sum_avx2(const double* a, size_t n)
+	{
+		__m256d sum0 = _mm256_setzero_pd();
+		__m256d sum1 = _mm256_setzero_pd();
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			sum0 = _mm256_add_pd(sum0, _mm256_loadu_pd(a + i));
+			sum1 = _mm256_add_pd(sum1, _mm256_loadu_pd(a + i + 4));
+		}
+		sum0 = _mm256_add_pd(sum0, sum1);
+		__m128d half = _mm_add_pd(_mm256_castpd256_pd128(sum0), _mm256_extractf128_pd(sum0, 1));
+		return (simd_hsum_sse2(half) + simd_sum_sse2(a + i, n - i));
+	}
+
+	__attribute__((target("avx2")))
+	inline bool simd_minmax_avx2(const int* a, size_t n, int& min, int& max)
+	{
+		if (n < 8)
+			return (simd_minmax_sse2(a, n, min, max));
+
+		__m256i vmin = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+		__m256i vmax = vmin;
+		size_t i = 8;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+			vmin = _mm256_min_epi32(vmin, v);
+			vmax = _mm256_max_epi32(vmax, v);
+		}
+
+		int lanes[8];
+		int tailMin, tailMax;
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), vmin);
+		simd_minmax_scalar(lanes, 8, min, tailMax);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), vmax);
+		simd_minmax_scalar(lanes, 8, tailMin, max);
+		if (i < n)
+		{
+			simd_minmax_scalar(a + i, n - i, tailMin, tailMax);
+			min = (tailMin < min) ? tailMin : min;
+			max = (max < tailMax) ? tailMax : max;
+		}
+		return (true);
+	}
+
+	__attribute__((target("avx2")))
+	inline bool simd_minmax_avx2(const float* a, size_t n, float& min, float& max)
+	{
+		if (n < 8)
+			return (simd_minmax_sse2(a, n, min, max));
+
+		__m256 vmin = _mm256_loadu_ps(a);
+		__m256 vmax = vmin;
+		__m256 nan = _mm256_cmp_ps(vmin, vmin, _CMP_UNORD_Q);
+		size_t i = 8;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 v = _mm256_loadu_ps(a + i);
+			vmin = _mm256_min_ps(vmin, v);
+			vmax = _mm256_max_ps(vmax, v);
+			nan = _mm256_or_ps(nan, _mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+		}
+		if (_mm256_movemask_ps(nan) != 0)
+			return (false);
+
+		float lanes[8];
+		float tailMin, tailMax;
+		_mm256_storeu_ps(lanes, vmin);
+		simd_minmax_scalar(lanes, 8, min, tailMax);
+		_mm256_storeu_ps(lanes, vmax);
+		simd_minmax_scalar(lanes, 8, tailMin, max);
+		if (i < n)
+		{
+			if (!simd_minmax_scalar(a + i, n - i, tailMin, tailMax))
+				return (false);
+			min = (tailMin < min) ? tailMin : min;
+			max = (max < tailMax) ? tailMax : max;
+		}
+		return (true);
+	}
+
+	__attribute__((target("avx2")))
+	inline bool simd_minmax_avx2(const double* a, size_t n, double& min, double& max)
+	{
+		if (n < 4)
+			return (simd_minmax_sse2(a, n, min, max));
+
+		__m256d vmin = _mm256_loadu_pd(a);
+		__m256d vmax = vmin;
+		__m256d nan = _mm256_cmp_pd(vmin, vmin, _CMP_UNORD_Q);
+		size_t i = 4;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m256d v = _mm256_loadu_pd(a + i);
+			vmin = _mm256_min_pd(vmin, v);
+			vmax = _mm256_max_pd(vmax, v);
+			nan = _mm256_or_pd(nan, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+		}
+		if (_mm256_movemask_pd(nan) != 0)
+			return (false);
+
+		double lanes[4];
+		double tailMin, tailMax;
+		_mm256_storeu_pd(lanes, vmin);
+		simd_minmax_scalar(lanes, 4, min, tailMax);
+		_mm256_storeu_pd(lanes, vmax);
+		simd_minmax_scalar(lanes, 4, tailMin, max);
+		if (i < n)
+		{
+			if (!simd_minmax_scalar(a + i, n - i, tailMin, tailMax))
+				return (false);
+			min = (tailMin < min) ? tailMin : min;
+			max = (max < tailMax) ? tailMax : max;
+		}
+		return (true);
+	}
+
+	__attribute__((target("avx2")))
+	inline size_t simd_count_avx2(const int* a, size_t n, int value)
+	{
+		const __m256i needle = _mm256_set1_epi32(value);
+		size_t count = 0;
+		size_t i = 0;
+
+		while (i + 8 <= n)
+		{
+			const size_t blockEnd = (n - i > SIMD_COUNT_BLOCK) ? i + SIMD_COUNT_BLOCK : n;
+			__m256i counts = _mm256_setzero_si256();
+
+			for (; i + 8 <= blockEnd; i += 8)
+				counts = _mm256_sub_epi32(counts, _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), needle));
+			__m128i half = _mm_add_epi32(_mm256_castsi256_si128(counts), _mm256_extracti128_si256(counts, 1));
+			count += static_cast<unsigned int>(simd_hsum_sse2(half));
+		}
+		return (count + simd_count_scalar(a + i, n - i, value));
+	}
+
+	__attribute__((target("avx2")))
+	inline size_t simd_count_avx2(const float* a, size_t n, float value)
+	{
+		const __m256 needle = _mm256_set1_ps(value);
+		size_t count = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+			count += __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(a + i), needle, _CMP_EQ_OQ)));
+		return (count + simd_count_scalar(a + i, n - i, value));
+	}
+
+	__attribute__((target("avx2")))
+	inline size_t simd_count_avx2(const double* a, size_t n, double value)
+	{
+		const __m256d needle = _mm256_set1_pd(value);
+		size_t count = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+			count += __builtin_popcount(_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i), needle, _CMP_EQ_OQ)));
+		return (count + simd_count_scalar(a + i, n - i, value));
+	}
+
+	__attribute__((target("avx2")))
+	inline size_t simd_find_avx2(const int* a, size_t n, int value)
+	{
+		const __m256i needle = _mm256_set1_epi32(value);
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)), needle)));
+			if (mask != 0)
+				return (i + __builtin_ctz(mask));
+		}
+		return (i + simd_find_scalar(a + i, n - i, value));
+	}
+
+	__attribute__((target("avx2")))
+	inline size_t simd_find_avx2(const float* a, size_t n, float value)
+	{
+		const __m256 needle = _mm256_set1_ps(value);
+		size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(a + i), needle, _CMP_EQ_OQ));
+			if (mask != 0)
+				return (i + __builtin_ctz(mask));
+		}
+		return (i + simd_find_scalar(a + i, n - i, value));
+	}
+
+	__attribute__((target("avx2")))
+	inline size_t simd_find_avx2(const double* a, size_t n, double value)
+	{
+		const __m256d needle = _mm256_set1_pd(value);
+		size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(a + i), needle, _CMP_EQ_OQ));
+			if (mask != 0)
+				return (i + __builtin_ctz(mask));
+		}
+		return (i + simd_find_scalar(a + i, n - i, value));
+	}
+#endif
+
+	/*******************************************************
+	 *                      Dispatchers                    *
+	 *******************************************************/
+
+	// Types with sum and min / max kernels, everything else goes through the generic loops
+	template <class T>
+	struct has_simd_reduction { static const bool value = false; };
+
+	template <>
+	struct has_simd_reduction<int> { static const bool value = true; };
+
+	template <>
+	struct has_simd_reduction<float> { static const bool value = true; };
+
+	template <>
+	struct has_simd_reduction<double> { static const bool value = true; };
+
+	// count / find only need equality: the kernel type with the same bits
+	template <class T>
+	struct simd_search_type { static const bool value = false; typedef T type; };
+
+	template <>
+	struct simd_search_type<int> { static const bool value = true; typedef int type; };
+
+	template <>
+	struct simd_search_type<unsigned int> { static const bool value = true; typedef int type; };
+
+	template <>
+	struct simd_search_type<float> { static const bool value = true; typedef float type; };
+
+	template <>
+	struct simd_search_type<double> { static const bool value = true; typedef double type; };
+
+#if FT_SIMD_X86
+	# define FT_SIMD_DISPATCH(name, args) \
+		return (cpu_has_avx2() ? name##_avx2 args : name##_sse2 args)
+#else
+	# define FT_SIMD_DISPATCH(name, args) \
+		return (name##_scalar args)
+#endif
+
+	inline int simd_sum(const int* a, size_t n) { FT_SIMD_DISPATCH(simd_sum, (a, n)); }
+	inline float simd_sum(const float* a, size_t n) { FT_SIMD_DISPATCH(simd_sum, (a, n)); }
+	inline double simd_sum(const double* a, size_t n) { FT_SIMD_DISPATCH(simd_sum, (a, n)); }
+
+	inline bool simd_minmax(const int* a, size_t n, int& min, int& max) { FT_SIMD_DISPATCH(simd_minmax, (a, n, min, max)); }
+	inline bool simd_minmax(const float* a, size_t n, float& min, float& max) { FT_SIMD_DISPATCH(simd_minmax, (a, n, min, max)); }
+	inline bool simd_minmax(const double* a, size_t n, double& min, double& max) { FT_SIMD_DISPATCH(simd_minmax, (a, n, min, max)); }
+
+	inline size_t simd_count(const int* a, size_t n, int value) { FT_SIMD_DISPATCH(simd_count, (a, n, value)); }
+	inline size_t simd_count(const float* a, size_t n, float value) { FT_SIMD_DISPATCH(simd_count, (a, n, value)); }
+	inline size_t simd_count(const double* a, size_t n, double value) { FT_SIMD_DISPATCH(simd_count, (a, n, value)); }
+
+	inline size_t simd_find(const int* a, size_t n, int value) { FT_SIMD_DISPATCH(simd_find, (a, n, value)); }
+	inline size_t simd_find(const float* a, size_t n, float value) { FT_SIMD_DISPATCH(simd_find, (a, n, value)); }
+	inline size_t simd_find(const double* a, size_t n, double value) { FT_SIMD_DISPATCH(simd_find, (a, n, value)); }
+
+	# undef FT_SIMD_DISPATCH
+
+}
+
+#endif
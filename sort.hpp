@@ -0,0 +1,189 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:24 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SORT_HPP
+# define SORT_HPP
+
+#include "iterators.hpp"
+
+#include <functional>
+
+// Below this many elements, insertion sort beats any partitioning scheme
+#define SORT_INSERTION_THRESHOLD 16
+
+namespace ft
+{
+	template <class RandomAccessIterator>
+	void iter_swap(RandomAccessIterator a, RandomAccessIterator b)
+	{
+		typename ft::iterator_traits<RandomAccessIterator>::value_type tmp = *a;
+		*a = *b;
+		*b = tmp;
+	}
+
+	/* Stable, quadratic, but unbeatable on tiny ranges since it only shifts elements */
+	template <class RandomAccessIterator, class Compare>
+	void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		if (first == last)
+			return;
+
+		for (RandomAccessIterator i = first + 1; i != last; ++i)
+		{
+			typename ft::iterator_traits<RandomAccessIterator>::value_type tmp = *i;
+			RandomAccessIterator j = i;
+
+			// Shift everything bigger than tmp one slot to the right, then drop tmp in the hole
+			while (j != first && comp(tmp, *(j - 1)))
+			{
+				*j = *(j - 1);
+				--j;
+			}
+			*j = tmp;
+		}
+	}
+
+	/* Move the element at index `hole` down the max-heap of size len until both childs are smaller */
+	template <class RandomAccessIterator, class Distance, class Compare>
+	void sift_down(RandomAccessIterator first, Distance hole, Distance len, Compare comp)
+	{
+		typename ft::iterator_traits<RandomAccessIterator>::value_type tmp = *(first + hole);
+		Distance child = 2 * hole + 1;
+
+		while (child < len)
+		{
+			// Take the biggest of both childs
+			if (child + 1 < len && comp(*(first + child), *(first + child + 1)))
+				++child;
+			if (!comp(tmp, *(first + child)))
+				break;
+			*(first + hole) = *(first + child);
+			hole = child;
+			child = 2 * hole + 1;
+		}
+		*(first + hole) = tmp;
+	}
+
+	/* Used by sort when quicksort degenerates, guarantees O(n log n) */
+	template <class RandomAccessIterator, class Compare>
+	void heap_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+		difference_type len = last - first;
+		if (len < 2)
+			return;
+
+		// Build the max-heap from the last parent up to the root
+		for (difference_type i = len / 2; i > 0; --i)
+			ft::sift_down(first, i - 1, len, comp);
+
+		// Biggest is always at the root, move it at the end and shrink the heap
+		for (difference_type end = len - 1; end > 0; --end)
+		{
+			ft::iter_swap(first, first + end);
+			ft::sift_down(first, difference_type(0), end, comp);
+		}
+	}
+
+	/* Put the median of a, b and c in result, so that partitioning has a sentinel on both sides */
+	template <class RandomAccessIterator, class Compare>
+	void move_median_to_first(RandomAccessIterator result, RandomAccessIterator a,
+							  RandomAccessIterator b, RandomAccessIterator c, Compare comp)
+	{
+		if (comp(*a, *b))
+		{
+			if (comp(*b, *c))
+				ft::iter_swap(result, b);
+			else if (comp(*a, *c))
+				ft::iter_swap(result, c);
+			else
+				ft::iter_swap(result, a);
+		}
+		else if (comp(*a, *c))
+			ft::iter_swap(result, a);
+		else if (comp(*b, *c))
+			ft::iter_swap(result, c);
+		else
+			ft::iter_swap(result, b);
+	}
+
+	/* Hoare partition around *pivot, no bound checks since the median of three
+	   guarantees an element not smaller and one not bigger than the pivot in the range */
+	template <class RandomAccessIterator, class Compare>
+	RandomAccessIterator unguarded_partition(RandomAccessIterator first, RandomAccessIterator last,
+											 RandomAccessIterator pivot, Compare comp)
+	{
+		while (true)
+		{
+			while (comp(*first, *pivot))
+				++first;
+			--last;
+			while (comp(*pivot, *last))
+				--last;
+			if (!(first < last))
+				return (first);
+			ft::iter_swap(first, last);
+			++first;
+		}
+	}
+
+	/* Quicksort the range down to SORT_INSERTION_THRESHOLD sized chunks, switch to heap sort
+	   if recursion gets too deep (bad pivots), the final insertion sort pass finishes the job */
+	template <class RandomAccessIterator, class Size, class Compare>
+	void introsort_loop(RandomAccessIterator first, RandomAccessIterator last, Size depth, Compare comp)
+	{
+		while (last - first > SORT_INSERTION_THRESHOLD)
+		{
+			if (depth == 0)
+			{
+				ft::heap_sort(first, last, comp);
+				return;
+			}
+			--depth;
+
+			RandomAccessIterator mid = first + (last - first) / 2;
+			ft::move_median_to_first(first, first + 1, mid, last - 1, comp);
+			RandomAccessIterator cut = ft::unguarded_partition(first + 1, last, first, comp);
+
+			// Recurse on the right part, loop on the left one to keep the stack small
+			ft::introsort_loop(cut, last, depth, comp);
+			last = cut;
+		}
+	}
+
+	/* Introsort, like every STL: quicksort, heap sort when it goes wrong, insertion sort to finish.
+	   Not stable, equal elements may be reordered */
+	template <class RandomAccessIterator, class Compare>
+	void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		if (last - first < 2)
+			return;
+
+		// 2 * log2(n) is the usual depth limit before considering the pivots are bad
+		size_t depth = 0;
+		for (size_t n = last - first; n > 1; n >>= 1)
+			depth += 2;
+
+		ft::introsort_loop(first, last, depth, comp);
+		ft::insertion_sort(first, last, comp);
+	}
+
+	template <class RandomAccessIterator>
+	void sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::sort(first, last, std::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+}
+
+#endif
@@ -0,0 +1,251 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:06 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPSC_RING_HPP
+# define SPSC_RING_HPP
+
+#include <memory>
+
+#include "memory.hpp"
+#include "thread_pool.hpp"
+
+namespace ft
+{
+	/*
+		Ring buffer between exactly one producer thread and one consumer thread, wait-free:
+		nobody ever waits for the other, a push or pop either succeeds or sees full / empty.
+
+		The producer only writes _tail and the consumer only writes _head, each on its own cache
+		line. Each side also keeps the last value it saw of the other's index (_cachedHead /
+		_cachedTail, on its own line too): it only reads the real one, whose cache line is owned by
+		the other core, when the cached one says full / empty. With a steady flow that's once per
+		lap instead of once per element.
+
+		Indexes are never wrapped, only masked: tail - head is the size even across the wrap.
+		push_n / pop_n copy at most two contiguous pieces (memcpy for trivially copyable types),
+		the span functions give direct access to the buffer for zero-copy producers / consumers.
+	*/
+	template <class T, class Allocator = std::allocator<T> >
+	class spsc_ring
+	{
+		public:
+			typedef T										value_type;
+			typedef Allocator								allocator_type;
+			typedef typename allocator_type::pointer		pointer;
+			typedef typename allocator_type::const_pointer	const_pointer;
+			typedef size_t									size_type;
+
+		private:
+			// Read only once constructed
+			char			_frontPad[FT_CACHE_LINE_SIZE];
+			pointer			_buffer;
+			size_t			_mask;
+			allocator_type	_alloc;
+			char			_bufferPad[FT_CACHE_LINE_SIZE];
+			// Producer
+			size_t			_tail;
+			size_t			_cachedHead;
+			char			_producerPad[FT_CACHE_LINE_SIZE - sizeof(size_t) * 2];
+			// Consumer
+			size_t			_head;
+			size_t			_cachedTail;
+			char			_consumerPad[FT_CACHE_LINE_SIZE - sizeof(size_t) * 2];
+
+			// Not copyable, threads may be using it
+			spsc_ring(const spsc_ring&);
+			spsc_ring& operator=(const spsc_ring&);
+
+			static size_t roundCapacity(size_t capacity)
+			{
+				size_t rounded = 1;
+
+				while (rounded < capacity)
+					rounded <<= 1;
+				return (rounded);
+			}
+
+			// Producer side: free cells from tail, the real head is only read when the cached one says too few
+			size_t freeCells(size_t tail, size_t wanted)
+			{
+				size_t room = this->_mask + 1 - (tail - this->_cachedHead);
+
+				if (room < wanted)
+				{
+					this->_cachedHead = __atomic_load_n(&this->_head, __ATOMIC_ACQUIRE);
+					room = this->_mask + 1 - (tail - this->_cachedHead);
+				}
+				return (room);
+			}
+
+			// Consumer side: same with the values from head
+			size_t fullCells(size_t head, size_t wanted)
+			{
+				size_t available = this->_cachedTail - head;
+
+				if (available < wanted)
+				{
+					this->_cachedTail = __atomic_load_n(&this->_tail, __ATOMIC_ACQUIRE);
+					available = this->_cachedTail - head;
+				}
+				return (available);
+			}
+
+			// Cells from index to the end of the buffer, at most n
+			size_t contiguous(size_t index, size_t n) const
+			{
+				const size_t toEnd = this->_mask + 1 - (index & this->_mask);
+				return ((n < toEnd) ? n : toEnd);
+			}
+
+		public:
+			// capacity is rounded up to a power of 2
+			explicit spsc_ring(size_type capacity, const allocator_type& alloc = allocator_type())
+			: _buffer(NULL), _mask(roundCapacity(capacity) - 1), _alloc(alloc), _tail(0), _cachedHead(0), _head(0), _cachedTail(0)
+			{
+				this->_buffer = this->_alloc.allocate(this->_mask + 1);
+			}
+
+			// Not thread safe, nobody may be using the ring anymore
+			~spsc_ring()
+			{
+				for (size_t index = this->_head; index != this->_tail; ++index)
+					this->_alloc.destroy(this->_buffer + (index & this->_mask));
+				this->_alloc.deallocate(this->_buffer, this->_mask + 1);
+			}
+
+			size_type capacity() const { return (this->_mask + 1); }
+
+			// Exact for the calling side when the other one isn't working, a hint otherwise
+			size_type size_approx() const
+			{
+				const size_t head = __atomic_load_n(&this->_head, __ATOMIC_ACQUIRE);
+				return (__atomic_load_n(&this->_tail, __ATOMIC_ACQUIRE) - head);
+			}
+
+			allocator_type get_allocator() const { return (this->_alloc); }
+
+			/***************** Producer *****************/
+
+			// False if full
+			bool try_push(const value_type& val)
+			{
+				const size_t tail = this->_tail;
+
+				if (this->freeCells(tail, 1) == 0)
+					return (false);
+				this->_alloc.construct(this->_buffer + (tail & this->_mask), val);
+				__atomic_store_n(&this->_tail, tail + 1, __ATOMIC_RELEASE);
+				return (true);
+			}
+
+			/* Pushes as many of the n values from first as fit, returns how many. Each contiguous piece
+			   is published once copied, if a copy throws the values of the previous piece stay pushed */
+			template <class ForwardIterator>
+			size_type push_n(ForwardIterator first, size_type n)
+			{
+				const size_t tail = this->_tail;
+				const size_t count = std::min(n, this->freeCells(tail, n));
+				size_t done = 0;
+
+				while (done < count)
+				{
+					const size_t piece = this->contiguous(tail + done, count - done);
+					ForwardIterator last = first;
+
+					ft::advance(last, piece);
+					ft::uninitialized_copy(first, last, this->_buffer + ((tail + done) & this->_mask));
+					first = last;
+					done += piece;
+					__atomic_store_n(&this->_tail, tail + done, __ATOMIC_RELEASE);
+				}
+				return (count);
+			}
+
+			/* Free contiguous cells where values can be built in place (raw memory: placement new, or
+			   plain writes for trivially copyable types), then commit_write(n) publishes the first n.
+			   Returns how many there are, first points to them. Less than the free cells when they wrap,
+			   or when the cached head is enough to find some */
+			size_type write_span(pointer& first)
+			{
+				const size_t tail = this->_tail;
+
+				first = this->_buffer + (tail & this->_mask);
+				return (this->contiguous(tail, this->freeCells(tail, 1)));
+			}
+
+			// n cells of the last write_span are built, the consumer can have them
+			void commit_write(size_type n)
+			{
+				__atomic_store_n(&this->_tail, this->_tail + n, __ATOMIC_RELEASE);
+			}
+
+			/***************** Consumer *****************/
+
+			// False if empty
+			bool try_pop(value_type& val)
+			{
+				const size_t head = this->_head;
+
+				if (this->fullCells(head, 1) == 0)
+					return (false);
+
+				pointer cell = this->_buffer + (head & this->_mask);
+				val = *cell;
+				this->_alloc.destroy(cell);
+				__atomic_store_n(&this->_head, head + 1, __ATOMIC_RELEASE);
+				return (true);
+			}
+
+			// Pops up to n values into out, returns how many
+			template <class OutputIterator>
+			size_type pop_n(OutputIterator out, size_type n)
+			{
+				const size_t head = this->_head;
+				const size_t count = std::min(n, this->fullCells(head, n));
+				size_t done = 0;
+
+				while (done < count)
+				{
+					const size_t piece = this->contiguous(head + done, count - done);
+					pointer first = this->_buffer + ((head + done) & this->_mask);
+
+					out = ft::copy(first, first + piece, out);
+					ft::destroy(first, first + piece);
+					done += piece;
+					__atomic_store_n(&this->_head, head + done, __ATOMIC_RELEASE);
+				}
+				return (count);
+			}
+
+			// Contiguous values ready to be read in place, first points to them
+			size_type read_span(const_pointer& first)
+			{
+				const size_t head = this->_head;
+
+				first = this->_buffer + (head & this->_mask);
+				return (this->contiguous(head, this->fullCells(head, 1)));
+			}
+
+			// Done with the first n values of the last read_span, they are destroyed and their cells freed
+			void commit_read(size_type n)
+			{
+				const size_t head = this->_head;
+				pointer first = this->_buffer + (head & this->_mask);
+
+				ft::destroy(first, first + n);
+				__atomic_store_n(&this->_head, head + n, __ATOMIC_RELEASE);
+			}
+	};
+
+}
+
+#endif
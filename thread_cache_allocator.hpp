@@ -0,0 +1,303 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:37 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef THREAD_CACHE_ALLOCATOR_HPP
+# define THREAD_CACHE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <pthread.h>
+
+/* Size classes: blocks of 16, 32, ... THREAD_CACHE_MAX_SIZE bytes, bigger ones go to operator new */
+#define THREAD_CACHE_ALIGNMENT 16
+#define THREAD_CACHE_MAX_SIZE 512
+#define THREAD_CACHE_CLASSES (THREAD_CACHE_MAX_SIZE / THREAD_CACHE_ALIGNMENT)
+
+/* Blocks moving at once between a thread and the central pool, and free blocks of a class a
+   thread keeps before giving a batch back */
+#define THREAD_CACHE_BATCH 64
+#define THREAD_CACHE_MAX_FREE (THREAD_CACHE_BATCH * 2)
+
+namespace ft
+{
+	/*******************************************************
+	 *                     Thread cache                    *
+	 *******************************************************/
+
+	/*
+		Front-end of the node allocations: each thread allocates from and frees to free lists of
+		its own, one per size class, without any lock. They trade whole batches with a central pool
+		(a list of batches per class, behind a mutex of its own): a thread with no free block of a
+		class takes a batch (or carves a new one out of operator new), a thread with too many gives
+		THREAD_CACHE_BATCH of them back. So the mutex is taken once per batch, and the memory a
+		thread freed (even blocks allocated by another one) ends up reused by the others.
+
+		A thread exiting gives back everything it had. Memory is never returned to the system,
+		blocks are only reused: fit for nodes of containers which grow and shrink, not for a
+		single huge peak.
+	*/
+	class thread_cache
+	{
+		private:
+			struct local_lists
+			{
+				void*	head[THREAD_CACHE_CLASSES];
+				size_t	count[THREAD_CACHE_CLASSES];
+				bool	registered;
+			};
+
+			// A batch of the central pool: a chain of free blocks, linked to the next batch by its head
+			struct central_lists
+			{
+				pthread_mutex_t	mutex[THREAD_CACHE_CLASSES];
+				void*			batches[THREAD_CACHE_CLASSES];
+			};
+
+			/* A free block is raw memory: its first bytes hold the next free block,
+			   the next ones (at the head of a central batch) the next batch */
+			static void* link(void* block, size_t index)
+			{
+				void* next;
+				std::memcpy(&next, static_cast<char*>(block) + index * sizeof(void*), sizeof(next));
+				return (next);
+			}
+
+			static void setLink(void* block, size_t index, void* next)
+			{ std::memcpy(static_cast<char*>(block) + index * sizeof(void*), &next, sizeof(next)); }
+
+			static central_lists& centralStorage()
+			{
+				static central_lists lists;
+				return (lists);
+			}
+
+			static central_lists& central()
+			{
+				static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+				pthread_once(&once, &thread_cache::initCentral);
+				return (centralStorage());
+			}
+
+			static void initCentral()
+			{
+				central_lists& lists = centralStorage();
+
+				for (size_t i = 0; i < THREAD_CACHE_CLASSES; ++i)
+				{
+					pthread_mutex_init(&lists.mutex[i], NULL);
+					lists.batches[i] = NULL;
+				}
+			}
+
+			static local_lists& local()
+			{
+				static __thread local_lists lists;
+
+				if (!lists.registered)
+				{
+					static pthread_once_t once = PTHREAD_ONCE_INIT;
+					pthread_once(&once, &thread_cache::makeExitKey);
+					pthread_setspecific(exitKey(), &lists);
+					lists.registered = true;
+				}
+				return (lists);
+			}
+
+			static pthread_key_t& exitKey()
+			{
+				static pthread_key_t key;
+				return (key);
+			}
+
+			static void makeExitKey() { pthread_key_create(&exitKey(), &thread_cache::flush); }
+
+			// Thread exiting: its free lists go to the central pool, a batch each
+			static void flush(void* arg)
+			{
+				local_lists& lists = *static_cast<local_lists*>(arg);
+
+				for (size_t i = 0; i < THREAD_CACHE_CLASSES; ++i)
+				{
+					if (lists.head[i] != NULL)
+						giveBatch(i, lists.head[i]);
+					lists.head[i] = NULL;
+					lists.count[i] = 0;
+				}
+				lists.registered = false;
+			}
+
+			static void giveBatch(size_t sizeClass, void* batch)
+			{
+				central_lists& lists = central();
+
+				pthread_mutex_lock(&lists.mutex[sizeClass]);
+				setLink(batch, 1, lists.batches[sizeClass]);
+				lists.batches[sizeClass] = batch;
+				pthread_mutex_unlock(&lists.mutex[sizeClass]);
+			}
+
+			static void* takeBatch(size_t sizeClass)
+			{
+				central_lists& lists = central();
+
+				pthread_mutex_lock(&lists.mutex[sizeClass]);
+				void* batch = lists.batches[sizeClass];
+				if (batch != NULL)
+					lists.batches[sizeClass] = link(batch, 1);
+				pthread_mutex_unlock(&lists.mutex[sizeClass]);
+				return (batch);
+			}
+
+			// Fills an empty free list, from the central pool or else from new memory
+			static void refill(local_lists& lists, size_t sizeClass)
+			{
+				void* batch = takeBatch(sizeClass);
+
+				if (batch != NULL)
+				{
+					size_t n = 0;
+					for (void* block = batch; block != NULL; block = link(block, 0))
+						++n;
+					lists.head[sizeClass] = batch;
+					lists.count[sizeClass] = n;
+					return ;
+				}
+
+				const size_t size = (sizeClass + 1) * THREAD_CACHE_ALIGNMENT;
+				char* chunk = static_cast<char*>(::operator new(size * THREAD_CACHE_BATCH));
+				void* next = NULL;
+
+				for (size_t i = THREAD_CACHE_BATCH; i-- > 0;)
+				{
+					setLink(chunk + i * size, 0, next);
+					next = chunk + i * size;
+				}
+				lists.head[sizeClass] = chunk;
+				lists.count[sizeClass] = THREAD_CACHE_BATCH;
+			}
+
+			// Cuts THREAD_CACHE_BATCH blocks off the front of a too long free list
+			static void release(local_lists& lists, size_t sizeClass)
+			{
+				void* batch = lists.head[sizeClass];
+				void* last = batch;
+
+				for (size_t i = 1; i < THREAD_CACHE_BATCH; ++i)
+					last = link(last, 0);
+				lists.head[sizeClass] = link(last, 0);
+				lists.count[sizeClass] -= THREAD_CACHE_BATCH;
+				setLink(last, 0, NULL);
+				giveBatch(sizeClass, batch);
+			}
+
+			static size_t sizeClass(size_t bytes) { return ((bytes + THREAD_CACHE_ALIGNMENT - 1) / THREAD_CACHE_ALIGNMENT - 1); }
+
+		public:
+			// Whether blocks of bytes, aligned on alignment, come from the size classes
+			static bool cached(size_t bytes, size_t alignment)
+			{ return (bytes != 0 && bytes <= THREAD_CACHE_MAX_SIZE && alignment <= THREAD_CACHE_ALIGNMENT); }
+
+			static void* allocate(size_t bytes, size_t alignment)
+			{
+				if (!cached(bytes, alignment))
+					return (::operator new(bytes));
+
+				local_lists& lists = local();
+				const size_t index = sizeClass(bytes);
+
+				if (lists.head[index] == NULL)
+					refill(lists, index);
+
+				void* block = lists.head[index];
+				lists.head[index] = link(block, 0);
+				--lists.count[index];
+				return (block);
+			}
+
+			// bytes and alignment must be the ones the block was allocated with
+			static void deallocate(void* block, size_t bytes, size_t alignment)
+			{
+				if (!cached(bytes, alignment))
+				{
+					::operator delete(block);
+					return ;
+				}
+
+				local_lists& lists = local();
+				const size_t index = sizeClass(bytes);
+
+				setLink(block, 0, lists.head[index]);
+				lists.head[index] = block;
+				if (++lists.count[index] > THREAD_CACHE_MAX_FREE)
+					release(lists, index);
+			}
+	};
+
+	/*******************************************************
+	 *                Thread caching allocator             *
+	 *******************************************************/
+
+	/* Allocator of the thread_cache, for the containers allocating one node at a time, eg.
+	   ft::map<Key, T, Compare, ft::thread_cache_allocator<ft::pair<const Key, T> > >.
+	   Stateless: any two compare equal, memory allocated by one is freed by any other */
+	template <class T>
+	class thread_cache_allocator
+	{
+		public:
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef const T*	const_pointer;
+			typedef T&			reference;
+			typedef const T&	const_reference;
+			typedef size_t		size_type;
+			typedef ptrdiff_t	difference_type;
+
+			template <class U>
+			struct rebind { typedef thread_cache_allocator<U> other; };
+
+			thread_cache_allocator() { }
+			thread_cache_allocator(const thread_cache_allocator&) { }
+			template <class U>
+			thread_cache_allocator(const thread_cache_allocator<U>&) { }
+			~thread_cache_allocator() { }
+
+			pointer address(reference x) const { return (&x); }
+			const_pointer address(const_reference x) const { return (&x); }
+
+			pointer allocate(size_type n, const void* hint = 0)
+			{
+				(void)hint;
+				if (n > this->max_size())
+					throw std::bad_alloc();
+				return (static_cast<pointer>(ft::thread_cache::allocate(n * sizeof(T), __alignof__(T))));
+			}
+
+			void deallocate(pointer p, size_type n) { ft::thread_cache::deallocate(p, n * sizeof(T), __alignof__(T)); }
+
+			size_type max_size() const { return (std::numeric_limits<size_type>::max() / sizeof(T)); }
+
+			void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) T(val); }
+			void destroy(pointer p) { p->~T(); }
+	};
+
+	template <class T, class U>
+	bool operator==(const thread_cache_allocator<T>&, const thread_cache_allocator<U>&) { return (true); }
+
+	template <class T, class U>
+	bool operator!=(const thread_cache_allocator<T>&, const thread_cache_allocator<U>&) { return (false); }
+
+}
+
+#endif
@@ -0,0 +1,546 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 05:01 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef THREAD_POOL_HPP
+# define THREAD_POOL_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+/* Tasks a worker can hold before it runs the next ones itself instead of sharing them (power of 2) */
+#define THREAD_POOL_DEQUE_SIZE 4096
+
+/* Tasks pushed by threads which aren't workers (the ones calling parallel_for) */
+#define THREAD_POOL_INJECTION_SIZE 4096
+
+/* Failed looks for work before yielding, then before going to sleep */
+#define THREAD_POOL_SPINS 64
+
+/* Keeps the counters written by different threads on different cache lines */
+#define FT_CACHE_LINE_SIZE 64
+
+namespace ft
+{
+	// Tells the CPU we are busy waiting (lets the other hyperthread run, saves power)
+	inline void cpu_relax()
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#endif
+	}
+
+	/*******************************************************
+	 *                   Number of threads                 *
+	 *******************************************************/
+
+	// Set by set_parallel_concurrency, 0 if it wasn't
+	inline size_t& parallel_concurrency_setting()
+	{
+		static size_t threads = 0;
+		return (threads);
+	}
+
+	// FT_NUM_THREADS environment variable, 0 if unset or invalid
+	inline size_t parallel_env_concurrency()
+	{
+		static const char* env = std::getenv("FT_NUM_THREADS");
+		static const long threads = (env != NULL) ? std::strtol(env, NULL, 10) : 0;
+
+		return ((threads > 0) ? static_cast<size_t>(threads) : 0);
+	}
+
+	/* Number of threads the parallel algorithms use, the calling one included:
+	   set_parallel_concurrency() if called, else FT_NUM_THREADS, else the online CPUs */
+	inline size_t parallel_concurrency()
+	{
+		static const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		if (ft::parallel_concurrency_setting() != 0)
+			return (ft::parallel_concurrency_setting());
+		if (ft::parallel_env_concurrency() != 0)
+			return (ft::parallel_env_concurrency());
+		return ((cpus > 0) ? static_cast<size_t>(cpus) : 1);
+	}
+
+	/*******************************************************
+	 *                    Jobs and tasks                   *
+	 *******************************************************/
+
+	/* A parallel_for call: [first, last) cut in chunks of grain indexes. It lives on the stack
+	   of the calling thread, which waits for remaining to drop to 0 before returning */
+	struct pool_job
+	{
+		size_t	first;
+		size_t	last;
+		size_t	grain;
+		size_t	remaining;
+		void	(*runChunk)(pool_job* job, size_t begin, size_t end);
+	};
+
+	template <class Function>
+	struct pool_function_job : public pool_job
+	{
+		Function* fn;
+
+		static void run(pool_job* job, size_t begin, size_t end)
+		{ (*static_cast<pool_function_job*>(job)->fn)(begin, end); }
+	};
+
+	// Chunks [begin, end) of a job
+	struct pool_task
+	{
+		pool_job*	job;
+		size_t		begin;
+		size_t		end;
+	};
+
+	/*******************************************************
+	 *                  Work stealing deque                *
+	 *******************************************************/
+
+	/* Chase-Lev deque with a fixed size: the worker owning it pushes and pops at the bottom
+	   (last split first, its data is still in cache), the others steal at the top (the biggest
+	   ranges, split first). Only the last element needs the owner and a thief to agree, with a
+	   compare and swap on top. Tasks are read field by field with atomic loads, a thief may read
+	   a slot being rewritten, its compare and swap then fails and the read is thrown away */
+	class work_deque
+	{
+		private:
+			long		_top;
+			char		_topPad[FT_CACHE_LINE_SIZE - sizeof(long)];
+			long		_bottom;
+			char		_bottomPad[FT_CACHE_LINE_SIZE - sizeof(long)];
+			pool_task	_tasks[THREAD_POOL_DEQUE_SIZE];
+
+			void store(long index, const pool_task& task)
+			{
+				pool_task& slot = this->_tasks[index & (THREAD_POOL_DEQUE_SIZE - 1)];
+
+				__atomic_store_n(&slot.job, task.job, __ATOMIC_RELAXED);
+				__atomic_store_n(&slot.begin, task.begin, __ATOMIC_RELAXED);
+				__atomic_store_n(&slot.end, task.end, __ATOMIC_RELAXED);
+			}
+
+			void load(long index, pool_task& task)
+			{
+				pool_task& slot = this->_tasks[index & (THREAD_POOL_DEQUE_SIZE - 1)];
+
+				task.job = __atomic_load_n(&slot.job, __ATOMIC_RELAXED);
+				task.begin = __atomic_load_n(&slot.begin, __ATOMIC_RELAXED);
+				task.end = __atomic_load_n(&slot.end, __ATOMIC_RELAXED);
+			}
+
+		public:
+			work_deque() : _top(0), _bottom(0) { }
+
+			// Owner only, false if full
+			bool push(const pool_task& task)
+			{
+				const long bottom = __atomic_load_n(&this->_bottom, __ATOMIC_RELAXED);
+				const long top = __atomic_load_n(&this->_top, __ATOMIC_ACQUIRE);
+
+				if (bottom - top >= THREAD_POOL_DEQUE_SIZE)
+					return (false);
+				this->store(bottom, task);
+				__atomic_store_n(&this->_bottom, bottom + 1, __ATOMIC_RELEASE);
+				return (true);
+			}
+
+			// Owner only
+			bool pop(pool_task& task)
+			{
+				const long bottom = __atomic_load_n(&this->_bottom, __ATOMIC_RELAXED) - 1;
+
+				__atomic_store_n(&this->_bottom, bottom, __ATOMIC_RELAXED);
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);
+				long top = __atomic_load_n(&this->_top, __ATOMIC_RELAXED);
+
+				if (bottom < top) // Was empty
+				{
+					__atomic_store_n(&this->_bottom, bottom + 1, __ATOMIC_RELAXED);
+					return (false);
+				}
+				this->load(bottom, task);
+				if (bottom > top)
+					return (true);
+
+				// Last one, a thief may be taking it too
+				const bool won = __atomic_compare_exchange_n(&this->_top, &top, top + 1, false,
+															 __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+				__atomic_store_n(&this->_bottom, bottom + 1, __ATOMIC_RELAXED);
+				return (won);
+			}
+
+			// Any thread
+			bool steal(pool_task& task)
+			{
+				long top = __atomic_load_n(&this->_top, __ATOMIC_ACQUIRE);
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);
+				const long bottom = __atomic_load_n(&this->_bottom, __ATOMIC_ACQUIRE);
+
+				if (bottom <= top)
+					return (false);
+				this->load(top, task);
+				return (__atomic_compare_exchange_n(&this->_top, &top, top + 1, false,
+													__ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+			}
+	};
+
+	/*******************************************************
+	 *                      thread_pool                    *
+	 *******************************************************/
+
+	/*
+		Fixed number of workers, each with its own deque. parallel_for cuts its range in two,
+		pushes the right half and goes on with the left one until a single chunk is left: the
+		halves are stolen by idle workers, who split them again. The calling thread works too
+		while it waits, so a pool of n threads has n - 1 workers.
+		Idle workers spin a little, then yield, then sleep until something is pushed.
+
+		Every parallel ft algorithm goes through the shared pool (see shared()), sized by
+		parallel_concurrency(). Other pools can be created, they don't share their workers.
+	*/
+	class thread_pool
+	{
+		private:
+			struct worker
+			{
+				work_deque		deque;
+				thread_pool*	pool;
+				pthread_t		thread;
+				size_t			index;
+			};
+
+			worker*			_workers;
+			size_t			_size;
+
+			pthread_mutex_t	_injectionMutex;
+			pool_task		_injected[THREAD_POOL_INJECTION_SIZE];
+			size_t			_injectedHead;
+			size_t			_injectedCount;
+
+			// Sleeping workers, and tasks pushed and not taken yet: someone pushing wakes someone up
+			pthread_mutex_t	_sleepMutex;
+			pthread_cond_t	_wakeUp;
+			size_t			_sleepers;
+			size_t			_queued;
+			bool			_stop;
+
+			// Not copyable
+			thread_pool(const thread_pool&);
+			thread_pool& operator=(const thread_pool&);
+
+			// Worker the current thread is, NULL if it's not one (of any pool)
+			static worker*& currentWorker()
+			{
+				static __thread worker* current = NULL;
+				return (current);
+			}
+
+			worker* ownWorker() const
+			{
+				worker* current = currentWorker();
+				return ((current != NULL && current->pool == this) ? current : NULL);
+			}
+
+			/***************** Queues *****************/
+
+			bool push(const pool_task& task)
+			{
+				worker* self = this->ownWorker();
+				bool pushed;
+
+				__atomic_add_fetch(&this->_queued, 1, __ATOMIC_SEQ_CST);
+				if (self != NULL)
+					pushed = self->deque.push(task);
+				else
+				{
+					pthread_mutex_lock(&this->_injectionMutex);
+					pushed = (this->_injectedCount < THREAD_POOL_INJECTION_SIZE);
+					if (pushed)
+					{
+						this->_injected[(this->_injectedHead + this->_injectedCount) % THREAD_POOL_INJECTION_SIZE] = task;
+						__atomic_store_n(&this->_injectedCount, this->_injectedCount + 1, __ATOMIC_RELAXED);
+					}
+					pthread_mutex_unlock(&this->_injectionMutex);
+				}
+
+				if (!pushed)
+					__atomic_sub_fetch(&this->_queued, 1, __ATOMIC_RELAXED);
+				else if (__atomic_load_n(&this->_sleepers, __ATOMIC_SEQ_CST) != 0)
+				{
+					pthread_mutex_lock(&this->_sleepMutex);
+					pthread_cond_signal(&this->_wakeUp);
+					pthread_mutex_unlock(&this->_sleepMutex);
+				}
+				return (pushed);
+			}
+
+			// The count is read without the lock first, most of the time there is nothing
+			bool popInjected(pool_task& task)
+			{
+				if (__atomic_load_n(&this->_injectedCount, __ATOMIC_RELAXED) == 0)
+					return (false);
+
+				pthread_mutex_lock(&this->_injectionMutex);
+				const bool found = (this->_injectedCount != 0);
+				if (found)
+				{
+					task = this->_injected[this->_injectedHead];
+					this->_injectedHead = (this->_injectedHead + 1) % THREAD_POOL_INJECTION_SIZE;
+					__atomic_store_n(&this->_injectedCount, this->_injectedCount - 1, __ATOMIC_RELAXED);
+				}
+				pthread_mutex_unlock(&this->_injectionMutex);
+				return (found);
+			}
+
+			// Own deque first, then what other threads pushed, then steal, starting at a different worker each time
+			bool findTask(pool_task& task)
+			{
+				worker* self = this->ownWorker();
+				bool found = (self != NULL && self->deque.pop(task)) || this->popInjected(task);
+
+				if (!found && this->_size != 0)
+				{
+					static __thread size_t seed = 0;
+					const size_t start = (seed = seed * 1103515245 + 12345) % this->_size;
+
+					for (size_t i = 0; i < this->_size && !found; ++i)
+					{
+						worker& victim = this->_workers[(start + i) % this->_size];
+						if (&victim != self)
+							found = victim.deque.steal(task);
+					}
+				}
+				if (found)
+					__atomic_sub_fetch(&this->_queued, 1, __ATOMIC_RELAXED);
+				return (found);
+			}
+
+			/***************** Running *****************/
+
+			// Halves are given away while there is more than one chunk, the rest is run here
+			void runRange(pool_task task)
+			{
+				pool_job* job = task.job;
+
+				while (task.end - task.begin > 1)
+				{
+					pool_task half = task;
+					half.begin = task.begin + (task.end - task.begin) / 2;
+					if (!this->push(half))
+						break;
+					task.end = half.begin;
+				}
+
+				const size_t done = task.end - task.begin;
+				for (size_t chunk = task.begin; chunk < task.end; ++chunk)
+				{
+					const size_t begin = job->first + chunk * job->grain;
+					job->runChunk(job, begin, (job->last - begin > job->grain) ? begin + job->grain : job->last);
+				}
+				__atomic_sub_fetch(&job->remaining, done, __ATOMIC_RELEASE);
+			}
+
+			// Helps with anything (this job or another one) until the job is done
+			void wait(pool_job& job)
+			{
+				size_t idle = 0;
+				pool_task task;
+
+				while (__atomic_load_n(&job.remaining, __ATOMIC_ACQUIRE) != 0)
+				{
+					if (this->findTask(task))
+					{
+						this->runRange(task);
+						idle = 0;
+					}
+					else if (++idle < THREAD_POOL_SPINS)
+						ft::cpu_relax();
+					else
+						sched_yield();
+				}
+			}
+
+			void sleep()
+			{
+				pthread_mutex_lock(&this->_sleepMutex);
+				__atomic_add_fetch(&this->_sleepers, 1, __ATOMIC_SEQ_CST);
+				while (!this->_stop && __atomic_load_n(&this->_queued, __ATOMIC_SEQ_CST) == 0)
+					pthread_cond_wait(&this->_wakeUp, &this->_sleepMutex);
+				__atomic_sub_fetch(&this->_sleepers, 1, __ATOMIC_SEQ_CST);
+				pthread_mutex_unlock(&this->_sleepMutex);
+			}
+
+			static void* workerMain(void* arg)
+			{
+				worker* self = static_cast<worker*>(arg);
+				thread_pool* pool = self->pool;
+				size_t idle = 0;
+				pool_task task;
+
+				currentWorker() = self;
+				while (!__atomic_load_n(&pool->_stop, __ATOMIC_ACQUIRE))
+				{
+					if (pool->findTask(task))
+					{
+						pool->runRange(task);
+						idle = 0;
+					}
+					else if (++idle < THREAD_POOL_SPINS)
+						ft::cpu_relax();
+					else if (idle < THREAD_POOL_SPINS * 2)
+						sched_yield();
+					else
+					{
+						pool->sleep();
+						idle = 0;
+					}
+				}
+				return (NULL);
+			}
+
+			static thread_pool*& sharedPointer()
+			{
+				static thread_pool* pool = NULL;
+				return (pool);
+			}
+
+			static pthread_mutex_t& sharedMutex()
+			{
+				static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+				return (mutex);
+			}
+
+		public:
+			/* threads is the number of threads working on a parallel_for, the calling one included.
+			   If some workers can't be started, the pool just has less of them */
+			explicit thread_pool(size_t threads)
+			: _workers(NULL), _size(0), _injectedHead(0), _injectedCount(0), _sleepers(0), _queued(0), _stop(false)
+			{
+				pthread_mutex_init(&this->_injectionMutex, NULL);
+				pthread_mutex_init(&this->_sleepMutex, NULL);
+				pthread_cond_init(&this->_wakeUp, NULL);
+				if (threads <= 1)
+					return;
+
+				// Workers are never copied (the deques are big and threads point to them): raw memory
+				this->_workers = static_cast<worker*>(::operator new(sizeof(worker) * (threads - 1)));
+				for (size_t i = 0; i < threads - 1; ++i)
+				{
+					worker* w = new (&this->_workers[i]) worker();
+					w->pool = this;
+					w->index = i;
+				}
+				// _size is read by the workers when stealing, it's set before any is started
+				this->_size = threads - 1;
+				for (size_t i = 0; i < threads - 1; ++i)
+				{
+					if (pthread_create(&this->_workers[i].thread, NULL, &thread_pool::workerMain, &this->_workers[i]) != 0)
+					{
+						this->_size = i;
+						break;
+					}
+				}
+			}
+
+			~thread_pool()
+			{
+				pthread_mutex_lock(&this->_sleepMutex);
+				__atomic_store_n(&this->_stop, true, __ATOMIC_RELEASE);
+				pthread_cond_broadcast(&this->_wakeUp);
+				pthread_mutex_unlock(&this->_sleepMutex);
+
+				for (size_t i = 0; i < this->_size; ++i)
+					pthread_join(this->_workers[i].thread, NULL);
+				::operator delete(this->_workers);
+				pthread_cond_destroy(&this->_wakeUp);
+				pthread_mutex_destroy(&this->_sleepMutex);
+				pthread_mutex_destroy(&this->_injectionMutex);
+			}
+
+			// Threads working on a parallel_for, the calling one included
+			size_t concurrency() const { return (this->_size + 1); }
+
+			/* Calls fn(begin, end) on every chunk of grain indexes of [first, last), in any order and
+			   from any thread, and returns when all are done. Chunks start at first + k * grain, which
+			   lets fn know which chunk it has. fn must not throw, there is no way to carry it back.
+			   Can be called from inside fn (nested parallel_for), the thread then helps instead of waiting */
+			template <class Function>
+			void parallel_for(size_t first, size_t last, size_t grain, Function fn)
+			{
+				if (first >= last)
+					return;
+				if (grain == 0)
+					grain = 1;
+
+				pool_function_job<Function> job;
+				pool_task task;
+
+				job.first = first;
+				job.last = last;
+				job.grain = grain;
+				job.remaining = (last - first - 1) / grain + 1;
+				job.runChunk = &pool_function_job<Function>::run;
+				job.fn = &fn;
+				task.job = &job;
+				task.begin = 0;
+				task.end = job.remaining;
+
+				this->runRange(task);
+				this->wait(job);
+			}
+
+			// Pool used by the ft parallel algorithms, started on first use with parallel_concurrency() threads
+			static thread_pool& shared()
+			{
+				thread_pool* pool = __atomic_load_n(&sharedPointer(), __ATOMIC_ACQUIRE);
+
+				if (pool != NULL)
+					return (*pool);
+
+				pthread_mutex_lock(&sharedMutex());
+				pool = sharedPointer();
+				if (pool == NULL)
+				{
+					pool = new thread_pool(ft::parallel_concurrency());
+					__atomic_store_n(&sharedPointer(), pool, __ATOMIC_RELEASE);
+				}
+				pthread_mutex_unlock(&sharedMutex());
+				return (*pool);
+			}
+
+			// Stops the shared pool, the next parallel algorithm starts a new one
+			static void resetShared()
+			{
+				pthread_mutex_lock(&sharedMutex());
+				delete sharedPointer();
+				__atomic_store_n(&sharedPointer(), static_cast<thread_pool*>(NULL), __ATOMIC_RELEASE);
+				pthread_mutex_unlock(&sharedMutex());
+			}
+	};
+
+	/* Sets the number of threads of the parallel algorithms (0 goes back to FT_NUM_THREADS / online CPUs).
+	   The shared pool is restarted with that many: not to be called while a parallel algorithm runs */
+	inline void set_parallel_concurrency(size_t threads)
+	{
+		ft::parallel_concurrency_setting() = threads;
+		ft::thread_pool::resetShared();
+	}
+
+}
+
+#endif
@@ -0,0 +1,31 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:36 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TYPE_TRAITS_HPP
+# define TYPE_TRAITS_HPP
+
+#include "is_integral.hpp"
+
+namespace ft
+{
+	/* Can be copied with memcpy and needs no destructor call (ints, pointers, PODs...).
+	   There is no way to know it in pure C++98, but every compiler since gcc 5 / clang 3
+	   has the builtin, even in C++98 mode */
+	template <class T>
+	struct is_trivially_copyable
+	{
+		static const bool value = __is_trivially_copyable(T);
+	};
+
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
 /*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
 /*   Created: 14-03-2022  by  `-'                        `-'                  */
-/*   Updated: 18-03-2022 11:38 by                                             */
+/*   Updated: 18-10-2026 04:56 by                                             */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -40,6 +40,40 @@ namespace ft
 	template<class T>
 	struct is_same<T, T> { static const bool value = true; };
 
+
+	// Strips the const qualifier, eg. the key of a map value_type
+	template <class T>
+	struct remove_const { typedef T type; };
+
+	template <class T>
+	struct remove_const<const T> { typedef T type; };
+
+	// Type a reference refers to, eg. the value of an iterator returning references
+	template <class T>
+	struct remove_reference { typedef T type; };
+
+	template <class T>
+	struct remove_reference<T&> { typedef T type; };
+
+
+	// Key extractors, like the ones std::unary_function based code expects (result_type is the key)
+	template <class T>
+	struct identity
+	{
+		typedef T result_type;
+
+		const T& operator()(const T& x) const { return (x); }
+	};
+
+	// Works on any pair-like type (ft::pair, map value_type...)
+	template <class Pair>
+	struct select_first
+	{
+		typedef typename ft::remove_const<typename Pair::first_type>::type result_type;
+
+		const result_type& operator()(const Pair& x) const { return (x.first); }
+	};
+
 }
 
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
 /*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
 /*   Created: 28-02-2022  by  `-'                        `-'                  */
-/*   Updated: 17-03-2022 13:54 by                                             */
+/*   Updated: 18-10-2026 06:03 by                                             */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,10 +17,24 @@
 #include "enable_if.hpp"
 #include "comparisons.hpp"
 #include "VectorIterator.hpp"
+#include "algorithm.hpp"
+#include "memory.hpp"
+#include "parallel_for.hpp"
+#include "type_traits.hpp"
 
 #include <memory>
 #include <stdexcept>
 #include <limits>
+#include <istream>
+#include <string>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Largest single read() of append_from_fd / append_from_stream */
+#define VECTOR_READ_CHUNK ((size_t)8 << 20)
 
 namespace ft
 {	// > > instead of >> because otherwise C++ might think it's a bitshift
@@ -54,18 +68,6 @@ namespace ft
 			size_type		_capacity;
 			allocator_type	_alloc;
 
-			/* Like std::distance but worse.
-			   Actual point is because the std version does not work with ft::<any_iterator>_tag */
-			template <class InputIterator>
-			typename ft::iterator_traits<InputIterator>::difference_type
-			distance(InputIterator first, InputIterator last)
-			{
-				size_type i = 0;
-				while (first++ != last)
-					++i;
-				return (i);
-			}
-
 			// Move elements distance away (to the right) starting at index (included), DOES NOT modify size
 			// Vector = 1, 2, 3, 4, 5 moveElementsRight(2, 5) => 1, 2, -, -, -, -, -, 3, 4, 5 
 			void moveElementsRight(size_type index, size_type distance)
@@ -83,6 +85,13 @@ namespace ft
 				if (this->_size == 0 || distance == 0)
 					return ;
 
+				// Trivially copyable elements don't need construct / destroy, just move the bytes
+				if (ft::is_trivially_copyable<value_type>::value)
+				{
+					ft::copy_backward(this->_ptr + index, this->_ptr + this->_size, this->_ptr + this->_size + distance);
+					return ;
+				}
+
 				for (size_type i = this->_size - 1; i >= index; --i)
 				{
 					this->_alloc.construct(this->_ptr + i + distance, this->_ptr[i]); // Copy the value distance slots away
@@ -103,6 +112,13 @@ namespace ft
 				if (this->_size == 0 || distance == 0)
 					return ;
 
+				if (ft::is_trivially_copyable<value_type>::value)
+				{
+					if (index + distance < this->_size)
+						ft::copy(this->_ptr + index + distance, this->_ptr + this->_size, this->_ptr + index);
+					return ;
+				}
+
 				for (size_type i = index; i + distance < this->_size; ++i)
 				{
 					this->_alloc.construct(this->_ptr + i, this->_ptr[i + distance]); // Copy the value from distance slots away
@@ -111,6 +127,92 @@ namespace ft
 				}
 			}
 
+			// Each thread constructs (and so first touches the pages of) its own part of the buffer
+			struct ParallelFill
+			{
+				pointer				ptr;
+				const value_type*	val;
+
+				void operator()(size_t begin, size_t end) { ft::uninitialized_fill_n(this->ptr + begin, end - begin, *this->val); }
+			};
+
+
+			/* Sources of appendBytes, both return the bytes read, 0 at the end */
+			struct FdSource
+			{
+				int	fd;
+
+				size_type operator()(char* dest, size_type n) const
+				{
+					ssize_t got;
+
+					while ((got = ::read(this->fd, dest, n)) < 0 && errno == EINTR)
+						;
+					if (got < 0)
+						throw (std::runtime_error(std::string("append_from_fd: read: ") + std::strerror(errno)));
+					return (got);
+				}
+			};
+
+			struct StreamSource
+			{
+				std::streambuf*	buf;
+
+				size_type operator()(char* dest, size_type n) const { return (this->buf->sgetn(dest, n)); }
+			};
+
+			/* Same as reserve for trivially copyable elements, also keeping the partial bytes
+			   already read of the element after the last one */
+			void	growBytes(size_type n, size_type partial)
+			{
+				pointer tmp = this->_alloc.allocate(n);
+
+				if (this->_size || partial)
+					std::memcpy(ft::to_address(tmp), ft::to_address(this->_ptr), this->_size * sizeof(value_type) + partial);
+				if (this->_ptr)
+					this->_alloc.deallocate(this->_ptr, this->_capacity);
+				this->_ptr = tmp;
+				this->_capacity = n;
+			}
+
+			/* Reads at most max_bytes (a number of whole elements) from source straight into the
+			   capacity after the last element, instead of a construct per element.
+			   expected is what the source holds when known, 0 otherwise: the capacity is then
+			   reserved once, with one more element so that the read seeing the end has room.
+			   Returns the bytes read, of which the whole elements were added to the vector */
+			template <class Source>
+			size_type	appendBytes(const Source& source, size_type expected, size_type max_bytes)
+			{
+				const size_type	element = sizeof(value_type);
+				size_type		total = 0;
+				size_type		partial = 0; /* Bytes read of the element after the last one */
+
+				expected = std::min(expected, max_bytes);
+				if (expected && this->_size + expected / element + 2 > this->_capacity)
+					this->growBytes(this->_size + expected / element + 2, 0);
+				while (total < max_bytes)
+				{
+					size_type room = (this->_capacity - this->_size) * element - partial;
+					if (room == 0)
+					{
+						/* Source longer than expected (or of unknown size), grow like push_back */
+						size_type more = std::max(this->_capacity, VECTOR_READ_CHUNK / element + 1);
+						if (more > this->max_size() - this->_capacity)
+							throw (std::length_error("append: source too big"));
+						this->growBytes(this->_capacity + more, partial);
+						room = (this->_capacity - this->_size) * element - partial;
+					}
+					char* dest = reinterpret_cast<char*>(ft::to_address(this->_ptr + this->_size)) + partial;
+					size_type got = source(dest, std::min(std::min(room, max_bytes - total), VECTOR_READ_CHUNK));
+					if (got == 0)
+						break ;
+					total += got;
+					partial += got;
+					this->_size += partial / element;
+					partial %= element;
+				}
+				return (total);
+			}
 
 		public:
 			/* Default constructor */
@@ -125,6 +227,26 @@ namespace ft
 				this->assign(n, val);
 			}
 
+			/* Same, with the elements written by several threads, for multi GiB vectors where page faults
+			   and writes dominate. Only trivially copyable types are done in parallel: a throwing copy
+			   in one thread couldn't be rolled back, the others are filled like the constructor above */
+			vector(ft::parallel_tag, size_type n, const value_type& val = value_type(),
+				   const allocator_type& alloc = allocator_type()) : _ptr(0), _size(0), _capacity(0), _alloc(alloc)
+			{
+				if (!ft::is_trivially_copyable<value_type>::value || !ft::parallel_worth_it(n))
+				{
+					this->assign(n, val);
+					return ;
+				}
+
+				ParallelFill fill;
+				this->reserve(n);
+				fill.ptr = this->_ptr;
+				fill.val = &val;
+				ft::parallel_for(0, n, ft::parallel_grain(n), fill);
+				this->_size = n;
+			}
+
 			/* Range constructor */
 			template <class InputIterator>
         	vector(InputIterator first, InputIterator last,
@@ -136,17 +258,16 @@ namespace ft
 			/* Copy constructor */
 			vector(const vector& x) : _ptr(0), _size(0), _capacity(0), _alloc(x.get_allocator())
 			{
-				this->resize(x._size); /* First resize to initialize capacity and size */				
-				
-				for (size_type i = 0; i < x._size; ++i)
-					this->_alloc.construct(this->_ptr + i, x._ptr[i]);
+				this->reserve(x._size); /* First reserve to only allocate, elements are constructed by copy */
+				ft::uninitialized_copy(ft::to_address(x._ptr), x._ptr + x._size, this->_ptr);
 				this->_size = x._size;
 			}
 
 			~vector()
 			{
 				this->clear();
-				this->_alloc.deallocate(this->_ptr, this->_capacity);
+				if (this->_ptr)
+					this->_alloc.deallocate(this->_ptr, this->_capacity);
 			}
 
 			iterator		begin() { return (iterator(this->_ptr)); }
@@ -181,29 +302,14 @@ namespace ft
 				if (n > this->_size)
 				{
 					if (n > this->_capacity) /* Realloc of size n */
-					{
-						pointer tmp = this->_alloc.allocate(n);
-						for (size_type i = 0; i < this->_size; ++i) /* Move content */
-							this->_alloc.construct(tmp + i, this->_ptr[i]);
-						for (size_type i = this->_size; i < n; ++i) /* Append new content */
-							this->_alloc.construct(tmp + i, val);
-						this->_alloc.deallocate(this->_ptr, this->_capacity);
-						this->_ptr = tmp;
-						this->_capacity = n;
-						this->_size = n;
-					}
-					else /* Append without realloc */
-					{
-						for (size_type i = this->_size; i < n; ++i)
-							this->_alloc.construct(this->_ptr + i, val);
-					}
+						this->reserve(n);
+					/* Append new content */
+					ft::uninitialized_fill_n(this->_ptr + this->_size, n - this->_size, val);
 				}
 				else
 				{
-					this->_size = n;
 					/* If n is smaller than the current container size, the content is reduced to its first n elements, removing those beyond (and destroying them). */
-					for (size_type i = n; i < this->_capacity; ++i)
-						this->_alloc.destroy(this->_ptr + i);
+					ft::destroy(this->_ptr + n, this->_ptr + this->_size);
 				}
 				this->_size = n;
 			}
@@ -218,9 +324,18 @@ namespace ft
 					return;
 				
 				pointer tmp = this->_alloc.allocate(n);
-				for (size_type i = 0; i < this->_size; ++i) /* Move content */
-				 	this->_alloc.construct(tmp + i, this->_ptr[i]);
-				this->_alloc.deallocate(this->_ptr, this->_capacity);
+				try
+				{
+					ft::uninitialized_copy(ft::to_address(this->_ptr), this->_ptr + this->_size, tmp); /* Move content */
+				}
+				catch (...)
+				{
+					this->_alloc.deallocate(tmp, n);
+					throw;
+				}
+				ft::destroy(ft::to_address(this->_ptr), this->_ptr + this->_size);
+				if (this->_ptr)
+					this->_alloc.deallocate(this->_ptr, this->_capacity);
 				this->_ptr = tmp;
 				this->_capacity = n;
 			}
@@ -230,12 +345,12 @@ namespace ft
 
 			vector&	operator=(const vector& x)
 			{
+				if (this == &x)
+					return (*this);
 				/* If x capacity is 150 but size is 7, at least on linux, new capacity will be 7 */
-				this->resize(x._size); /* If this.capacity is bigger than x, do not downgrade */
 				this->clear();
-				
-				for (size_type i = 0; i < x._size; ++i)
-					this->_alloc.construct(this->_ptr + i, x._ptr[i]);
+				this->reserve(x._size); /* If this.capacity is bigger than x, do not downgrade */
+				ft::uninitialized_copy(ft::to_address(x._ptr), x._ptr + x._size, this->_ptr);
 				this->_size = x._size;
 				return (*this); /* Forget the return, get and "illegal hardware exception" :) */
 			}
@@ -262,11 +377,9 @@ namespace ft
 
 			void	assign(size_type n, const value_type& val)
 			{
+				this->clear();
 				this->reserve(n);
-				for (size_type i = 0; i < this->_size; ++i)
-					this->_alloc.destroy(this->_ptr + i);
-				for (size_type i = 0; i < n; ++i)
-					this->_alloc.construct(this->_ptr + i, val);
+				ft::uninitialized_fill_n(this->_ptr, n, val);
 				this->_size = n;
 			}
 
@@ -275,14 +388,90 @@ namespace ft
 			template <class InputIterator>
 			void	assign(InputIterator first, typename ft::enable_if<!std::numeric_limits<InputIterator>::is_integer ,InputIterator>::type last)
 			{
-				this->reserve(this->distance(first, last));
-				for (size_type i = 0; i < this->_size; ++i)
-					this->_alloc.destroy(this->_ptr + i);
-				
-				this->_size = this->distance(first, last); // Set distance first since we modify first after
+				size_type n = ft::distance(first, last); // Computed once, O(1) for random access iterators
 
-				for (size_type i = 0; first != last; ++first, ++i)
-					this->_alloc.construct(this->_ptr + i, *first);
+				this->clear();
+				this->reserve(n);
+				ft::uninitialized_copy(first, last, this->_ptr);
+				this->_size = n;
+			}
+
+			/* Appends the elements read from fd, until its end or max_bytes (rounded down to whole
+			   elements), for trivially copyable types only. The bytes are read in VECTOR_READ_CHUNK
+			   reads straight into the capacity, which is reserved once from fstat when fd is a
+			   regular file, and the kernel is told to read the file ahead.
+			   Returns the number of elements appended. Throws std::runtime_error on read errors or if
+			   fd ends in the middle of an element, the vector is then left as it was */
+			size_type	append_from_fd(int fd, size_type max_bytes = std::numeric_limits<size_type>::max())
+			{
+				typedef typename ft::enable_if<ft::is_trivially_copyable<value_type>::value, size_type>::type checked_size;
+				const checked_size	size = this->_size;
+				size_type			expected = 0;
+				struct stat			st;
+				FdSource			source;
+
+				max_bytes -= max_bytes % sizeof(value_type);
+				if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+				{
+					off_t offset = lseek(fd, 0, SEEK_CUR);
+					if (offset >= 0 && offset < st.st_size)
+						expected = st.st_size - offset;
+#ifdef POSIX_FADV_SEQUENTIAL
+					/* Only hints, errors don't matter */
+					if (offset >= 0 && expected)
+					{
+						posix_fadvise(fd, offset, std::min(expected, max_bytes), POSIX_FADV_SEQUENTIAL);
+						posix_fadvise(fd, offset, std::min(expected, max_bytes), POSIX_FADV_WILLNEED);
+					}
+#endif
+				}
+				source.fd = fd;
+				try
+				{
+					if (this->appendBytes(source, expected, max_bytes) % sizeof(value_type))
+						throw (std::runtime_error("append_from_fd: input ends in the middle of an element"));
+				}
+				catch (...)
+				{
+					this->_size = size;
+					throw;
+				}
+				return (this->_size - size);
+			}
+
+			/* Same from a stream, read with sgetn (file streams then read() straight into the vector).
+			   The capacity is reserved once when the stream can seek. Sets eofbit if the stream ended
+			   before max_bytes, and failbit (leaving the vector as it was) if it ended in the middle of
+			   an element */
+			size_type	append_from_stream(std::istream& in, size_type max_bytes = std::numeric_limits<size_type>::max())
+			{
+				typedef typename ft::enable_if<ft::is_trivially_copyable<value_type>::value, size_type>::type checked_size;
+				const checked_size	size = this->_size;
+				size_type			expected = 0;
+				StreamSource		source;
+
+				std::istream::sentry sentry(in, true);
+				if (!sentry)
+					return (0);
+				max_bytes -= max_bytes % sizeof(value_type);
+				source.buf = in.rdbuf();
+				std::streamoff offset = source.buf->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+				if (offset >= 0)
+				{
+					std::streamoff end = source.buf->pubseekoff(0, std::ios_base::end, std::ios_base::in);
+					if (end > offset)
+						expected = end - offset;
+					source.buf->pubseekoff(offset, std::ios_base::beg, std::ios_base::in);
+				}
+				size_type got = this->appendBytes(source, expected, max_bytes);
+				if (got < max_bytes)
+					in.setstate(std::ios_base::eofbit);
+				if (got % sizeof(value_type))
+				{
+					this->_size = size;
+					in.setstate(std::ios_base::failbit);
+				}
+				return (this->_size - size);
 			}
 
 			/* If the array is not enough to hold value, double it's size */
@@ -307,7 +496,7 @@ namespace ft
 			   otherwise not, if it's != all iterators are invalidated */
 			iterator insert(iterator position, const value_type& val)
 			{
-				size_type index = this->distance(this->begin(), position);
+				size_type index = ft::distance(this->begin(), position);
 
 				// Move everything one slot to the right, starting at index
 				this->moveElementsRight(index, 1);
@@ -320,17 +509,14 @@ namespace ft
 
 			void insert(iterator position, size_type n, const value_type& val)
 			{
-				size_type index = this->distance(this->begin(), position);
+				size_type index = ft::distance(this->begin(), position);
 
 				// Same as above, except we move n instead of 1
 				this->moveElementsRight(index, n);
 
 				// Fill the "blank" slots
-				for (size_type i = 0; i < n; ++i)
-				{
-					this->_alloc.construct(this->_ptr + index + i, val);
-					++this->_size;
-				}
+				ft::uninitialized_fill_n(this->_ptr + index, n, val);
+				this->_size += n;
 			}
 
 			// Same as above, except now N is the distance between first and last
@@ -341,22 +527,14 @@ namespace ft
 			template<class InputIterator>
 			void insert(iterator position, InputIterator first, typename ft::enable_if<!std::numeric_limits<InputIterator>::is_integer ,InputIterator>::type last)
 			{
-				size_type index = this->distance(this->begin(), position);
-				size_type n = 0;
-
-				InputIterator firstCpy(first);
-				while (firstCpy++ != last)
-					++n;
+				size_type index = ft::distance(this->begin(), position);
+				size_type n = ft::distance(first, last);
 
 				this->moveElementsRight(index, n);
 
 				// Fill the "blank" slots
-				for(size_type i = 0; first != last; ++i)
-				{
-					this->_alloc.construct(this->_ptr + index + i, *first);
-					++first;
-					++this->_size;
-				}
+				ft::uninitialized_copy(first, last, this->_ptr + index);
+				this->_size += n;
 			}
 
 			iterator erase(iterator position)
@@ -364,7 +542,7 @@ namespace ft
 				if (this->_size == 0)
 					return (this->end());
 					
-				size_type index = this->distance(this->begin(), position);
+				size_type index = ft::distance(this->begin(), position);
 
 				// Destroy the given element
 				this->_alloc.destroy(this->_ptr + index);
@@ -380,8 +558,8 @@ namespace ft
 			// 1
 			iterator erase(iterator first, iterator last)
 			{
-				size_type index = this->distance(this->begin(), first);
-				size_type n = this->distance(first, last);
+				size_type index = ft::distance(this->begin(), first);
+				size_type n = ft::distance(first, last);
 
 				if (index >= this->_size) // past the end or equal
 					return (this->end());
@@ -389,8 +567,7 @@ namespace ft
 				/* Since we include first but not last, use strict <, only special case is when first == last
 				   because first should be included but not last, but it is handled right above in case n == 0 */
 				// As above, destroy the elements, but every one in range [first-last) instead of 1
-				for (size_type i = index; i < index + n; ++i)
-					this->_alloc.destroy(this->_ptr + i);
+				ft::destroy(this->_ptr + index, this->_ptr + index + n);
 
 				// Shift everything left
 				this->moveElementsLeft(index, n);
@@ -404,27 +581,29 @@ namespace ft
 				pointer		tmp_ptr = this->_ptr;
 				size_type	tmp_size = this->_size;
 				size_type	tmp_capacity = this->_capacity;
+				allocator_type	tmp_alloc = this->_alloc; /* The buffers go with the allocator which allocated them */
 
 				this->_ptr = x._ptr;
 				this->_size = x._size;
 				this->_capacity = x._capacity;
+				this->_alloc = x._alloc;
 
 				x._ptr = tmp_ptr;
 				x._size = tmp_size;
 				x._capacity = tmp_capacity;
+				x._alloc = tmp_alloc;
 			}
 
 			/* deallocate does not destroy elements, see std::allocator::deallocate cplusplus.com */
 			void clear()
 			{
-				for (size_type i = 0; i < this->_size; ++i)
-					this->_alloc.destroy(this->_ptr + i);
+				ft::destroy(ft::to_address(this->_ptr), this->_ptr + this->_size);
 				this->_size = 0;
 			}
 
 			allocator_type get_allocator() const
 			{
-				return (allocator_type());
+				return (this->_alloc);
 			}
 	};
 
@@ -451,13 +630,14 @@ namespace ft
 	bool operator<(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
 	{ return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
 
+	// Written with < only, so that each comparison is a single pass over the vectors
 	template <class T, class Alloc>
 	bool operator<=(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
-	{ return (lhs < rhs || lhs == rhs); }
+	{ return (!(rhs < lhs)); }
 
 	template <class T, class Alloc>
 	bool operator>(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
-	{ return (!(lhs <= rhs)); } // Either <= or >
+	{ return (rhs < lhs); } // Either <= or >
 
 	template <class T, class Alloc>
 	bool operator>=(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
@@ -0,0 +1,262 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 06:52 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VECTORED_IO_HPP
+# define VECTORED_IO_HPP
+
+#include "iterators.hpp"
+#include "enable_if.hpp"
+#include "pairs.hpp"
+#include "type_traits.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+#include <sys/uio.h>
+#include <limits.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+
+// Segments given to one writev(), IOV_MAX is the most the kernel accepts
+#ifdef IOV_MAX
+# define VECTORED_IO_MAX_SEGMENTS IOV_MAX
+#else
+# define VECTORED_IO_MAX_SEGMENTS 1024
+#endif
+
+// Staging buffer of write_all() for elements packed member by member
+#define VECTORED_IO_PACK_BUFFER ((size_t)64 << 10)
+
+/* Writing containers out without copying them into a staging buffer first: gather_segments()
+   describes where the bytes of the elements are as iovecs (one for a contiguous range, one per
+   element otherwise, merged when they touch), and write_all() hands them to writev().
+   Only elements without padding are written as they are in memory: padding is never initialized
+   and would leak whatever was there before to the file or socket. Pairs with padding (the
+   pair<const int, long> of a map) are packed member by member into a buffer instead, and
+   anything else doesn't compile */
+
+namespace ft
+{
+	/* Every byte of a T is part of a value: integers, floats, pointers, types the compiler knows
+	   have no padding, and pairs of them when their members fill them.
+	   Specialize it (true) for a type of yours whose bytes are all set (zeroed padding) */
+	template <class T>
+	struct is_padding_free
+	{
+		static const bool value = ft::is_integral<T>::value || __has_unique_object_representations(T);
+	};
+
+	template <class T>
+	struct is_padding_free<const T> : ft::is_padding_free<T> { };
+
+	// Not unique representations (+0 / -0), but no padding either, unlike long double
+	template <>
+	struct is_padding_free<float> { static const bool value = true; };
+
+	template <>
+	struct is_padding_free<double> { static const bool value = true; };
+
+	template <class T>
+	struct is_padding_free<T*> { static const bool value = true; };
+
+	template <class T1, class T2>
+	struct is_padding_free<ft::pair<T1, T2> >
+	{
+		static const bool value = ft::is_padding_free<T1>::value && ft::is_padding_free<T2>::value
+								  && sizeof(T1) + sizeof(T2) == sizeof(ft::pair<T1, T2>);
+	};
+
+	// Writes the members of a T one after the other, leaving its padding out
+	template <class T>
+	struct packed_layout
+	{
+		static const bool	packable = ft::is_padding_free<T>::value;
+		static const size_t	size = sizeof(T);
+
+		static char* pack(const T& val, char* out)
+		{
+			std::memcpy(out, &val, sizeof(T));
+			return (out + sizeof(T));
+		}
+	};
+
+	template <class T>
+	struct packed_layout<const T> : ft::packed_layout<T> { };
+
+	template <class T1, class T2>
+	struct packed_layout<ft::pair<T1, T2> >
+	{
+		static const bool	packable = ft::packed_layout<T1>::packable && ft::packed_layout<T2>::packable;
+		static const size_t	size = ft::packed_layout<T1>::size + ft::packed_layout<T2>::size;
+
+		static char* pack(const ft::pair<T1, T2>& val, char* out)
+		{ return (ft::packed_layout<T2>::pack(val.second, ft::packed_layout<T1>::pack(val.first, out))); }
+	};
+
+	template <class Iterator, class Result>
+	struct enable_if_padding_free
+		: ft::enable_if<ft::is_padding_free<typename ft::iterator_traits<Iterator>::value_type>::value, Result> { };
+
+	template <class Iterator, class Result>
+	struct enable_if_packable
+		: ft::enable_if<ft::packed_layout<typename ft::iterator_traits<Iterator>::value_type>::packable, Result> { };
+
+	inline void vectored_io_error(const std::string& what)
+	{
+		throw (std::runtime_error("vectored_io: " + what + ": " + std::strerror(errno)));
+	}
+
+	template <class Iterator>
+	Iterator gather_dispatch(Iterator first, Iterator last, struct iovec* iov, size_t max, size_t& count, ft::true_type)
+	{
+		if (first == last || max == 0)
+			return (first);
+		iov[0].iov_base = const_cast<void*>(static_cast<const void*>(ft::to_address(first)));
+		iov[0].iov_len = (last - first) * sizeof(*first);
+		count = 1;
+		return (last);
+	}
+
+	template <class Iterator>
+	Iterator gather_dispatch(Iterator first, Iterator last, struct iovec* iov, size_t max, size_t& count, ft::false_type)
+	{
+		for (; first != last; ++first)
+		{
+			char* bytes = const_cast<char*>(reinterpret_cast<const char*>(&*first));
+			if (count > 0 && static_cast<char*>(iov[count - 1].iov_base) + iov[count - 1].iov_len == bytes)
+				iov[count - 1].iov_len += sizeof(*first); // Follows the previous element in memory
+			else if (count < max)
+			{
+				iov[count].iov_base = bytes;
+				iov[count].iov_len = sizeof(*first);
+				++count;
+			}
+			else
+				break ;
+		}
+		return (first);
+	}
+
+	/* Fills at most max iovecs with the bytes of [first, last), sets count to how many were filled
+	   and returns where it stopped (last once everything was gathered), to continue from there */
+	template <class Iterator>
+	typename ft::enable_if_padding_free<Iterator, Iterator>::type
+		gather_segments(Iterator first, Iterator last, struct iovec* iov, size_t max, size_t& count)
+	{
+		count = 0;
+		return (ft::gather_dispatch(first, last, iov, max, count,
+									typename ft::choose<ft::is_contiguous_iterator<Iterator>::value,
+														ft::true_type, ft::false_type>::type()));
+	}
+
+	// Same over a whole container (vector, mmap_vector, map, set...)
+	template <class Container>
+	typename ft::enable_if_padding_free<typename Container::const_iterator, typename Container::const_iterator>::type
+		gather_segments(const Container& c, struct iovec* iov, size_t max, size_t& count)
+	{
+		return (ft::gather_segments(c.begin(), c.end(), iov, max, count));
+	}
+
+	// writev() until every segment is written (consuming iov), returns the bytes written
+	inline size_t writev_full(int fd, struct iovec* iov, size_t count)
+	{
+		size_t total = 0;
+
+		while (count > 0)
+		{
+			ssize_t ret = writev(fd, iov, count);
+			if (ret < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				vectored_io_error("writev");
+			}
+			total += ret;
+			// Skip what was written, the kernel may stop in the middle of a segment
+			size_t done = ret;
+			for (; count > 0 && done >= iov->iov_len; ++iov, --count)
+				done -= iov->iov_len;
+			if (count > 0)
+			{
+				iov->iov_base = static_cast<char*>(iov->iov_base) + done;
+				iov->iov_len -= done;
+			}
+		}
+		return (total);
+	}
+
+	// No padding: the elements' own memory, VECTORED_IO_MAX_SEGMENTS segments per writev()
+	template <class Iterator>
+	size_t write_dispatch(int fd, Iterator first, Iterator last, ft::true_type)
+	{
+		struct iovec	iov[VECTORED_IO_MAX_SEGMENTS];
+		size_t			count;
+		size_t			total = 0;
+
+		while (first != last)
+		{
+			first = ft::gather_segments(first, last, iov, VECTORED_IO_MAX_SEGMENTS, count);
+			total += ft::writev_full(fd, iov, count);
+		}
+		return (total);
+	}
+
+	// Padding: packed into a buffer, written each time it fills up
+	template <class Iterator>
+	size_t write_dispatch(int fd, Iterator first, Iterator last, ft::false_type)
+	{
+		typedef ft::packed_layout<typename ft::iterator_traits<Iterator>::value_type> layout;
+
+		const size_t		size = layout::size; // std::max takes a reference, the constant has no definition
+		ft::vector<char>	buffer(std::max(VECTORED_IO_PACK_BUFFER, size));
+		struct iovec		iov;
+		size_t				total = 0;
+
+		while (first != last)
+		{
+			char* out = &buffer[0];
+			for (; first != last && out + size <= &buffer[0] + buffer.size(); ++first)
+				out = layout::pack(*first, out);
+			iov.iov_base = &buffer[0];
+			iov.iov_len = out - &buffer[0];
+			total += ft::writev_full(fd, &iov, 1);
+		}
+		return (total);
+	}
+
+	/* Writes the elements of [first, last) to fd: as they are in memory with no copy on our side
+	   when they have no padding, packed member by member otherwise. Returns the bytes written,
+	   throws std::runtime_error on errors */
+	template <class Iterator>
+	typename ft::enable_if_packable<Iterator, size_t>::type
+		write_all(int fd, Iterator first, Iterator last)
+	{
+		typedef typename ft::iterator_traits<Iterator>::value_type value_type;
+
+		return (ft::write_dispatch(fd, first, last,
+								   typename ft::choose<ft::is_padding_free<value_type>::value,
+													   ft::true_type, ft::false_type>::type()));
+	}
+
+	template <class Container>
+	typename ft::enable_if_packable<typename Container::const_iterator, size_t>::type
+		write_all(int fd, const Container& c)
+	{
+		return (ft::write_all(fd, c.begin(), c.end()));
+	}
+}
+
+#endif
@@ -0,0 +1,623 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 04:53 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef VIEWS_HPP
+# define VIEWS_HPP
+
+#include "algorithm.hpp"
+#include "enable_if.hpp"
+#include "iterators.hpp"
+#include "numeric.hpp"
+#include "utils.hpp"
+
+/*
+	Lazy views: a view is a pair of iterators, adapted ones for filter / transform / take,
+	nothing is copied or allocated, elements are computed when the view is walked.
+
+	Views are made from any range (container or view) either by calling them
+		ft::views::filter(vec, IsEven())
+	or by piping a range in them
+		vec | ft::views::filter(IsEven()) | ft::views::transform(Square()) | ft::views::take(10)
+
+	They don't own anything: a view of a container is invalidated like its iterators are.
+	Functors used by transform need a result_type typedef (like std::unary_function ones),
+	plain function pointers work too.
+*/
+
+namespace ft
+{
+	/*******************************************************
+	 *                     Range traits                    *
+	 *******************************************************/
+
+	// Iterator a range gives, const_iterator if the range is const
+	template <class Range>
+	struct range_iterator { typedef typename Range::iterator type; };
+
+	template <class Range>
+	struct range_iterator<const Range> { typedef typename Range::const_iterator type; };
+
+	// Every view derives from it, is_view is how algorithms recognize them
+	struct view_base { };
+
+	template <class T>
+	struct is_view
+	{
+		private:
+			static char test(const view_base*);
+			static long test(...);
+
+		public:
+			static const bool value = (sizeof(test(static_cast<T*>(NULL))) == sizeof(char));
+	};
+
+	// Return type of a functor / function pointer, the reference itself if it returns one
+	template <class Function>
+	struct function_result { typedef typename Function::result_type type; };
+
+	template <class Result, class Arg>
+	struct function_result<Result (*)(Arg)> { typedef Result type; };
+
+	/*******************************************************
+	 *                       subrange                      *
+	 *******************************************************/
+
+	// The view every other one is: just a begin and an end
+	template <class Iterator>
+	class subrange : public view_base
+	{
+		public:
+			typedef Iterator													iterator;
+			typedef Iterator													const_iterator;
+			typedef typename ft::iterator_traits<Iterator>::value_type			value_type;
+			typedef typename ft::iterator_traits<Iterator>::reference			reference;
+			typedef typename ft::iterator_traits<Iterator>::difference_type		difference_type;
+
+		private:
+			iterator	_first;
+			iterator	_last;
+
+		public:
+			subrange() : _first(), _last() { }
+			subrange(iterator first, iterator last) : _first(first), _last(last) { }
+
+			iterator begin() const { return (this->_first); }
+			iterator end() const { return (this->_last); }
+
+			bool empty() const { return (this->_first == this->_last); }
+
+			// O(1) for random access iterators, walks the view otherwise
+			difference_type size() const { return (ft::distance(this->_first, this->_last)); }
+	};
+
+	/*******************************************************
+	 *                   filter_iterator                   *
+	 *******************************************************/
+
+	/* Skips the elements pred is false for, needs to know where the range ends to stop there.
+	   Forward only, going backward would need to know where it starts as well */
+	template <class Iterator, class Predicate>
+	class filter_iterator
+	{
+		public:
+			typedef ft::forward_iterator_tag								iterator_category;
+			typedef typename ft::iterator_traits<Iterator>::value_type		value_type;
+			typedef typename ft::iterator_traits<Iterator>::difference_type	difference_type;
+			typedef typename ft::iterator_traits<Iterator>::pointer			pointer;
+			typedef typename ft::iterator_traits<Iterator>::reference		reference;
+
+		private:
+			Iterator	_current;
+			Iterator	_last;
+			Predicate	_pred;
+
+			void satisfy()
+			{
+				while (this->_current != this->_last && !this->_pred(*this->_current))
+					++this->_current;
+			}
+
+		public:
+			filter_iterator() : _current(), _last(), _pred() { }
+			filter_iterator(Iterator current, Iterator last, Predicate pred)
+			: _current(current), _last(last), _pred(pred) { this->satisfy(); }
+
+			Iterator base() const { return (this->_current); }
+
+			reference operator*() const { return (*this->_current); }
+			pointer operator->() const { return (&(*this->_current)); }
+
+			filter_iterator& operator++() { ++this->_current; this->satisfy(); return (*this); }
+			filter_iterator operator++(int) { filter_iterator tmp = *this; ++(*this); return (tmp); }
+
+			bool operator==(const filter_iterator& rhs) const { return (this->_current == rhs._current); }
+			bool operator!=(const filter_iterator& rhs) const { return (this->_current != rhs._current); }
+	};
+
+	/*******************************************************
+	 *                  transform_iterator                 *
+	 *******************************************************/
+
+	/* Dereferencing gives fn(*it), computed every time. Keeps the category of the underlying
+	   iterator (a transformed vector can still be jumped in), even if the reference may then
+	   be a value which strict C++98 forward iterators don't allow */
+	template <class Iterator, class Function>
+	class transform_iterator
+	{
+		public:
+			typedef typename ft::iterator_traits<Iterator>::iterator_category	iterator_category;
+			typedef typename ft::function_result<Function>::type				reference;
+			typedef typename ft::remove_const<
+						typename ft::remove_reference<reference>::type>::type	value_type;
+			typedef typename ft::iterator_traits<Iterator>::difference_type		difference_type;
+			typedef typename ft::remove_reference<reference>::type*				pointer;
+
+		private:
+			Iterator	_current;
+			Function	_fn;
+
+		public:
+			transform_iterator() : _current(), _fn() { }
+			transform_iterator(Iterator current, Function fn) : _current(current), _fn(fn) { }
+
+			Iterator base() const { return (this->_current); }
+
+			reference operator*() const { return (this->_fn(*this->_current)); }
+			reference operator[](difference_type n) const { return (this->_fn(this->_current[n])); }
+
+			transform_iterator& operator++() { ++this->_current; return (*this); }
+			transform_iterator operator++(int) { transform_iterator tmp = *this; ++this->_current; return (tmp); }
+			transform_iterator& operator--() { --this->_current; return (*this); }
+			transform_iterator operator--(int) { transform_iterator tmp = *this; --this->_current; return (tmp); }
+
+			transform_iterator& operator+=(difference_type n) { this->_current += n; return (*this); }
+			transform_iterator& operator-=(difference_type n) { this->_current -= n; return (*this); }
+			transform_iterator operator+(difference_type n) const { return (transform_iterator(this->_current + n, this->_fn)); }
+			transform_iterator operator-(difference_type n) const { return (transform_iterator(this->_current - n, this->_fn)); }
+			difference_type operator-(const transform_iterator& rhs) const { return (this->_current - rhs._current); }
+
+			bool operator==(const transform_iterator& rhs) const { return (this->_current == rhs._current); }
+			bool operator!=(const transform_iterator& rhs) const { return (this->_current != rhs._current); }
+			bool operator<(const transform_iterator& rhs) const { return (this->_current < rhs._current); }
+			bool operator<=(const transform_iterator& rhs) const { return (this->_current <= rhs._current); }
+			bool operator>(const transform_iterator& rhs) const { return (this->_current > rhs._current); }
+			bool operator>=(const transform_iterator& rhs) const { return (this->_current >= rhs._current); }
+	};
+
+	/*******************************************************
+	 *                     take_iterator                   *
+	 *******************************************************/
+
+	/* Stops after count elements or at the end of the range, whichever comes first.
+	   Only used when the range isn't random access, otherwise take is just a shorter subrange */
+	template <class Iterator>
+	class take_iterator
+	{
+		public:
+			typedef ft::forward_iterator_tag								iterator_category;
+			typedef typename ft::iterator_traits<Iterator>::value_type		value_type;
+			typedef typename ft::iterator_traits<Iterator>::difference_type	difference_type;
+			typedef typename ft::iterator_traits<Iterator>::pointer			pointer;
+			typedef typename ft::iterator_traits<Iterator>::reference		reference;
+
+		private:
+			Iterator		_current;
+			Iterator		_last;
+			difference_type	_count;
+
+			bool done() const { return (this->_count <= 0 || this->_current == this->_last); }
+
+		public:
+			take_iterator() : _current(), _last(), _count(0) { }
+			take_iterator(Iterator current, Iterator last, difference_type count)
+			: _current(current), _last(last), _count(count) { }
+
+			Iterator base() const { return (this->_current); }
+
+			reference operator*() const { return (*this->_current); }
+			pointer operator->() const { return (&(*this->_current)); }
+
+			take_iterator& operator++() { ++this->_current; --this->_count; return (*this); }
+			take_iterator operator++(int) { take_iterator tmp = *this; ++(*this); return (tmp); }
+
+			// Every finished iterator is the end, whether it ran out of count or of range
+			bool operator==(const take_iterator& rhs) const
+			{
+				if (this->done() || rhs.done())
+					return (this->done() && rhs.done());
+				return (this->_current == rhs._current);
+			}
+			bool operator!=(const take_iterator& rhs) const { return (!(*this == rhs)); }
+	};
+
+	/*******************************************************
+	 *                    Pair accessors                   *
+	 *******************************************************/
+
+	/* keys / values are transforms returning references into the pairs, so that values
+	   of a non-const map can be assigned through the view. Pair is const for const ranges */
+	template <class Pair>
+	struct pair_first
+	{
+		typedef typename Pair::first_type& result_type;
+
+		result_type operator()(Pair& p) const { return (p.first); }
+	};
+
+	template <class Pair>
+	struct pair_first<const Pair>
+	{
+		typedef const typename Pair::first_type& result_type;
+
+		result_type operator()(const Pair& p) const { return (p.first); }
+	};
+
+	template <class Pair>
+	struct pair_second
+	{
+		typedef typename Pair::second_type& result_type;
+
+		result_type operator()(Pair& p) const { return (p.second); }
+	};
+
+	template <class Pair>
+	struct pair_second<const Pair>
+	{
+		typedef const typename Pair::second_type& result_type;
+
+		result_type operator()(const Pair& p) const { return (p.second); }
+	};
+
+	/*******************************************************
+	 *                        Views                        *
+	 *******************************************************/
+
+	namespace views
+	{
+		/* Each view has a result<Range> giving its type for a range, a function taking the range
+		   (const and non-const, temporaries are views being chained), and an adaptor storing the
+		   arguments until a range is piped in it */
+
+		template <class Range>
+		struct all_result { typedef ft::subrange<typename ft::range_iterator<Range>::type> type; };
+
+		template <class Range>
+		typename all_result<Range>::type all(Range& range)
+		{ return (typename all_result<Range>::type(range.begin(), range.end())); }
+
+		template <class Range>
+		typename all_result<const Range>::type all(const Range& range)
+		{ return (typename all_result<const Range>::type(range.begin(), range.end())); }
+
+
+		/*********************** filter ***********************/
+
+		template <class Range, class Predicate>
+		struct filter_result
+		{
+			typedef ft::filter_iterator<typename ft::range_iterator<Range>::type, Predicate>	iterator;
+			typedef ft::subrange<iterator>													type;
+		};
+
+		template <class Range, class Predicate>
+		typename filter_result<Range, Predicate>::type filter_range(Range& range, Predicate pred)
+		{
+			typedef typename filter_result<Range, Predicate>::iterator iterator;
+
+			return (typename filter_result<Range, Predicate>::type(iterator(range.begin(), range.end(), pred),
+																   iterator(range.end(), range.end(), pred)));
+		}
+
+		template <class Range, class Predicate>
+		typename filter_result<Range, Predicate>::type filter(Range& range, Predicate pred)
+		{ return (views::filter_range(range, pred)); }
+
+		template <class Range, class Predicate>
+		typename filter_result<const Range, Predicate>::type filter(const Range& range, Predicate pred)
+		{ return (views::filter_range(range, pred)); }
+
+		template <class Predicate>
+		struct filter_adaptor
+		{
+			template <class Range>
+			struct result { typedef typename filter_result<Range, Predicate>::type type; };
+
+			Predicate pred;
+
+			explicit filter_adaptor(Predicate pred) : pred(pred) { }
+
+			template <class Range>
+			typename result<Range>::type operator()(Range& range) const { return (views::filter_range(range, this->pred)); }
+		};
+
+		template <class Predicate>
+		filter_adaptor<Predicate> filter(Predicate pred) { return (filter_adaptor<Predicate>(pred)); }
+
+
+		/********************** transform *********************/
+
+		template <class Range, class Function>
+		struct transform_result
+		{
+			typedef ft::transform_iterator<typename ft::range_iterator<Range>::type, Function>	iterator;
+			typedef ft::subrange<iterator>														type;
+		};
+
+		template <class Range, class Function>
+		typename transform_result<Range, Function>::type transform_range(Range& range, Function fn)
+		{
+			typedef typename transform_result<Range, Function>::iterator iterator;
+
+			return (typename transform_result<Range, Function>::type(iterator(range.begin(), fn), iterator(range.end(), fn)));
+		}
+
+		template <class Range, class Function>
+		typename transform_result<Range, Function>::type transform(Range& range, Function fn)
+		{ return (views::transform_range(range, fn)); }
+
+		template <class Range, class Function>
+		typename transform_result<const Range, Function>::type transform(const Range& range, Function fn)
+		{ return (views::transform_range(range, fn)); }
+
+		template <class Function>
+		struct transform_adaptor
+		{
+			template <class Range>
+			struct result { typedef typename transform_result<Range, Function>::type type; };
+
+			Function fn;
+
+			explicit transform_adaptor(Function fn) : fn(fn) { }
+
+			template <class Range>
+			typename result<Range>::type operator()(Range& range) const { return (views::transform_range(range, this->fn)); }
+		};
+
+		template <class Function>
+		transform_adaptor<Function> transform(Function fn) { return (transform_adaptor<Function>(fn)); }
+
+
+		/*********************** take / drop *********************/
+
+		/* Random access ranges are cut with their own iterators (and so still reach the
+		   contiguous / SIMD fast paths), other ones count with a take_iterator */
+		template <class Iterator, bool RandomAccess = ft::is_random_access_iterator<Iterator>::value>
+		struct take_traits
+		{
+			typedef Iterator iterator;
+
+			static ft::subrange<iterator> make(Iterator first, Iterator last, size_t n)
+			{
+				if (static_cast<size_t>(last - first) > n)
+					last = first + n;
+				return (ft::subrange<iterator>(first, last));
+			}
+		};
+
+		template <class Iterator>
+		struct take_traits<Iterator, false>
+		{
+			typedef ft::take_iterator<Iterator> iterator;
+
+			static ft::subrange<iterator> make(Iterator first, Iterator last, size_t n)
+			{ return (ft::subrange<iterator>(iterator(first, last, n), iterator(last, last, 0))); }
+		};
+
+		template <class Range>
+		struct take_result
+		{
+			typedef take_traits<typename ft::range_iterator<Range>::type>	traits;
+			typedef ft::subrange<typename traits::iterator>					type;
+		};
+
+		template <class Range>
+		typename take_result<Range>::type take(Range& range, size_t n)
+		{ return (take_result<Range>::traits::make(range.begin(), range.end(), n)); }
+
+		template <class Range>
+		typename take_result<const Range>::type take(const Range& range, size_t n)
+		{ return (take_result<const Range>::traits::make(range.begin(), range.end(), n)); }
+
+		struct take_adaptor
+		{
+			template <class Range>
+			struct result { typedef typename take_result<Range>::type type; };
+
+			size_t n;
+
+			explicit take_adaptor(size_t n) : n(n) { }
+
+			template <class Range>
+			typename result<Range>::type operator()(Range& range) const
+			{ return (take_result<Range>::traits::make(range.begin(), range.end(), this->n)); }
+		};
+
+		inline take_adaptor take(size_t n) { return (take_adaptor(n)); }
+
+
+		/* The only view doing work when made: the n first elements are skipped right away
+		   (in O(1) for random access ranges), after that it's a plain subrange */
+		template <class Iterator>
+		ft::subrange<Iterator> drop_range(Iterator first, Iterator last, size_t n)
+		{
+			if (ft::is_random_access_iterator<Iterator>::value)
+				first = (static_cast<size_t>(ft::distance(first, last)) > n) ? ft::next(first, n) : last;
+			else
+			{
+				for (; n > 0 && first != last; --n)
+					++first;
+			}
+			return (ft::subrange<Iterator>(first, last));
+		}
+
+		template <class Range>
+		typename all_result<Range>::type drop(Range& range, size_t n)
+		{ return (views::drop_range(range.begin(), range.end(), n)); }
+
+		template <class Range>
+		typename all_result<const Range>::type drop(const Range& range, size_t n)
+		{ return (views::drop_range(range.begin(), range.end(), n)); }
+
+		struct drop_adaptor
+		{
+			template <class Range>
+			struct result { typedef typename all_result<Range>::type type; };
+
+			size_t n;
+
+			explicit drop_adaptor(size_t n) : n(n) { }
+
+			template <class Range>
+			typename result<Range>::type operator()(Range& range) const
+			{ return (views::drop_range(range.begin(), range.end(), this->n)); }
+		};
+
+		inline drop_adaptor drop(size_t n) { return (drop_adaptor(n)); }
+
+
+		/*********************** keys / values ***********************/
+
+		// Pair type of a range (const for const ranges), from its iterator reference
+		template <class Range>
+		struct range_pair
+		{ typedef typename ft::remove_reference<typename ft::iterator_traits<typename ft::range_iterator<Range>::type>::reference>::type type; };
+
+		template <class Range>
+		struct keys_result { typedef typename transform_result<Range, ft::pair_first<typename range_pair<Range>::type> >::type type; };
+
+		template <class Range>
+		struct values_result { typedef typename transform_result<Range, ft::pair_second<typename range_pair<Range>::type> >::type type; };
+
+		template <class Range>
+		typename keys_result<Range>::type keys(Range& range)
+		{ return (views::transform_range(range, ft::pair_first<typename range_pair<Range>::type>())); }
+
+		template <class Range>
+		typename keys_result<const Range>::type keys(const Range& range)
+		{ return (views::transform_range(range, ft::pair_first<typename range_pair<const Range>::type>())); }
+
+		template <class Range>
+		typename values_result<Range>::type values(Range& range)
+		{ return (views::transform_range(range, ft::pair_second<typename range_pair<Range>::type>())); }
+
+		template <class Range>
+		typename values_result<const Range>::type values(const Range& range)
+		{ return (views::transform_range(range, ft::pair_second<typename range_pair<const Range>::type>())); }
+
+		struct keys_adaptor
+		{
+			template <class Range>
+			struct result { typedef typename keys_result<Range>::type type; };
+
+			template <class Range>
+			typename result<Range>::type operator()(Range& range) const { return (views::keys(range)); }
+		};
+
+		struct values_adaptor
+		{
+			template <class Range>
+			struct result { typedef typename values_result<Range>::type type; };
+
+			template <class Range>
+			typename result<Range>::type operator()(Range& range) const { return (views::values(range)); }
+		};
+
+		inline keys_adaptor keys() { return (keys_adaptor()); }
+		inline values_adaptor values() { return (values_adaptor()); }
+
+
+		/*********************** Piping ***********************/
+
+		template <class T>
+		struct is_adaptor { static const bool value = false; };
+
+		template <class Predicate>
+		struct is_adaptor<filter_adaptor<Predicate> > { static const bool value = true; };
+
+		template <class Function>
+		struct is_adaptor<transform_adaptor<Function> > { static const bool value = true; };
+
+		template <>
+		struct is_adaptor<take_adaptor> { static const bool value = true; };
+
+		template <>
+		struct is_adaptor<drop_adaptor> { static const bool value = true; };
+
+		template <>
+		struct is_adaptor<keys_adaptor> { static const bool value = true; };
+
+		template <>
+		struct is_adaptor<values_adaptor> { static const bool value = true; };
+
+		// range | adaptor is adaptor(range), found by ADL on the adaptor whatever the range is
+		template <class Range, class Adaptor>
+		typename ft::enable_if<is_adaptor<Adaptor>::value, typename Adaptor::template result<Range>::type>::type
+		operator|(Range& range, const Adaptor& adaptor)
+		{ return (adaptor(range)); }
+
+		template <class Range, class Adaptor>
+		typename ft::enable_if<is_adaptor<Adaptor>::value, typename Adaptor::template result<const Range>::type>::type
+		operator|(const Range& range, const Adaptor& adaptor)
+		{ return (adaptor(range)); }
+
+	}
+
+	/*******************************************************
+	 *                  Algorithms on views                *
+	 *******************************************************/
+
+	/* Views can be handed to the algorithms as they are. Only views: a container would make
+	   these ambiguous with the iterator versions (find(first, last) vs find(range, value)) */
+
+	template <class View, class T>
+	typename ft::enable_if<ft::is_view<View>::value, T>::type
+	reduce(const View& view, T init)
+	{ return (ft::reduce(view.begin(), view.end(), init)); }
+
+	template <class View, class T, class BinaryOperation>
+	typename ft::enable_if<ft::is_view<View>::value, T>::type
+	reduce(const View& view, T init, BinaryOperation op)
+	{ return (ft::reduce(view.begin(), view.end(), init, op)); }
+
+	template <class View, class T>
+	typename ft::enable_if<ft::is_view<View>::value, typename View::iterator>::type
+	find(const View& view, const T& value)
+	{ return (ft::find(view.begin(), view.end(), value)); }
+
+	template <class View, class UnaryPredicate>
+	typename ft::enable_if<ft::is_view<View>::value, typename View::iterator>::type
+	find_if(const View& view, UnaryPredicate pred)
+	{ return (ft::find_if(view.begin(), view.end(), pred)); }
+
+	template <class View, class T>
+	typename ft::enable_if<ft::is_view<View>::value, typename View::difference_type>::type
+	count(const View& view, const T& value)
+	{ return (ft::count(view.begin(), view.end(), value)); }
+
+	template <class View, class UnaryPredicate>
+	typename ft::enable_if<ft::is_view<View>::value, typename View::difference_type>::type
+	count_if(const View& view, UnaryPredicate pred)
+	{ return (ft::count_if(view.begin(), view.end(), pred)); }
+
+	template <class View>
+	typename ft::enable_if<ft::is_view<View>::value, ft::pair<typename View::iterator, typename View::iterator> >::type
+	minmax_element(const View& view)
+	{ return (ft::minmax_element(view.begin(), view.end())); }
+
+	template <class View, class OutputIterator>
+	typename ft::enable_if<ft::is_view<View>::value, OutputIterator>::type
+	copy(const View& view, OutputIterator result)
+	{ return (ft::copy(view.begin(), view.end(), result)); }
+
+}
+
+#endif